@@ -53,10 +53,12 @@ class Dictionary {
    * The callback has two arguments:
    * - dictionary: the dictionary instance that changed
    * - changeset: an object of array of keys changed (`deletions`, `insertions`, and `modifications`)
+   * @param {string[]} [keys] - When given, the listener only fires for changes to these keys, and the
+   *   changeset is restricted to them. The filter is applied natively, before any JavaScript runs.
    * @throws {Error} If `callback` is not a function.
    * @since 10.6.0
    */
-  addListener(callback) {}
+  addListener(callback, keys) {}
 
   /**
    * Remove the listener `callback`.
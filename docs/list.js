@@ -73,6 +73,32 @@ class List extends Collection {
    */
   splice(index, count, ...object) {}
 
+  /**
+   * Move the value at `from` to `to`, shifting the values in between.
+   * Unlike a `splice` deletion plus insertion, the reorder happens in place
+   * and listeners receive a single move entry in the change-set, which UI
+   * layers can animate directly.
+   *
+   * @param {number} from - The index of the value to move.
+   * @param {number} to - The index the value should end up at.
+   * @throws {Error} If not inside a write transaction, or if an index is
+   *   outside the bounds of the list.
+   * @since 10.22.0
+   */
+  move(from, to) {}
+
+  /**
+   * Exchange the values at two indices in place, reporting a single
+   * change-set entry per value instead of a delete+insert pair.
+   *
+   * @param {number} index1 - The index of the first value.
+   * @param {number} index2 - The index of the second value.
+   * @throws {Error} If not inside a write transaction, or if an index is
+   *   outside the bounds of the list.
+   * @since 10.22.0
+   */
+  swap(index1, index2) {}
+
   /**
    * Add one or more values to the _beginning_ of the list.
    *
@@ -52,10 +52,16 @@ class Object {
 
   /**
    * Returns the total count of incoming links to this object
+   * @param {string} [objectType] - The type of the objects that link to this object's type.
+   *   When given (together with `property`), only links through that relationship are counted,
+   *   which is much cheaper than `linkingObjects(objectType, property).length` as no
+   *   {@link Realm.Results} is constructed.
+   * @param {string} [property] - The name of the property that references objects of this object's type.
+   * @throws {Error} If only one of `objectType` and `property` is given, or the relationship is not valid.
    * @returns {number} number of links to this object.
    * @since 2.6.0
    */
-  linkingObjectsCount() {}
+  linkingObjectsCount(objectType, property) {}
 
   /**
    * Add a listener `callback` which will be called when a **live** object instance changes.
@@ -65,6 +71,9 @@ class Object {
    *   - `changes`: a dictionary with keys `deleted`, and `changedProperties`. `deleted` is true
    *       if the object has been deleted. `changesProperties` is an array of properties that have changed
    *       their value.
+   * @param {string[]} [keyPaths] - Indicates a lower bound on the changes relevant for the listener.
+   *   When given, the callback is only fired when a property on one of those key paths changes;
+   *   changes outside of the key paths are filtered out before they reach the callback.
    * @throws {Error} If `callback` is not a function.
    * @since 2.23.0
    * @example
@@ -77,7 +86,7 @@ class Object {
    *   });
    * })
    */
-  addListener(callback) {}
+  addListener(callback, keyPaths) {}
 
   /**
    * Remove the listener `callback`
@@ -84,6 +84,14 @@ class Realm {
    */
   get isClosed() {}
 
+  /**
+   * Indicates if this Realm is frozen: an immutable snapshot pinned to a specific version.
+   * @type {boolean}
+   * @readonly
+   * @since 10.22.0
+   */
+  get isFrozen() {}
+
   /**
    * Gets the sync session if this is a synced Realm
    * @type {Session}
@@ -179,6 +187,20 @@ class Realm {
    */
   delete(object) {}
 
+  /**
+   * Deletes many objects of one type in a single native call. Each entry may be
+   * a managed object of the given type or a primary key value; primary keys
+   * with no matching object are skipped. Must be called inside a write
+   * transaction.
+   * @param {Realm~ObjectType} type - The type of the objects to delete.
+   * @param {Array} objects - Managed objects and/or primary key values.
+   * @throws {Error} If called outside a write transaction, or an entry is an
+   *   invalid object or of a different type.
+   * @returns {number} the number of objects deleted.
+   * @since 10.22.0
+   */
+  deleteMany(type, objects) {}
+
   /**
    * Deletes a Realm model, including all of its objects.
    * If called outside a migration function, {@link Realm#schema schema} and {@link Realm#schemaVersion schemaVersion} are updated.
@@ -199,6 +221,24 @@ class Realm {
    */
   objects(type) {}
 
+  /**
+   * Compiles a query for repeated execution. The returned handle pre-resolves
+   * everything about the query that does not depend on argument values, so hot
+   * parameterized queries skip the per-call schema and key-path resolution;
+   * argument-free queries become entirely parse-free after the first run.
+   * @param {Realm~ObjectType} type - The type of Realm objects to query.
+   * @param {string} query - Query used to filter objects, with `$0`, `$1`, …
+   *   placeholders for arguments passed to `run`.
+   * @throws {Error} If type passed into this method is invalid, or if the type is
+   *   marked embedded or asymmetric.
+   * @returns {Realm.CompiledQuery} a handle whose `run(...args)` returns {@link Realm.Results}.
+   * @example
+   * const adultsIn = realm.compileQuery('Person', 'age > $0 && city == $1');
+   * const results = adultsIn.run(18, 'Copenhagen');
+   * @since 10.22.0
+   */
+  compileQuery(type, query) {}
+
   /**
    * Searches for a Realm object by its primary key.
    * @param {Realm~ObjectType} type - The type of Realm object to search for.
@@ -289,6 +329,44 @@ class Realm {
    */
   cancelTransaction() {}
 
+  /**
+   * Advance this Realm to the latest version on demand. Required to observe
+   * commits made by other processes when the Realm was opened with a
+   * `notificationPolicy` of `{manualRefresh: true}`, and delivers a version
+   * held back by a coalescing window immediately. A no-op on an already
+   * up-to-date Realm.
+   *
+   * @returns {boolean} `true` if the version actually advanced.
+   * @since 10.22.0
+   */
+  refresh() {}
+
+  /**
+   * Pin the read transaction at its current version. Until the matching
+   * {@link Realm#unpin unpin()} every query on this Realm instance sees the
+   * same data, even across `await` boundaries — the usual fix for torn reads
+   * when several related queries must agree. While pinned, commits from other
+   * processes are noticed but not delivered, and starting a local write
+   * transaction throws. Pins nest: the version is released when every pin()
+   * has been matched by an unpin().
+   *
+   * @throws {Error} If called inside a write transaction.
+   * @returns {Object} The pinned `{version, index}` handle.
+   * @since 10.22.0
+   */
+  pin() {}
+
+  /**
+   * Release one level of {@link Realm#pin pin()}. When the last pin is
+   * released the Realm catches up to the latest version immediately, so
+   * pinned versions are returned deterministically instead of whenever
+   * garbage collection happens to run.
+   *
+   * @throws {Error} If the Realm is not pinned.
+   * @since 10.22.0
+   */
+  unpin() {}
+
   /**
    * Replaces all string columns in this Realm with a string enumeration column and compacts the
    * database file.
@@ -307,6 +385,30 @@ class Realm {
    */
   compact() {}
 
+  /**
+   * Asynchronous variant of {@link Realm#compact compact()}. The compaction runs on a
+   * background thread, so the JavaScript thread is never blocked while a large file is
+   * rewritten. This Realm stays open and usable; it sees the compacted file on its
+   * next access.
+   * @returns {Promise<boolean>} which resolves with `true` if compaction succeeded, or
+   *   `false` if it was skipped (for example because other processes have the file open).
+   * @since 10.22.0
+   */
+  compactAsync() {}
+
+  /**
+   * Returns an immutable snapshot of this Realm, pinned to its current version. A frozen Realm
+   * never advances to newer versions, never delivers notifications, and may safely be read from
+   * any thread, which makes it suitable for fanning reads out to worker threads. Objects and
+   * collections read from it are frozen as well. Returns this Realm if it is already frozen.
+   *
+   * Keep frozen Realms short-lived: as long as one is open, the file cannot release the
+   * intermediate versions between the pinned version and the current one.
+   * @returns {Realm} an immutable Realm pinned to the current version.
+   * @since 10.22.0
+   */
+  freeze() {}
+
   /**
    * Writes a compacted copy of the Realm α) to the given path or β) with the given output
    *
@@ -330,6 +432,19 @@ class Realm {
    */
   writeCopyTo(pathOrConfig, encryptionKey) {}
 
+  /**
+   * Asynchronous variant of {@link Realm#writeCopyTo writeCopyTo()}, accepting only the
+   * {@link Realm~Configuration | Configuration} form. The copy reads from a snapshot pinned
+   * at the current version and runs on a background thread, so this Realm remains fully
+   * usable — including for writes — while the copy is in progress.
+   * @param {Realm~Configuration} config {@link Realm~Configuration | Configuration} that describes the output realm.
+   * @param {callback(number, number)} [onProgress] - Invoked with `(bytesWritten, estimatedTotalBytes)`
+   *   updates, coalesced to at most one call per interval like sync progress notifications.
+   * @returns {Promise<void>} which resolves once the copy has been written.
+   * @since 10.22.0
+   */
+  writeCopyToAsync(config, onProgress) {}
+
   /**
    * Get the current schema version of the Realm at the given path.
    * @param {string} path - The path to the file where the
@@ -382,6 +497,18 @@ class Realm {
    * @throws {Error} If an I/O error occured or method is not implemented.
    */
   static copyBundledRealmFiles() {}
+
+  /**
+   * Returns a snapshot of the memory held by the binding: live native wrapper
+   * counts per class, the number of protected JavaScript references, the
+   * number of registered notification tokens, and an entry per open Realm
+   * with its file size, live version count and pinned version count. A
+   * growing `pinnedVersions` or `liveVersions` number usually explains a
+   * growing file size.
+   * @since 10.22.0
+   * @returns {Object} `{wrappedObjects, protectedReferences, notificationTokens, openRealmCount, openRealms}`.
+   */
+  static memoryStats() {}
 }
 /**
  * This describes the different options used to create a {@link Realm} instance.
@@ -401,13 +528,16 @@ class Realm {
  * @property {boolean} [deleteRealmIfMigrationNeeded=false] - Specifies if this Realm should be deleted
  *   if a migration is needed.
  *   This option is not available on synced realms.
- * @property {callback(number, number)} [shouldCompactOnLaunch] - The function called when opening
+ * @property {callback(number, number)|Object} [shouldCompactOnLaunch] - The function called when opening
  *   a Realm for the first time during the life of a process to determine if it should be compacted
  *   before being returned to the user. The function takes two arguments:
  *     - `totalSize` - The total file size (data + free space)
  *     - `usedSize` - The total bytes used by data in the file.
  *   It returns `true` to indicate that an attempt to compact the file should be made. The compaction
  *   will be skipped if another process is accessing it.
+ *   Alternatively an object `{thresholdBytes, usedRatio}` can be given; the file is then compacted
+ *   when it is larger than `thresholdBytes` and less than `usedRatio` (0–1) of it is used by data.
+ *   The object form is evaluated natively, without a round-trip to the JavaScript thread.
  * @property {callback(realm)} [onFirstOpen] - The function called when opening a Realm for
  *   the first time. The function can populate the Realm prior to opening it. When calling the callback,
  *   the Realm will be in a write transaction. The callback takes one argument:
@@ -435,6 +565,13 @@ class Realm {
  * @property {number} [schemaVersion] - **Required** (and must be incremented) after
  *   changing the `schema`.
  * @property {Realm.App.Sync~SyncConfiguration} [sync] - Sync configuration parameters.
+ * @property {Object} [notificationPolicy] - Controls how commits made by other
+ *   processes (or threads) wake this Realm instance. `coalesceWindowMs` and
+ *   `maxWakesPerSecond` bound how often external commits run JavaScript: commits
+ *   arriving faster than the derived interval are coalesced and the latest
+ *   version is delivered once the window passes. `manualRefresh: true` disables
+ *   automatic delivery entirely; the Realm then only advances when
+ *   {@link Realm#refresh refresh()} is called. Local writes are unaffected.
  */
 
 /**
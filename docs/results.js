@@ -36,4 +36,27 @@ class Results extends Collection {
    * @since 2.0.0-rc20
    */
   update(property, value) {}
+
+  /**
+   * Counts the objects in the results, or the objects whose given property
+   * is non-null. The count runs in the database without constructing any
+   * objects, so it is much cheaper than filtering and reading `length`.
+   * @param {string} [property] - The property whose non-null values to count.
+   * @throws {Error} If no property with the name exists.
+   * @returns {number} the number of matching objects.
+   * @since 10.22.0
+   */
+  count(property) {}
+
+  /**
+   * Returns the objects at positions `[start, start + count)` as a plain array,
+   * materialized in a single native call. The following page is prepared in the
+   * background of the event loop, so forward pagination (infinite scrolling)
+   * usually finds its next page already converted.
+   * @param {number} start - Position of the first object in the page.
+   * @param {number} count - Maximum number of objects in the page.
+   * @returns {Array} the objects in the requested range.
+   * @since 10.22.0
+   */
+  window(start, count) {}
 }
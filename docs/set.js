@@ -77,4 +77,52 @@ class Set extends Collection {
    * @returns {boolean}: True if the value exists in the Set, false otherwise
    */
   has(value) {}
+
+  /**
+   * Compute the union of the Set and another Set or an array of values.
+   * The comparison runs natively against the Set's sorted storage, and the
+   * result is materialized as a plain array in a single native call.
+   *
+   * @param {Realm.Set|T[]} values Another Set or an array of values
+   * @throws {TypeError} If `values` is a Set of a different element type, or
+   *   an array containing a value which cannot be stored in the Set.
+   * @returns {T[]}: The elements present in either collection
+   * @since 10.22.0
+   */
+  union(values) {}
+
+  /**
+   * Compute the intersection of the Set and another Set or an array of values.
+   *
+   * @param {Realm.Set|T[]} values Another Set or an array of values
+   * @throws {TypeError} If `values` is a Set of a different element type, or
+   *   an array containing a value which cannot be stored in the Set.
+   * @returns {T[]}: The elements present in both collections
+   * @since 10.22.0
+   */
+  intersection(values) {}
+
+  /**
+   * Compute the difference of the Set and another Set or an array of values,
+   * i.e. the elements of the Set that are not present in `values`.
+   *
+   * @param {Realm.Set|T[]} values Another Set or an array of values
+   * @throws {TypeError} If `values` is a Set of a different element type, or
+   *   an array containing a value which cannot be stored in the Set.
+   * @returns {T[]}: The elements of the Set not present in `values`
+   * @since 10.22.0
+   */
+  difference(values) {}
+
+  /**
+   * Check whether every element of the Set is present in another Set or an
+   * array of values.
+   *
+   * @param {Realm.Set|T[]} values Another Set or an array of values
+   * @throws {TypeError} If `values` is a Set of a different element type, or
+   *   an array containing a value which cannot be stored in the Set.
+   * @returns {boolean}: True if the Set is a subset of `values`
+   * @since 10.22.0
+   */
+  isSubsetOf(values) {}
 }
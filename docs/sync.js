@@ -38,8 +38,8 @@
  * This describes the options to configure client reset.
  * @typedef {Object} Realm.App.Sync~ClientResetConfiguration
  * @property {string} mode - Either "manual" (deprecated, see also `Realm.App.Sync.initiateClientReset()`) or "discardLocal" (download a fresh copy from the server).
- * @property {callback(realm)|null} [clientResetBefore] - called before sync initiates a client reset.
- * @property {callback(beforeRealm, afterRealm)|null} [clientResetAfter] - called after client reset has been executed; `beforeRealm` and `afterRealm` are instances of the Realm before and after the client reset.
+ * @property {callback(realm)|null} [clientResetBefore] - called before sync initiates a client reset; `realm` is a frozen, read-only view of the local state.
+ * @property {callback(beforeRealm, afterRealm)|null} [clientResetAfter] - called after client reset has been executed; `beforeRealm` is a frozen, read-only view of the Realm before the client reset and `afterRealm` is the live Realm after it.
  * @since {10.11.0}
  */
 
@@ -302,6 +302,11 @@ class Sync {
    *
    * @param {Realm.App} app - the Realm app.
    * @param {Realm.App.Sync~logCallback} logger - The log callback.
+   * @param {string[]} [categories] - Log categories to deliver: any of
+   *   `"connection"`, `"session"`, `"changeset"` and `"other"`. Defaults to
+   *   all categories. Lines in unsubscribed categories are dropped inside the
+   *   sync client before they are queued for the logger, so e.g. connection
+   *   diagnostics at debug level no longer pay for changeset-level logging.
    * @example
    * {
    * const app = new Realm.App(getAppConfig());
@@ -311,7 +316,27 @@ class Sync {
    * }
    * @see {Realm.App.Sync~setLogLevel}
    */
-  static setLogger(app, logger) {}
+  static setLogger(app, logger, categories) {}
+
+  /**
+   * Route the sync client's log into a binary ring file instead of a JS
+   * logger. Each log line becomes one fixed-size record in a memory-mapped
+   * file — no text is formatted and no JS code runs per line — so
+   * continuous trace-level logging can stay enabled in production for
+   * postmortems. When the file fills up, the oldest records are overwritten.
+   * Decode the file offline with `node scripts/decode-binary-log.js <path>`;
+   * a `<path>.strings` side file written alongside is needed for decoding.
+   *
+   * Like `setLogger`, this must be called after creating the App instance
+   * but before opening any Realms, and replaces any previously set logger.
+   *
+   * @param {Realm.App} app - the Realm app.
+   * @param {string} path - where to create the ring file.
+   * @param {number} [maxBytes] - size of the ring file (default 16 MiB).
+   * @since 10.22.0
+   * @see {Realm.App.Sync~setLogLevel}
+   */
+  static enableBinaryLogging(app, path, maxBytes) {}
 
   /**
    * Set the application part of the User-Agent string that will be sent to the Realm Object Server when a session
@@ -378,12 +403,42 @@ class Sync {
   /**
    * Returns all sync sessions for a user.
    *
+   * Session objects are reused across calls, so polling this method does not
+   * allocate a new wrapper per session; only sessions that appeared since the
+   * previous call get a new object.
+   *
    * @param {Realm.User} user  - the user.
    * @returns {Array<Realm.App.Sync.Session>} an array of sessions
    * @since 10.0.0
    */
   static getAllSyncSessions(user) {}
 
+  /**
+   * Returns the number of sync sessions for a user without constructing
+   * session objects, as a cheap alternative to
+   * `getAllSyncSessions(user).length` for monitoring code.
+   *
+   * @param {Realm.User} user - the user.
+   * @returns {number} the number of sessions.
+   * @since 10.22.0
+   */
+  static sessionCount(user) {}
+
+  /**
+   * Returns aggregated transfer statistics for all of a user's sync sessions
+   * as a single plain object. The counters are sampled from the sync client
+   * without touching the sessions themselves, so calling this frequently
+   * (e.g. from a diagnostics overlay) is cheap. Byte counters are cumulative
+   * from the first time statistics were requested for a session.
+   *
+   * @param {Realm.User} user - the user.
+   * @returns {Object} an object with `sessionCount`, `connectedSessions`,
+   *   `connectingSessions`, `disconnectedSessions`, `uploadedBytes`,
+   *   `downloadedBytes`, `pendingUploadBytes` and `pendingDownloadBytes`.
+   * @since 10.22.0
+   */
+  static getSyncStats(user) {}
+
   /**
    * Returns the session associated with a user and partition value.
    *
@@ -1003,8 +1058,12 @@ class Session {
    * @param {callback(transferred, transferable)} callback - called with the following arguments:
    *   - `transferred` - the current number of bytes already transferred
    *   - `transferable` - the total number of transferable bytes (the number of bytes already transferred plus the number of bytes pending transfer)
+   * @param {number|Realm.App.Sync.ProgressNotificationOptions} [options] - throttling options. A number is shorthand
+   * for `minIntervalMs`: the minimum number of milliseconds between deliveries of the callback. An object may also set
+   * `minDeltaBytes`: the minimum number of bytes that must have been transferred since the last delivery. Intermediate
+   * updates are coalesced before they reach the JavaScript thread; the final update of a transfer is always delivered.
    */
-  addProgressNotification(direction, mode, progressCallback) {}
+  addProgressNotification(direction, mode, progressCallback, options) {}
 
   /** Unregister a progress notification callback that was previously registered with addProgressNotification.
    * Calling the function multiple times with the same callback is ignored.
@@ -1016,11 +1075,21 @@ class Session {
    * Registers a connection notification on the session object. This will be notified about changes to the
    * underlying connection to the Realm Object Server.
    *
-   * @param {callback(newState, oldState)} callback - called with the following arguments:
+   * @param {callback(newState, oldState, info)} callback - called with the following arguments:
    *   - `newState` - the new state of the connection
    *   - `oldState` - the state the connection transitioned from.
+   *   - `info` - only present when debouncing: `{flapCount, epoch}`, where
+   *     `flapCount` is the number of transitions collapsed into this delivery
+   *     and `epoch` counts every transition observed on this session.
+   * @param {number|Object} [options] - a number (or `{debounceMs}`) giving a
+   *   debounce window in milliseconds. Transitions within the window are
+   *   collapsed natively, before any JavaScript runs: the first transition
+   *   after a quiet period is delivered immediately, and flaps inside the
+   *   window are folded into the next delivery together with their count, so
+   *   an unstable connection wakes the event loop once per window rather than
+   *   once per flap.
    */
-  addConnectionNotification(connectionCallback) {}
+  addConnectionNotification(connectionCallback, options) {}
 
   /**
    * Unregister a state notification callback that was previously registered with addStateNotification.
@@ -1053,6 +1122,21 @@ class Session {
    */
   isConnected() {}
 
+  /**
+   * Returns a snapshot of this session's transfer statistics as a plain
+   * object: the connection state, cumulative uploaded/downloaded byte
+   * counters and the number of bytes still waiting to be transferred in
+   * either direction. The counters start accumulating the first time
+   * statistics are requested for the session.
+   *
+   * @returns {Object|undefined} an object with `connectionState`,
+   *   `uploadedBytes`, `uploadableBytes`, `downloadedBytes`,
+   *   `downloadableBytes`, `pendingUploadBytes` and `pendingDownloadBytes`,
+   *   or `undefined` if the session has been closed.
+   * @since 10.22.0
+   */
+  stats() {}
+
   /**
    * Resumes a sync session that has been paused.
    *
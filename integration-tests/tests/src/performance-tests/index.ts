@@ -17,3 +17,4 @@
 ////////////////////////////////////////////////////////////////////////////
 
 import "./property-reads";
+import "./regression-suite";
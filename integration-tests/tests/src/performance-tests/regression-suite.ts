@@ -0,0 +1,277 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import Realm from "realm";
+import { expect } from "chai";
+
+// Timed end-to-end scenarios with a recorded baseline per platform. Unlike
+// the micro-benchmarks in property-reads.ts, these fail the run when a
+// scenario regresses past its baseline, and they attach the native
+// phase-trace and metrics counters to the failure so a regression points at
+// a subsystem rather than just a number.
+
+type Milliseconds = number;
+
+type PlatformBaselines = {
+  node?: Milliseconds;
+  electron?: Milliseconds;
+  android?: Milliseconds;
+  ios?: Milliseconds;
+  // Covers any platform without its own recorded baseline.
+  default: Milliseconds;
+};
+
+type StartupPhase = { phase: string; start: number; duration: number };
+
+// Underscore-prefixed natives are intentionally absent from the public typings.
+type InstrumentedRealm = typeof Realm & {
+  _startupTrace?: StartupPhase[];
+  _metrics?: Record<string, number>;
+  _resetMetrics?: () => void;
+};
+const InstrumentedRealm = Realm as InstrumentedRealm;
+
+// A scenario fails when it exceeds its baseline by more than this factor.
+// The default absorbs shared-CI and emulator variance; tighten it through
+// the environment when running on dedicated devices.
+const REGRESSION_FACTOR = parseFloat(
+  typeof environment.performanceRegressionFactor === "string" ? environment.performanceRegressionFactor : "3",
+);
+
+const WRITE_OBJECT_COUNT = 10_000;
+const QUERY_ROW_COUNT = 100_000;
+const NOTIFICATION_WRITE_COUNT = 25;
+
+function currentPlatform(): keyof PlatformBaselines {
+  if (environment.android) return "android";
+  if (environment.ios) return "ios";
+  if (environment.electron) return "electron";
+  if (environment.node) return "node";
+  return "default";
+}
+
+function baselineFor(baselines: PlatformBaselines): Milliseconds {
+  return baselines[currentPlatform()] ?? baselines.default;
+}
+
+// Not every environment exposes the high resolution timer.
+const globalPerformance = (globalThis as { performance?: { now(): Milliseconds } }).performance;
+const now: () => Milliseconds = globalPerformance ? () => globalPerformance.now() : Date.now;
+
+function topStartupPhases(): string {
+  const trace = InstrumentedRealm._startupTrace;
+  if (!trace || trace.length === 0) {
+    return "startup trace unavailable";
+  }
+  return trace
+    .slice()
+    .sort((a, b) => b.duration - a.duration)
+    .slice(0, 3)
+    .map(({ phase, duration }) => `${phase}=${duration.toFixed(1)}ms`)
+    .join(" ");
+}
+
+function metricsDelta(before: Record<string, number>, after: Record<string, number>): string {
+  const parts: string[] = [];
+  for (const key of Object.keys(after)) {
+    const delta = after[key] - (before[key] || 0);
+    if (delta > 0) {
+      parts.push(`${key}=+${delta}`);
+    }
+  }
+  return parts.length > 0 ? parts.join(" ") : "no counters changed";
+}
+
+function readMetrics(): Record<string, number> {
+  return InstrumentedRealm._metrics || {};
+}
+
+type Scenario = {
+  title: string;
+  baselines: PlatformBaselines;
+  // Runs outside the timed window.
+  before?(this: Mocha.Context): void | Promise<void>;
+  // The timed window; returns a duration when the scenario times a sub-window
+  // itself (notification latency), otherwise the wall-clock time is used.
+  run(this: Mocha.Context): void | Milliseconds | Promise<void | Milliseconds>;
+  after?(this: Mocha.Context): void;
+};
+
+function itPerformsScenario({ title, baselines, before, run, after }: Scenario): void {
+  it(title, async function (this: Mocha.Context) {
+    this.timeout("5m").slow("5m");
+    if (before) {
+      await before.call(this);
+    }
+    const metricsBefore = readMetrics();
+    const started = now();
+    const reported = await run.call(this);
+    const duration = typeof reported === "number" ? reported : now() - started;
+    if (after) {
+      after.call(this);
+    }
+
+    const baseline = baselineFor(baselines);
+    const limit = baseline * REGRESSION_FACTOR;
+    // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+    this.test!.title += ` (${duration.toFixed(1)}ms, baseline ${baseline}ms)`;
+    expect(duration, `'${title}' took ${duration.toFixed(1)}ms (limit ${limit.toFixed(0)}ms for ${currentPlatform()}); startup: ${topStartupPhases()}; metrics: ${metricsDelta(metricsBefore, readMetrics())}`).to.be.below(limit);
+  });
+}
+
+const SCHEMA: Realm.ObjectSchema[] = [
+  {
+    name: "Row",
+    properties: {
+      group: "int",
+      value: "int",
+      title: "string",
+    },
+  },
+];
+
+function uniqueConfig(): Realm.Configuration {
+  const nonce = new Realm.BSON.ObjectID().toHexString();
+  return { path: `perf-${nonce}.realm`, schema: SCHEMA };
+}
+
+describe("Performance regression suite", () => {
+  afterEach(() => {
+    Realm.clearTestState();
+  });
+
+  itPerformsScenario({
+    title: "opens a Realm (cold)",
+    baselines: { node: 50, android: 150, ios: 100, default: 150 },
+    run(this: Mocha.Context & { realm?: Realm }) {
+      // A path that has never existed: measures file creation, schema
+      // initialization and binding setup. The fileOpen/schemaParse startup
+      // phases attached on failure split this between core and binding.
+      this.realm = new Realm(uniqueConfig());
+    },
+    after(this: Mocha.Context & { realm: Realm }) {
+      this.realm.close();
+    },
+  });
+
+  itPerformsScenario({
+    title: "opens a Realm (warm)",
+    baselines: { node: 20, android: 75, ios: 50, default: 75 },
+    before(this: Mocha.Context & { config?: Realm.Configuration }) {
+      this.config = uniqueConfig();
+      const realm = new Realm(this.config);
+      realm.close();
+    },
+    run(this: Mocha.Context & { config: Realm.Configuration; realm?: Realm }) {
+      this.realm = new Realm(this.config);
+    },
+    after(this: Mocha.Context & { realm: Realm }) {
+      this.realm.close();
+    },
+  });
+
+  itPerformsScenario({
+    title: `writes ${WRITE_OBJECT_COUNT} objects in one transaction`,
+    baselines: { node: 500, android: 2000, ios: 1500, default: 2000 },
+    before(this: Mocha.Context & { realm?: Realm }) {
+      this.realm = new Realm(uniqueConfig());
+    },
+    run(this: Mocha.Context & { realm: Realm }) {
+      this.realm.write(() => {
+        for (let i = 0; i < WRITE_OBJECT_COUNT; i++) {
+          this.realm.create("Row", { group: i % 10, value: i, title: `row-${i}` });
+        }
+      });
+    },
+    after(this: Mocha.Context & { realm: Realm }) {
+      expect(this.realm.objects("Row").length).equals(WRITE_OBJECT_COUNT);
+      this.realm.close();
+    },
+  });
+
+  itPerformsScenario({
+    title: `iterates a ${QUERY_ROW_COUNT} row query`,
+    baselines: { node: 2000, android: 8000, ios: 6000, default: 8000 },
+    before(this: Mocha.Context & { realm?: Realm }) {
+      this.realm = new Realm(uniqueConfig());
+      this.realm.write(() => {
+        for (let i = 0; i < QUERY_ROW_COUNT; i++) {
+          this.realm.create("Row", { group: i % 10, value: i, title: `row-${i}` });
+        }
+      });
+    },
+    run(this: Mocha.Context & { realm: Realm }) {
+      const rows = this.realm.objects<{ value: number }>("Row").filtered("group < 10");
+      let sum = 0;
+      for (const row of rows) {
+        sum += row.value;
+      }
+      // Consume the sum so the property reads cannot be optimized away.
+      expect(sum).equals((QUERY_ROW_COUNT * (QUERY_ROW_COUNT - 1)) / 2);
+    },
+    after(this: Mocha.Context & { realm: Realm }) {
+      this.realm.close();
+    },
+  });
+
+  itPerformsScenario({
+    title: `delivers notifications across ${NOTIFICATION_WRITE_COUNT} sustained writes`,
+    baselines: { node: 10, android: 50, ios: 30, default: 50 },
+    before(this: Mocha.Context & { realm?: Realm }) {
+      this.realm = new Realm(uniqueConfig());
+    },
+    async run(this: Mocha.Context & { realm: Realm }) {
+      // Reports the mean commit-to-callback latency rather than the loop's
+      // wall-clock time, so the baseline tracks delivery and not write cost.
+      const rows = this.realm.objects("Row");
+      const latencies: Milliseconds[] = [];
+      let committedAt = 0;
+      let notified: (() => void) | undefined;
+
+      const listener: Realm.CollectionChangeCallback<unknown> = (collection, changes) => {
+        // The initial notification carries no insertions and records no sample.
+        if (changes.insertions.length > 0) {
+          latencies.push(now() - committedAt);
+        }
+        if (notified) notified();
+      };
+      rows.addListener(listener);
+      // Wait for the initial notification before timing deliveries.
+      await new Promise<void>((resolve) => {
+        notified = resolve;
+      });
+
+      for (let i = 0; i < NOTIFICATION_WRITE_COUNT; i++) {
+        const delivered = new Promise<void>((resolve) => {
+          notified = resolve;
+        });
+        this.realm.write(() => {
+          this.realm.create("Row", { group: i % 10, value: i, title: `row-${i}` });
+        });
+        committedAt = now();
+        await delivered;
+      }
+      rows.removeListener(listener);
+
+      return latencies.reduce((sum, latency) => sum + latency, 0) / latencies.length;
+    },
+    after(this: Mocha.Context & { realm: Realm }) {
+      this.realm.close();
+    },
+  });
+});
@@ -1013,6 +1013,72 @@ describe.skipIf(environment.missingServer, "Flexible sync", function () {
         });
       });
 
+      describe("#updateBatch", function () {
+        it("returns a promise resolving to the added subscriptions", async function (this: RealmContext) {
+          const subs = this.realm.subscriptions;
+          const result = subs.updateBatch([
+            { query: this.realm.objects(FlexiblePersonSchema.name).filtered("age < 10") },
+            { query: this.realm.objects(DogSchema.name).filtered("age > 30"), name: "oldDogs" },
+          ]);
+
+          expect(result).to.be.an.instanceOf(Promise);
+
+          const added = await result;
+          expect(added).to.have.length(2);
+          expect(added[0]).to.be.instanceOf(Realm.App.Sync.Subscription);
+          expect(added[0].queryString).to.equal("age < 10");
+          expect(added[1].name).to.equal("oldDogs");
+        });
+
+        it("applies all changes in a single new version", async function (this: RealmContext) {
+          const { subs, query } = await addSubscriptionForPersonAndSync(this.realm);
+          const versionBefore = subs.version;
+
+          await subs.updateBatch([
+            { remove: query },
+            { query: this.realm.objects(FlexiblePersonSchema.name).filtered("age < 10") },
+            { query: this.realm.objects(FlexiblePersonSchema.name).filtered("age > 20") },
+            { query: this.realm.objects(DogSchema.name).filtered("age > 30") },
+          ]);
+
+          expect(subs).to.have.length(3);
+          expect(subs.version).to.equal(versionBefore + 1);
+        });
+
+        it("removes subscriptions by name", async function (this: RealmContext) {
+          await addSubscriptionForPersonAndSync(this.realm, { name: "personSubs" });
+          const subs = this.realm.subscriptions;
+
+          await subs.updateBatch([{ removeByName: "personSubs" }]);
+
+          expect(subs.isEmpty).to.be.true;
+        });
+
+        it("mutates the SubscriptionSet instance", async function (this: RealmContext) {
+          const subs = this.realm.subscriptions;
+          await subs.updateBatch([{ query: this.realm.objects(FlexiblePersonSchema.name) }]);
+
+          expect(subs).to.have.length(1);
+        });
+
+        it("commits nothing if a descriptor is invalid", async function (this: RealmContext) {
+          const { subs } = await addSubscriptionForPersonAndSync(this.realm, { name: "test" });
+
+          await expect(
+            subs.updateBatch([
+              { query: this.realm.objects(DogSchema.name) },
+              {
+                query: this.realm.objects(FlexiblePersonSchema.name).filtered("age > 20"),
+                name: "test",
+                throwOnUpdate: true,
+              },
+            ]),
+          ).to.be.rejectedWith("A subscription with the name 'test' already exists but has a different query.");
+
+          expect(subs).to.have.length(1);
+        });
+      });
+
       describe("#add", function () {
         it("returns a Subscription object", async function (this: RealmContext) {
           const { sub } = addSubscriptionForPerson(this.realm);
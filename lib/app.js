@@ -23,6 +23,10 @@ const instanceMethods = {
     return promisify((cb) => this._logIn(credentials, cb));
   },
 
+  logInMany(credentialsList) {
+    return promisify((cb) => this._logInMany(credentialsList, cb));
+  },
+
   removeUser(user) {
     return promisify((cb) => this._removeUser(user, cb));
   },
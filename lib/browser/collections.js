@@ -89,6 +89,9 @@ export function createCollection(prototype, realmId, info, _mutable) {
     length: {
       get: util.getterForProperty("length"),
     },
+    version: {
+      get: util.getterForProperty("version"),
+    },
     type: {
       value: info.dataType,
     },
@@ -27,7 +27,11 @@ export function performFetch(request, responseHandler) {
   if (typeof responseHandler !== "object") {
     throw new Error("Expected a response handler object");
   }
-  const { onSuccess, onError } = responseHandler;
+  const { onSuccess, onError, onResponseBegin, onResponseChunk, onResponseEnd } = responseHandler;
+  // Bodies above this size are streamed in fixed-size frames instead of one
+  // RPC message, so a large sync payload never gets stringified and parsed in
+  // one shot on the device (or in the debugger).
+  const CHUNK_SIZE = 256 * 1024;
   // Delegate to fetch
   fetch(url, init)
     .then(async (response) => {
@@ -37,13 +41,27 @@ export function performFetch(request, responseHandler) {
       response.headers.forEach((value, key) => {
         headers[key] = value;
       });
+      if (decodedBody.length > CHUNK_SIZE && onResponseChunk) {
+        onResponseBegin({ statusCode: response.status, headers });
+        for (let offset = 0; offset < decodedBody.length; offset += CHUNK_SIZE) {
+          // Each call travels the RPC channel synchronously, so the next
+          // frame is only sent once the device has consumed this one.
+          onResponseChunk(decodedBody.slice(offset, offset + CHUNK_SIZE));
+        }
+        onResponseEnd();
+        return null;
+      }
       return {
         statusCode: response.status,
         headers,
         body: decodedBody,
       };
     })
-    .then(onSuccess, onError);
+    .then((response) => {
+      if (response) {
+        onSuccess(response);
+      }
+    }, onError);
 }
 
 function deserializeResponseHandler(realmId, info) {
@@ -58,6 +76,15 @@ function deserializeResponseHandler(realmId, info) {
     onError: function () {
       callMethod(undefined, id, "onError", Array.from(arguments));
     },
+    onResponseBegin: function () {
+      callMethod(undefined, id, "onResponseBegin", Array.from(arguments));
+    },
+    onResponseChunk: function () {
+      callMethod(undefined, id, "onResponseChunk", Array.from(arguments));
+    },
+    onResponseEnd: function () {
+      callMethod(undefined, id, "onResponseEnd", Array.from(arguments));
+    },
   };
 }
 
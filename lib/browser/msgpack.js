@@ -0,0 +1,365 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+// Minimal MessagePack codec for the RPC debug wire. It covers exactly the
+// value shapes exchanged with the RPC server (null, booleans, numbers,
+// strings, arrays, string-keyed maps and raw byte payloads), matching what
+// the server's JSON library produces and consumes for to_msgpack/from_msgpack.
+
+class Writer {
+  constructor() {
+    this.bytes = new Uint8Array(1024);
+    this.length = 0;
+  }
+
+  reserve(count) {
+    if (this.length + count > this.bytes.length) {
+      let grown = new Uint8Array(Math.max(this.bytes.length * 2, this.length + count));
+      grown.set(this.bytes.subarray(0, this.length));
+      this.bytes = grown;
+    }
+  }
+
+  byte(value) {
+    this.reserve(1);
+    this.bytes[this.length++] = value;
+  }
+
+  uint(value, count) {
+    this.reserve(count);
+    for (let shift = (count - 1) * 8; shift >= 0; shift -= 8) {
+      this.bytes[this.length++] = (value / Math.pow(2, shift)) & 0xff;
+    }
+  }
+
+  raw(bytes) {
+    this.reserve(bytes.length);
+    this.bytes.set(bytes, this.length);
+    this.length += bytes.length;
+  }
+
+  float64(value) {
+    this.reserve(8);
+    new DataView(this.bytes.buffer).setFloat64(this.length, value);
+    this.length += 8;
+  }
+
+  result() {
+    return this.bytes.subarray(0, this.length);
+  }
+}
+
+function utf8Encode(string) {
+  let bytes = [];
+  for (let i = 0; i < string.length; i++) {
+    let code = string.codePointAt(i);
+    if (code > 0xffff) {
+      i++; // surrogate pair consumed two UTF-16 units
+    }
+    if (code < 0x80) {
+      bytes.push(code);
+    } else if (code < 0x800) {
+      bytes.push(0xc0 | (code >> 6), 0x80 | (code & 0x3f));
+    } else if (code < 0x10000) {
+      bytes.push(0xe0 | (code >> 12), 0x80 | ((code >> 6) & 0x3f), 0x80 | (code & 0x3f));
+    } else {
+      bytes.push(
+        0xf0 | (code >> 18),
+        0x80 | ((code >> 12) & 0x3f),
+        0x80 | ((code >> 6) & 0x3f),
+        0x80 | (code & 0x3f),
+      );
+    }
+  }
+  return bytes;
+}
+
+function utf8Decode(bytes, start, length) {
+  let codes = [];
+  let end = start + length;
+  for (let i = start; i < end; ) {
+    let byte = bytes[i++];
+    let code;
+    if (byte < 0x80) {
+      code = byte;
+    } else if (byte < 0xe0) {
+      code = ((byte & 0x1f) << 6) | (bytes[i++] & 0x3f);
+    } else if (byte < 0xf0) {
+      code = ((byte & 0x0f) << 12) | ((bytes[i++] & 0x3f) << 6) | (bytes[i++] & 0x3f);
+    } else {
+      code = ((byte & 0x07) << 18) | ((bytes[i++] & 0x3f) << 12) | ((bytes[i++] & 0x3f) << 6) | (bytes[i++] & 0x3f);
+    }
+    if (code > 0xffff) {
+      code -= 0x10000;
+      codes.push(0xd800 | (code >> 10), 0xdc00 | (code & 0x3ff));
+    } else {
+      codes.push(code);
+    }
+  }
+  // Avoid call-stack limits from applying huge argument lists at once.
+  let result = "";
+  for (let i = 0; i < codes.length; i += 0x1000) {
+    result += String.fromCharCode.apply(null, codes.slice(i, i + 0x1000));
+  }
+  return result;
+}
+
+function encodeValue(writer, value) {
+  if (value === null || value === undefined) {
+    writer.byte(0xc0);
+  } else if (value === false) {
+    writer.byte(0xc2);
+  } else if (value === true) {
+    writer.byte(0xc3);
+  } else if (typeof value === "number") {
+    if (Number.isSafeInteger(value)) {
+      if (value >= 0) {
+        if (value < 0x80) {
+          writer.byte(value);
+        } else if (value < 0x100) {
+          writer.byte(0xcc);
+          writer.uint(value, 1);
+        } else if (value < 0x10000) {
+          writer.byte(0xcd);
+          writer.uint(value, 2);
+        } else if (value < 0x100000000) {
+          writer.byte(0xce);
+          writer.uint(value, 4);
+        } else {
+          writer.byte(0xcf);
+          writer.uint(value, 8);
+        }
+      } else if (value >= -0x20) {
+        writer.byte(0x100 + value);
+      } else if (value >= -0x80) {
+        writer.byte(0xd0);
+        writer.uint(value + 0x100, 1);
+      } else if (value >= -0x8000) {
+        writer.byte(0xd1);
+        writer.uint(value + 0x10000, 2);
+      } else if (value >= -0x80000000) {
+        writer.byte(0xd2);
+        writer.uint(value + 0x100000000, 4);
+      } else {
+        writer.byte(0xcb);
+        writer.float64(value);
+      }
+    } else {
+      writer.byte(0xcb);
+      writer.float64(value);
+    }
+  } else if (typeof value === "string") {
+    let bytes = utf8Encode(value);
+    if (bytes.length < 0x20) {
+      writer.byte(0xa0 | bytes.length);
+    } else if (bytes.length < 0x100) {
+      writer.byte(0xd9);
+      writer.uint(bytes.length, 1);
+    } else if (bytes.length < 0x10000) {
+      writer.byte(0xda);
+      writer.uint(bytes.length, 2);
+    } else {
+      writer.byte(0xdb);
+      writer.uint(bytes.length, 4);
+    }
+    writer.raw(bytes);
+  } else if (value instanceof ArrayBuffer || ArrayBuffer.isView(value)) {
+    let bytes =
+      value instanceof ArrayBuffer
+        ? new Uint8Array(value)
+        : new Uint8Array(value.buffer, value.byteOffset, value.byteLength);
+    if (bytes.length < 0x100) {
+      writer.byte(0xc4);
+      writer.uint(bytes.length, 1);
+    } else if (bytes.length < 0x10000) {
+      writer.byte(0xc5);
+      writer.uint(bytes.length, 2);
+    } else {
+      writer.byte(0xc6);
+      writer.uint(bytes.length, 4);
+    }
+    writer.raw(bytes);
+  } else if (Array.isArray(value)) {
+    if (value.length < 0x10) {
+      writer.byte(0x90 | value.length);
+    } else if (value.length < 0x10000) {
+      writer.byte(0xdc);
+      writer.uint(value.length, 2);
+    } else {
+      writer.byte(0xdd);
+      writer.uint(value.length, 4);
+    }
+    value.forEach((item) => encodeValue(writer, item));
+  } else if (typeof value === "object") {
+    let keys = Object.keys(value);
+    if (keys.length < 0x10) {
+      writer.byte(0x80 | keys.length);
+    } else if (keys.length < 0x10000) {
+      writer.byte(0xde);
+      writer.uint(keys.length, 2);
+    } else {
+      writer.byte(0xdf);
+      writer.uint(keys.length, 4);
+    }
+    keys.forEach((key) => {
+      encodeValue(writer, key);
+      encodeValue(writer, value[key]);
+    });
+  } else {
+    throw new Error("Cannot encode value of type " + typeof value);
+  }
+}
+
+class Reader {
+  constructor(bytes) {
+    this.bytes = bytes;
+    this.offset = 0;
+  }
+
+  byte() {
+    return this.bytes[this.offset++];
+  }
+
+  uint(count) {
+    let value = 0;
+    for (let i = 0; i < count; i++) {
+      value = value * 0x100 + this.bytes[this.offset++];
+    }
+    return value;
+  }
+
+  int(count) {
+    let value = this.uint(count);
+    let limit = Math.pow(2, count * 8 - 1);
+    return value >= limit ? value - limit * 2 : value;
+  }
+
+  float(count) {
+    let view = new DataView(this.bytes.buffer, this.bytes.byteOffset + this.offset, count);
+    this.offset += count;
+    return count === 4 ? view.getFloat32(0) : view.getFloat64(0);
+  }
+
+  string(length) {
+    let result = utf8Decode(this.bytes, this.offset, length);
+    this.offset += length;
+    return result;
+  }
+
+  bin(length) {
+    let result = this.bytes.slice(this.offset, this.offset + length);
+    this.offset += length;
+    return result;
+  }
+
+  array(length) {
+    let result = new Array(length);
+    for (let i = 0; i < length; i++) {
+      result[i] = this.value();
+    }
+    return result;
+  }
+
+  map(length) {
+    let result = {};
+    for (let i = 0; i < length; i++) {
+      let key = this.value();
+      result[key] = this.value();
+    }
+    return result;
+  }
+
+  value() {
+    let format = this.byte();
+    if (format < 0x80) {
+      return format; // positive fixint
+    }
+    if (format < 0x90) {
+      return this.map(format & 0x0f);
+    }
+    if (format < 0xa0) {
+      return this.array(format & 0x0f);
+    }
+    if (format < 0xc0) {
+      return this.string(format & 0x1f);
+    }
+    if (format >= 0xe0) {
+      return format - 0x100; // negative fixint
+    }
+    switch (format) {
+      case 0xc0:
+        return null;
+      case 0xc2:
+        return false;
+      case 0xc3:
+        return true;
+      case 0xc4:
+        return this.bin(this.uint(1));
+      case 0xc5:
+        return this.bin(this.uint(2));
+      case 0xc6:
+        return this.bin(this.uint(4));
+      case 0xca:
+        return this.float(4);
+      case 0xcb:
+        return this.float(8);
+      case 0xcc:
+        return this.uint(1);
+      case 0xcd:
+        return this.uint(2);
+      case 0xce:
+        return this.uint(4);
+      case 0xcf:
+        return this.uint(8);
+      case 0xd0:
+        return this.int(1);
+      case 0xd1:
+        return this.int(2);
+      case 0xd2:
+        return this.int(4);
+      case 0xd3:
+        return this.int(8);
+      case 0xd9:
+        return this.string(this.uint(1));
+      case 0xda:
+        return this.string(this.uint(2));
+      case 0xdb:
+        return this.string(this.uint(4));
+      case 0xdc:
+        return this.array(this.uint(2));
+      case 0xdd:
+        return this.array(this.uint(4));
+      case 0xde:
+        return this.map(this.uint(2));
+      case 0xdf:
+        return this.map(this.uint(4));
+      default:
+        throw new Error("Unsupported MessagePack format 0x" + format.toString(16));
+    }
+  }
+}
+
+export function encode(value) {
+  let writer = new Writer();
+  encodeValue(writer, value);
+  return writer.result();
+}
+
+export function decode(bytes) {
+  return new Reader(bytes).value();
+}
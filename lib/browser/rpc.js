@@ -19,6 +19,7 @@
 import { EJSON, ObjectId, Decimal128 } from "bson";
 
 import * as base64 from "./base64";
+import * as msgpack from "./msgpack";
 import { keys, objectTypes } from "./constants";
 import { invalidateCache } from "./cache";
 
@@ -33,6 +34,7 @@ const persistentCallback = Symbol("persistentCallback");
 let XMLHttpRequest = global.originalXMLHttpRequest || global.XMLHttpRequest;
 let sessionHost;
 let sessionId;
+let useBinaryWire = false;
 
 // Check if XMLHttpRequest has been overridden, and get the native one if that's the case.
 if (XMLHttpRequest.__proto__ != global.XMLHttpRequestEventTarget) {
@@ -42,7 +44,10 @@ if (XMLHttpRequest.__proto__ != global.XMLHttpRequestEventTarget) {
   global.XMLHttpRequest = fakeXMLHttpRequest;
 }
 
-registerTypeConverter(objectTypes.DATA, (_, { value }) => base64.decode(value));
+registerTypeConverter(objectTypes.DATA, (_, { value }) =>
+  // The MessagePack wire carries raw bytes; the JSON wire carries base64.
+  typeof value === "string" ? base64.decode(value) : value.slice().buffer,
+);
 registerTypeConverter(objectTypes.DATE, (_, { value }) => new Date(value));
 registerTypeConverter(objectTypes.EJSON, (_, { value }) => EJSON.deserialize(value));
 registerTypeConverter(objectTypes.DICT, deserializeDict);
@@ -69,6 +74,7 @@ function beforeNotify(realm) {
 export function createSession(host, { versions, performFetch }) {
   sessionHost = host;
 
+  useBinaryWire = false;
   sessionId = sendRequest(
     "create_session",
     {
@@ -78,6 +84,16 @@ export function createSession(host, { versions, performFetch }) {
     host,
   );
 
+  // Negotiate the MessagePack wire format; binary payloads then skip
+  // base64-in-JSON. The VS Code debugger transport stays on JSON.
+  if (!global.__debug__) {
+    try {
+      useBinaryWire = sendRequest("msgpack", {}) === true;
+    } catch (e) {
+      useBinaryWire = false;
+    }
+  }
+
   return sessionId;
 }
 
@@ -199,6 +215,27 @@ export function getProperty(realmId, id, name) {
   return deserialize(realmId, result);
 }
 
+// Executes several independent requests in one transport round-trip and
+// returns the raw per-request responses.
+export function batchRequest(requests) {
+  return sendRequest("batch", {
+    requests: requests.map(({ name, args }) => ({ name, args })),
+  });
+}
+
+// Reads several properties of one object in a single round-trip. Failed
+// entries come back as undefined; successful ones are wrapped in { value }
+// so a property that is legitimately undefined stays distinguishable.
+export function getProperties(realmId, id, names) {
+  let results = batchRequest(names.map((name) => ({ name: "get_property", args: { realmId, id, name } })));
+  return results.map((response) => {
+    if (!response || response.error) {
+      return undefined;
+    }
+    return { value: deserialize(realmId, response.result) };
+  });
+}
+
 export function setProperty(realmId, id, name, value) {
   value = serialize(realmId, value);
   sendRequest("set_property", { realmId, id, name, value });
@@ -242,6 +279,9 @@ function serialize(realmId, value) {
   }
 
   if (value instanceof ArrayBuffer || ArrayBuffer.isView(value)) {
+    if (useBinaryWire) {
+      return { type: objectTypes.DATA, value };
+    }
     return { type: objectTypes.DATA, value: base64.encode(value) };
   }
 
@@ -310,6 +350,26 @@ function makeRequest(url, data) {
 
     statusCode = response.statusCode;
     responseText = response.body.toString("utf-8");
+  } else if (useBinaryWire) {
+    let request = new XMLHttpRequest();
+
+    request.open("POST", url, false);
+    // Synchronous XHR cannot use responseType, so response bytes are read
+    // through the user-defined charset trick instead.
+    request.overrideMimeType("text/plain; charset=x-user-defined");
+    request.setRequestHeader("Content-Type", "application/x-msgpack");
+    request.send(msgpack.encode(data));
+
+    statusCode = request.status;
+    responseText = request.responseText;
+
+    if (statusCode == 200) {
+      let bytes = new Uint8Array(responseText.length);
+      for (let i = 0; i < responseText.length; i++) {
+        bytes[i] = responseText.charCodeAt(i) & 0xff;
+      }
+      return msgpack.decode(bytes);
+    }
   } else {
     let body = JSON.stringify(data);
     let request = new XMLHttpRequest();
@@ -328,6 +388,34 @@ function makeRequest(url, data) {
   return JSON.parse(responseText);
 }
 
+function runCallback(realmId, message) {
+  let callback = message.callback;
+  let result, error, stack;
+  try {
+    let thisObject = deserialize(realmId, message.this);
+    let args = deserialize(realmId, message.arguments);
+    const fn = registeredCallbacks[callback];
+    if (fn) {
+      result = serialize(realmId, fn.apply(thisObject, args));
+    } else {
+      error = `Unknown callback id: ${callback}`;
+    }
+  } catch (e) {
+    error = e.message || "" + e;
+    if (e.stack) {
+      stack = JSON.stringify(e.stack);
+    }
+  }
+
+  return {
+    callback,
+    result,
+    error,
+    stack,
+    callback_call_counter: message.callback_call_counter,
+  };
+}
+
 let pollTimeoutId;
 let pollTimeout = 10;
 
@@ -343,11 +431,12 @@ function sendRequest(command, data, host = sessionHost) {
     let url = "http://" + host + "/" + command;
     let response = makeRequest(url, data);
     let callback = response && response.callback;
+    let callbacks = response && response.callbacks;
 
     // Reset the callback poll interval to 10ms every time we either hit a
     // callback or call any other method, and double it each time we poll
     // for callbacks and get nothing until it's over a second.
-    if (callback || command !== "callbacks_poll") {
+    if (callback != null || callbacks || command !== "callbacks_poll") {
       pollTimeout = 10;
     } else if (pollTimeout < 1000) {
       pollTimeout *= 2;
@@ -368,36 +457,19 @@ function sendRequest(command, data, host = sessionHost) {
       throw new Error(error || `Invalid response for "${command}"`);
     }
     if (callback != null) {
-      let result, error, stack;
-      try {
-        let realmId = data.realmId;
-        let thisObject = deserialize(realmId, response.this);
-        let args = deserialize(realmId, response.arguments);
-        const fn = registeredCallbacks[callback];
-        if (fn) {
-          result = serialize(realmId, fn.apply(thisObject, args));
-        } else {
-          error = `Unknown callback id: ${callback}`;
-        }
-      } catch (e) {
-        error = e.message || "" + e;
-        if (e.stack) {
-          stack = JSON.stringify(e.stack);
-        }
-      }
-
       let callbackCommand = "callback_result";
       if (command === "callbacks_poll" || command === "callback_poll_result") {
         callbackCommand = "callback_poll_result";
       }
 
-      return sendRequest(callbackCommand, {
-        callback,
-        result,
-        error,
-        stack,
-        callback_call_counter: response.callback_call_counter,
-      });
+      return sendRequest(callbackCommand, runCallback(data.realmId, response));
+    }
+    if (callbacks) {
+      // A poll reply carries every queued callback at once; they all run in
+      // this one entry and their results go back in a single message, whose
+      // reply carries the next batch.
+      let results = callbacks.map((message) => runCallback(data.realmId, message));
+      return sendRequest("callback_poll_results", { results });
     }
 
     return response.result;
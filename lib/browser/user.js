@@ -48,7 +48,7 @@ export default class User {
   }
 
   get customData() {
-    return EJSON.parse(this._customData);
+    return this._customData;
   }
 }
 
@@ -61,6 +61,8 @@ export function cacheObject(realmId, id, value) {
   getRealmCache(realmId)[id] = value;
 }
 
+const INDEX_PREFETCH_COUNT = 32;
+
 export function getProperty(obj, name, cache = true) {
   let realmId = obj[keys.realm];
   let id = obj[keys.id];
@@ -78,6 +80,35 @@ export function getProperty(obj, name, cache = true) {
   if (name in objCache) {
     return objCache[name];
   }
+
+  // Index reads come in bursts while a collection renders, so fetch a block
+  // of neighbouring elements through one batched request instead of paying
+  // one round-trip per element.
+  if (/^\d+$/.test(String(name))) {
+    const start = Number(name);
+    let end = start + INDEX_PREFETCH_COUNT;
+    if (typeof objCache.length === "number") {
+      end = Math.min(end, objCache.length);
+    }
+    if (end > start + 1) {
+      const names = [];
+      for (let i = start; i < end; i++) {
+        if (!(String(i) in objCache)) {
+          names.push(String(i));
+        }
+      }
+      const fetched = rpc.getProperties(realmId, id, names);
+      fetched.forEach((entry, index) => {
+        if (entry) {
+          objCache[names[index]] = entry.value;
+        }
+      });
+      if (name in objCache) {
+        return objCache[name];
+      }
+    }
+  }
+
   return (objCache[name] = rpc.getProperty(realmId, id, name));
 }
 
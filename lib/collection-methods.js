@@ -52,30 +52,51 @@ module.exports = function (realmConstructor) {
     }
   });
 
+  // Elements are fetched natively in chunks so that iterating a large
+  // collection costs one native call per chunk instead of one per element.
+  const ITERATION_CHUNK_SIZE = 256;
+
   ["entries", "keys", "values"].forEach(function (methodName) {
     var method = function () {
       const isSet = this instanceof realmConstructor.Set;
       var self = this.type === "object" || isSet ? this.snapshot() : this;
       var index = 0;
 
+      // "keys" never reads elements, so it skips chunking.
+      const canChunk = typeof self.toValues === "function" && methodName !== "keys";
+      var chunk = null;
+      var chunkStart = 0;
+
       return Object.create(iteratorPrototype, {
         next: {
           value: function () {
             if (!self || index >= self.length) {
               self = null;
+              chunk = null;
               return { done: true, value: undefined };
             }
 
+            var element;
+            if (canChunk) {
+              if (!chunk || index >= chunkStart + chunk.length) {
+                chunkStart = index;
+                chunk = self.toValues(index, Math.min(index + ITERATION_CHUNK_SIZE, self.length));
+              }
+              element = chunk[index - chunkStart];
+            } else if (methodName !== "keys") {
+              element = self[index];
+            }
+
             var value;
             switch (methodName) {
               case "entries":
-                value = isSet ? [self[index], self[index]] : [index, self[index]];
+                value = isSet ? [element, element] : [index, element];
                 break;
               case "keys":
                 value = isSet ? undefined : index;
                 break;
               default:
-                value = self[index];
+                value = element;
                 break;
             }
 
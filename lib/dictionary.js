@@ -27,13 +27,21 @@ const dictionaryHandler = {
 
     if (key === "toJSON") {
       return function () {
-        const keys = target._keys();
+        // Fetch all pairs in one native call instead of one getter per key.
+        const { keys, values } = target._entries();
         let obj = {};
-        keys.forEach((key) => (obj[key] = target.getter(key)));
+        keys.forEach((key, index) => (obj[key] = values[index]));
         return obj;
       };
     }
 
+    if (key === "entries") {
+      return function () {
+        const { keys, values } = target._entries();
+        return keys.map((key, index) => [key, values[index]]);
+      };
+    }
+
     if (typeof target[key] === "function") {
       return function () {
         return target[key].apply(target, arguments);
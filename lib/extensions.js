@@ -161,6 +161,44 @@ module.exports = function (realmConstructor) {
     enumerable: false,
   });
 
+  // Promise wrappers over the callback-style native async file operations.
+  // In the legacy Chrome debugger the native methods are not available, so
+  // fall back to the synchronous forms wrapped in a resolved promise.
+  Object.defineProperties(
+    realmConstructor.prototype,
+    getOwnPropertyDescriptors({
+      compactAsync() {
+        if (!this._compactAsync) {
+          return Promise.resolve(this.compact());
+        }
+        return new Promise((resolve, reject) => {
+          this._compactAsync((error, didCompact) => {
+            if (error) {
+              reject(error);
+            } else {
+              resolve(didCompact);
+            }
+          });
+        });
+      },
+      writeCopyToAsync(config, onProgress) {
+        if (!this._writeCopyToAsync) {
+          this.writeCopyTo(config);
+          return Promise.resolve();
+        }
+        return new Promise((resolve, reject) => {
+          this._writeCopyToAsync(config, onProgress || null, (error) => {
+            if (error) {
+              reject(error);
+            } else {
+              resolve();
+            }
+          });
+        });
+      },
+    }),
+  );
+
   //Add static methods to the Realm object
   Object.defineProperties(
     realmConstructor,
@@ -317,6 +355,42 @@ module.exports = function (realmConstructor) {
         return openPromise;
       },
 
+      // Promise wrappers over the callback-style native async file
+      // operations, mirroring compactAsync/writeCopyToAsync above. In the
+      // legacy Chrome debugger the native methods are not available, so fall
+      // back to the synchronous forms wrapped in a resolved promise.
+      deleteFileAsync(config) {
+        if (!realmConstructor._deleteFileAsync) {
+          realmConstructor.deleteFile(config);
+          return Promise.resolve();
+        }
+        return new Promise((resolve, reject) => {
+          realmConstructor._deleteFileAsync(config, (error) => {
+            if (error) {
+              reject(error);
+            } else {
+              resolve();
+            }
+          });
+        });
+      },
+
+      copyBundledRealmFilesAsync() {
+        if (!realmConstructor._copyBundledRealmFilesAsync) {
+          realmConstructor.copyBundledRealmFiles();
+          return Promise.resolve();
+        }
+        return new Promise((resolve, reject) => {
+          realmConstructor._copyBundledRealmFilesAsync((error) => {
+            if (error) {
+              reject(error);
+            } else {
+              resolve();
+            }
+          });
+        });
+      },
+
       createTemplateObject(objectSchema) {
         let obj = {};
         for (let key in objectSchema.properties) {
@@ -26,6 +26,13 @@ const instanceMethods = {
   update(updateFn) {
     return promisify((cb) => this._update(updateFn, cb));
   },
+
+  updateBatch(descriptors) {
+    let added;
+    return promisify((cb) => {
+      added = this._updateBatch(descriptors, cb);
+    }).then(() => added);
+  },
 };
 
 const staticMethods = {
@@ -16,8 +16,6 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
-const { EJSON } = require("bson");
-
 const { MongoDBCollection } = require("./mongo-client");
 const { cleanArguments, promisify } = require("./utils");
 
@@ -30,11 +28,10 @@ const instanceMethods = {
     return promisify((cb) => this._logOut(cb));
   },
 
-  async callFunction(name, args = [], service = undefined) {
+  callFunction(name, args = [], service = undefined) {
+    // Arguments and result are converted natively; no EJSON string round-trip.
     const cleanedArgs = cleanArguments(args);
-    const stringifiedArgs = EJSON.stringify(cleanedArgs, { relaxed: false });
-    const result = await promisify((cb) => this._callFunction(name, stringifiedArgs, service, cb));
-    return EJSON.parse(result);
+    return promisify((cb) => this._callFunction(name, cleanedArgs, service, cb));
   },
 
   async refreshCustomData() {
@@ -94,7 +91,7 @@ const instanceMethods = {
   },
 
   get customData() {
-    return EJSON.parse(this._customData);
+    return this._customData;
   },
 
   // Internal helpers.
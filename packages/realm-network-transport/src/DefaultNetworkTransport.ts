@@ -48,7 +48,12 @@ export class DefaultNetworkTransport implements NetworkTransport {
     // tslint:disable-next-line: no-console
     this.fetch(request)
       .then(async (response) => {
-        const decodedBody = await response.text();
+        // Prefer handing the body over as an ArrayBuffer: the native handler
+        // reads it directly, avoiding the string decode/encode round-trip that
+        // response.text() costs on large responses. Fall back to text on fetch
+        // implementations without ArrayBuffer support.
+        const decodedBody =
+          typeof response.arrayBuffer === "function" ? await response.arrayBuffer() : await response.text();
         // Pull out the headers of the response
         const responseHeaders: Headers = {};
         response.headers.forEach((value, key) => {
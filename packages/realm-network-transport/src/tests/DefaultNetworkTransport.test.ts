@@ -115,6 +115,10 @@ describe("DefaultNetworkTransport", () => {
       });
     }
 
+    function decodeBody(body: string | ArrayBuffer) {
+      return typeof body === "string" ? body : Buffer.from(body).toString("utf8");
+    }
+
     it("sends and receives GET requests", async () => {
       const transport = new DefaultNetworkTransport();
       const server = await createTestServer((req, res) => {
@@ -135,7 +139,7 @@ describe("DefaultNetworkTransport", () => {
           },
         });
         expect(response.statusCode).equals(200);
-        const decodedBody = JSON.parse(response.body);
+        const decodedBody = JSON.parse(decodeBody(response.body));
         expect(decodedBody).deep.equals({
           pong: "Hi GET request",
         });
@@ -172,7 +176,7 @@ describe("DefaultNetworkTransport", () => {
             "content-type": "application/json",
           },
         });
-        const decodedBody = JSON.parse(response.body);
+        const decodedBody = JSON.parse(decodeBody(response.body));
         expect(decodedBody).deep.equals({ pong: "Hello World" });
       } finally {
         server.close();
@@ -29,7 +29,7 @@ export interface Request<RequestBody = unknown> extends FetchRequestInit<Request
 export interface CallbackResponse {
   statusCode: number;
   headers: Headers;
-  body: string;
+  body: string | ArrayBuffer;
 }
 
 export type SuccessCallback = (response: CallbackResponse) => void;
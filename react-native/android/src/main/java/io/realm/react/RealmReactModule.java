@@ -22,6 +22,7 @@ import android.os.Handler;
 import android.os.HandlerThread;
 import android.util.Log;
 
+import com.facebook.react.bridge.JavaScriptContextHolder;
 import com.facebook.react.bridge.ReactApplicationContext;
 import com.facebook.react.bridge.ReactContextBaseJavaModule;
 import com.facebook.react.turbomodule.core.CallInvokerHolderImpl;
@@ -90,6 +91,18 @@ class RealmReactModule extends ReactContextBaseJavaModule {
         // See RealmReact.mm's setBridge method for details, this is the equivalent for Android.
         CallInvokerHolderImpl jsCallInvokerHolder = (CallInvokerHolderImpl) getReactApplicationContext().getCatalystInstance().getJSCallInvokerHolder();
         setupFlushUiQueue(jsCallInvokerHolder);
+
+        // Install the Realm API into the JavaScript runtime through JSI. Calls made
+        // through these bindings are synchronous and cross no serialization layer.
+        // When JS runs remotely (legacy Chrome debugging) there is no local runtime
+        // to install into, so the context pointer is 0 and we keep falling back to
+        // the RPC web server; on-device debugging needs no such fallback.
+        JavaScriptContextHolder jsContext = getReactApplicationContext().getJavaScriptContextHolder();
+        synchronized (jsContext) {
+            if (jsContext.get() != 0) {
+                installJsiBindings(jsContext.get());
+            }
+        }
     }
 
     @Override
@@ -277,6 +290,9 @@ class RealmReactModule extends ReactContextBaseJavaModule {
     // this receives one command from Chrome debug then return the processing we should post back
     private native boolean tryRunTask();
 
+    // installs the Realm API into the runtime pointed to by runtimePointer via JSI
+    private native void installJsiBindings(long runtimePointer);
+
     // Passes the React Native jsCallInvokerHolder over to C++ so we can setup our UI queue flushing
     private native void setupFlushUiQueue(CallInvokerHolderImpl callInvoker);
 }
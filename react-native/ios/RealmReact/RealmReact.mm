@@ -220,6 +220,9 @@ RCT_REMAP_METHOD(emit, emitEvent:(NSString *)eventName withObject:(id)object) {
     [GCDWebServer setLogLevel:3];
     _webServer = [[GCDWebServer alloc] init];
     _rpcServer = std::make_unique<RPCServer>();
+    // GCDWebServer hands us raw request bodies, so the MessagePack wire can
+    // be offered to clients that ask for it.
+    _rpcServer->enable_binary_wire_support();
     __weak __typeof__(self) weakSelf = self;
 
     // Add a handler to respond to POST requests on any URL
@@ -232,19 +235,30 @@ RCT_REMAP_METHOD(emit, emitEvent:(NSString *)eventName withObject:(id)object) {
 
         try {
             NSData *responseData;
+            BOOL isMsgpack = [request.contentType isEqualToString:@"application/x-msgpack"];
 
             if (rpcServer) {
-                std::string args = [[(GCDWebServerDataRequest *)request text] UTF8String];
-                std::string responseText = rpcServer->perform_request(request.path.UTF8String, args);
+                if (isMsgpack) {
+                    NSData *requestData = [(GCDWebServerDataRequest *)request data];
+                    std::vector<uint8_t> responseBytes = rpcServer->perform_request_msgpack(
+                        request.path.UTF8String, static_cast<const uint8_t *>(requestData.bytes), requestData.length);
 
-                responseData = [NSData dataWithBytes:responseText.c_str() length:responseText.length()];
+                    responseData = [NSData dataWithBytes:responseBytes.data() length:responseBytes.size()];
+                }
+                else {
+                    std::string args = [[(GCDWebServerDataRequest *)request text] UTF8String];
+                    std::string responseText = rpcServer->perform_request(request.path.UTF8String, args);
+
+                    responseData = [NSData dataWithBytes:responseText.c_str() length:responseText.length()];
+                }
             }
             else {
                 // we have been deallocated
                 responseData = [NSData data];
             }
 
-            response = [[GCDWebServerDataResponse alloc] initWithData:responseData contentType:@"application/json"];
+            response = [[GCDWebServerDataResponse alloc] initWithData:responseData
+                                                          contentType:isMsgpack ? @"application/x-msgpack" : @"application/json"];
         }
         catch(std::exception &ex) {
             NSLog(@"Invalid RPC request - %@", [(GCDWebServerDataRequest *)request text]);
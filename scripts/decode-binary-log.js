@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+// Offline decoder for the binary log ring written by
+// Realm.App.Sync.enableBinaryLogging (see BinaryLogSink in src/logger.hpp
+// for the file format). Prints the ring's records in chronological order as
+// text lines, substituting the two captured scalar args back into the
+// interned message template.
+//
+// Usage: node scripts/decode-binary-log.js <ring-file>
+// The <ring-file>.strings side file must sit next to the ring.
+
+const fs = require("node:fs");
+
+const HEADER_SIZE = 64;
+const RECORD_SIZE = 32;
+const MAGIC = "RJBL";
+
+// realm::util::Logger::Level and realm::common::logger::LogCategory values.
+const LEVELS = ["all", "trace", "debug", "detail", "info", "warn", "error", "fatal", "off"];
+const CATEGORIES = { 1: "connection", 2: "session", 4: "changeset", 8: "other" };
+
+function loadTemplates(stringsPath) {
+  const templates = new Map();
+  for (const line of fs.readFileSync(stringsPath, "utf8").split("\n")) {
+    const tab = line.indexOf("\t");
+    if (tab < 0) {
+      continue;
+    }
+    templates.set(Number(line.slice(0, tab)), line.slice(tab + 1));
+  }
+  return templates;
+}
+
+function formatMessage(template, arg0, arg1) {
+  // The record keeps only the line's first two scalars; any further `#`
+  // placeholders stay as-is.
+  let substituted = 0;
+  return template.replace(/#/g, () => {
+    substituted++;
+    if (substituted === 1) return arg0.toString();
+    if (substituted === 2) return arg1.toString();
+    return "#";
+  });
+}
+
+function decode(ringPath) {
+  const buffer = fs.readFileSync(ringPath);
+  if (buffer.length < HEADER_SIZE || buffer.toString("latin1", 0, 4) !== MAGIC) {
+    throw new Error(`${ringPath} is not a realm binary log ring`);
+  }
+  const version = buffer.readUInt32LE(4);
+  if (version !== 1) {
+    throw new Error(`Unsupported format version ${version}`);
+  }
+  const capacity = buffer.readBigUInt64LE(8);
+  const cursor = buffer.readBigUInt64LE(16);
+  const templates = loadTemplates(ringPath + ".strings");
+
+  // The oldest record is at the cursor once the ring has wrapped.
+  const count = cursor < capacity ? cursor : capacity;
+  const first = cursor < capacity ? 0n : cursor % capacity;
+
+  for (let i = 0n; i < count; i++) {
+    const offset = HEADER_SIZE + Number((first + i) % capacity) * RECORD_SIZE;
+    const timestampNs = buffer.readBigUInt64LE(offset);
+    const arg0 = buffer.readBigUInt64LE(offset + 8);
+    const arg1 = buffer.readBigUInt64LE(offset + 16);
+    const templateId = buffer.readUInt32LE(offset + 24);
+    const level = buffer.readUInt8(offset + 28);
+    const category = buffer.readUInt8(offset + 29);
+
+    const template = templates.get(templateId);
+    if (template === undefined) {
+      // A record torn by a crash mid-write; skip it.
+      continue;
+    }
+    const timestamp = new Date(Number(timestampNs / 1000000n)).toISOString();
+    const levelName = LEVELS[level] || `level${level}`;
+    const categoryName = CATEGORIES[category] || `category${category}`;
+    console.log(`${timestamp} [${levelName}] [${categoryName}] ${formatMessage(template, arg0, arg1)}`);
+  }
+}
+
+if (process.argv.length !== 3) {
+  console.error("Usage: node scripts/decode-binary-log.js <ring-file>");
+  process.exit(1);
+}
+decode(process.argv[2]);
@@ -32,6 +32,20 @@
 using namespace realm::rpc;
 using namespace realm::jni_util;
 
+namespace facebook {
+namespace jsi {
+class Runtime;
+}
+} // namespace facebook
+
+namespace realm {
+namespace hermes {
+// Defined in hermes_init.cpp; forward-declared here so this JNI translation
+// unit does not need the JSI headers or the full binding templates.
+void install(facebook::jsi::Runtime&);
+} // namespace hermes
+} // namespace realm
+
 static RPCServer* s_rpc_server;
 extern bool realmContextInjected;
 jclass ssl_helper_class;
@@ -137,6 +151,22 @@ JNIEXPORT void JNICALL Java_io_realm_react_RealmReactModule_clearContextInjected
     realmContextInjected = false;
 }
 
+// Install the Realm constructor directly into the JavaScript runtime through JSI.
+// Unlike the jsc_override injection or the Chrome-debug RPC path, every native
+// call made this way is synchronous and crosses no serialization layer; the
+// runtime pointer comes from the catalyst instance's JavaScriptContextHolder.
+JNIEXPORT void JNICALL Java_io_realm_react_RealmReactModule_installJsiBindings(JNIEnv*, jobject,
+                                                                               jlong runtimePointer)
+{
+    __android_log_print(ANDROID_LOG_VERBOSE, "JSRealm", "installJsiBindings");
+    auto& runtime = *reinterpret_cast<facebook::jsi::Runtime*>(runtimePointer);
+    realm::hermes::install(runtime);
+    // The constructor now lives inside the app's own runtime, so the module
+    // behaves exactly as if the context had been injected: no web server and
+    // no RPC. Debugging happens on-device through the runtime's inspector.
+    realmContextInjected = true;
+}
+
 // Setup the flush_ui_queue function we use to flush the React Native UI queue whenever we call from C++ to JS.
 // See RealmReact.mm's setBridge method for details, this is the equivalent for Android.
 JNIEXPORT void JNICALL Java_io_realm_react_RealmReactModule_setupFlushUiQueue(JNIEnv* env, jobject,
@@ -53,6 +53,13 @@ JNIEXPORT jstring JNICALL Java_io_realm_react_RealmReactModule_processChromeDebu
  */
 JNIEXPORT jboolean JNICALL Java_io_realm_react_RealmReactModule_tryRunTask(JNIEnv*, jobject);
 
+/*
+ * Class:     io_realm_react_RealmReactModule
+ * Method:    installJsiBindings
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_io_realm_react_RealmReactModule_installJsiBindings(JNIEnv*, jobject, jlong);
+
 /*
  * Class:     io_realm_react_RealmReactModule
  * Method:    setupFlushUiQueue
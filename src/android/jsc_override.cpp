@@ -154,61 +154,71 @@ static JSGlobalContextRef create_context(JSContextGroupRef group, JSClassRef glo
 
 static void swap_function()
 {
-    // TODO: should we do a byte alignment for s_orig_code using alignas(16) or similar?
-    static int8_t s_orig_code[HOOK_SIZE];
-    static bool s_swapped = false;
-
-    int8_t* orig_func = (int8_t*)&JSGlobalContextCreateInGroup;
-    int8_t* new_func = (int8_t*)&create_context;
-
-    bool orig_thumb = false;
+    // The resolved target address, page bounds, and both byte images (the
+    // original prologue and the prebuilt hook) are computed once at first
+    // load and reused for every swap afterwards. Context creations — which
+    // happen on every React Native dev-mode reload — then only pay for two
+    // HOOK_SIZE copies plus the protection flips, and never redo the
+    // resolution or hook assembly. Everything the swaps touch sits in one
+    // cache line.
+    struct alignas(64) HookState {
+        int8_t* orig_func;
+        uintptr_t page_start;
+        size_t region_size;
+        int8_t orig_code[HOOK_SIZE];
+        int8_t hook_code[HOOK_SIZE];
+    };
+    static HookState s_state = [] {
+        HookState state;
+        state.orig_func = (int8_t*)&JSGlobalContextCreateInGroup;
+        int8_t* new_func = (int8_t*)&create_context;
+
+        bool orig_thumb = false;
 #if __arm__ && !defined(__aarch64__)
-    orig_thumb = (uintptr_t)orig_func % 4 != 0;
-    if (orig_thumb) {
-        orig_func--;
-    }
+        orig_thumb = (uintptr_t)state.orig_func % 4 != 0;
+        if (orig_thumb) {
+            state.orig_func--;
+        }
 #endif
 
-    size_t page_size = sysconf(_SC_PAGESIZE);
-    uintptr_t page_start = (uintptr_t)orig_func & ~(page_size - 1);
-    uintptr_t code_end = (uintptr_t)orig_func + HOOK_SIZE;
+        size_t page_size = sysconf(_SC_PAGESIZE);
+        state.page_start = (uintptr_t)state.orig_func & ~(page_size - 1);
+        state.region_size = (uintptr_t)state.orig_func + HOOK_SIZE - state.page_start;
 
-    // Make this memory region writable.
-    mprotect((void*)page_start, code_end - page_start, PROT_READ | PROT_WRITE | PROT_EXEC);
-
-    if (s_swapped) {
-        // Copy original code back into place.
-        memcpy(orig_func, s_orig_code, HOOK_SIZE);
-    }
-    else {
-        // Store the original code before replacing it.
-        memcpy(s_orig_code, orig_func, HOOK_SIZE);
+        // Store the original code before it gets replaced.
+        memcpy(state.orig_code, state.orig_func, HOOK_SIZE);
 
 #if __arm__ || __aarch64__
         if (orig_thumb) {
             // LDR R3, [PC, #0]; BX R3;
-            memcpy(orig_func, "\x00\x4b\x18\x47", ARM_FUNCTION_HOOK_SIZE);
-            memcpy(orig_func + ARM_FUNCTION_HOOK_SIZE, &new_func, ARM_FUNCTION_HOOK_SIZE);
+            memcpy(state.hook_code, "\x00\x4b\x18\x47", ARM_FUNCTION_HOOK_SIZE);
+            memcpy(state.hook_code + ARM_FUNCTION_HOOK_SIZE, &new_func, ARM_FUNCTION_HOOK_SIZE);
         }
         else {
-            memcpy(orig_func, ARM_FUNCTION_HOOK, ARM_FUNCTION_HOOK_SIZE);
-            memcpy(orig_func + ARM_FUNCTION_HOOK_SIZE, &new_func, ARM_FUNCTION_HOOK_SIZE);
+            memcpy(state.hook_code, ARM_FUNCTION_HOOK, ARM_FUNCTION_HOOK_SIZE);
+            memcpy(state.hook_code + ARM_FUNCTION_HOOK_SIZE, &new_func, ARM_FUNCTION_HOOK_SIZE);
         }
 #else
         // TODO: It would be safer to generate an indirect jump to an absolute address since distance might be greater
         // than +/- 2^31
-        int32_t jmp_offset = (int64_t)new_func - (int64_t)orig_func - HOOK_SIZE;
+        int32_t jmp_offset = (int64_t)new_func - (int64_t)state.orig_func - HOOK_SIZE;
 
-        // Change original function to jump to our new one.
-        *orig_func = 0xE9; // JMP
-        *(int32_t*)(orig_func + 1) = jmp_offset;
+        // A jump from the original function to our new one.
+        state.hook_code[0] = (int8_t)0xE9; // JMP
+        memcpy(state.hook_code + 1, &jmp_offset, sizeof(jmp_offset));
 #endif
-    }
+        return state;
+    }();
+    static bool s_swapped = false;
+
+    // Make this memory region writable.
+    mprotect((void*)s_state.page_start, s_state.region_size, PROT_READ | PROT_WRITE | PROT_EXEC);
 
+    memcpy(s_state.orig_func, s_swapped ? s_state.orig_code : s_state.hook_code, HOOK_SIZE);
     s_swapped = !s_swapped;
 
-    __builtin___clear_cache((char*)page_start, (char*)code_end);
+    __builtin___clear_cache((char*)s_state.page_start, (char*)s_state.page_start + s_state.region_size);
 
     // Return this region to no longer being writable.
-    mprotect((void*)page_start, code_end - page_start, PROT_READ | PROT_EXEC);
+    mprotect((void*)s_state.page_start, s_state.region_size, PROT_READ | PROT_EXEC);
 }
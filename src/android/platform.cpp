@@ -17,9 +17,12 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #include <string>
+#include <memory>
 #include <stdlib.h>
 #include <stdarg.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/sendfile.h>
 #include <cstdio>
 #include <android/asset_manager.h>
 #include <android/log.h>
@@ -65,23 +68,60 @@ void copy_bundled_realm_files()
     const char* filename = nullptr;
 
     while ((filename = AAssetDir_getNextFileName(assetDir)) != nullptr) {
-        if (is_realm_file(filename)) {
-            AAsset* asset = AAssetManager_open(s_asset_manager, filename, AASSET_MODE_STREAMING);
+        if (!is_realm_file(filename)) {
+            continue;
+        }
 
-            char buf[BUFSIZ];
-            int nb_read = 0;
+        auto dest_filename = s_default_realm_directory + '/' + filename;
+        if (access(dest_filename.c_str(), F_OK) != -1) {
+            continue;
+        }
 
-            auto dest_filename = s_default_realm_directory + '/' + filename;
-            if (access(dest_filename.c_str(), F_OK) == -1) {
-                // file doesn't exist, copy
-                FILE* out = fopen(dest_filename.c_str(), "w");
-                while ((nb_read = AAsset_read(asset, buf, BUFSIZ)) > 0) {
-                    fwrite(buf, nb_read, 1, out);
+        AAsset* asset = AAssetManager_open(s_asset_manager, filename, AASSET_MODE_STREAMING);
+
+        // Assets stored uncompressed in the APK expose a file descriptor;
+        // sendfile then copies from the APK to the destination entirely in
+        // the kernel, with no userspace buffer in between. This is the
+        // common case for bundled Realms, which aapt leaves uncompressed.
+        off_t start = 0;
+        off_t length = 0;
+        int asset_fd = AAsset_openFileDescriptor(asset, &start, &length);
+        if (asset_fd >= 0) {
+            int out = open(dest_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+            if (out != -1) {
+                off_t offset = start;
+                off_t remaining = length;
+                while (remaining > 0) {
+                    ssize_t sent = sendfile(out, asset_fd, &offset, remaining);
+                    if (sent <= 0) {
+                        break;
+                    }
+                    remaining -= sent;
+                }
+                close(out);
+                if (remaining > 0) {
+                    // Partial copy — remove it so the next call retries cleanly.
+                    unlink(dest_filename.c_str());
+                }
+            }
+            close(asset_fd);
+        }
+        else {
+            // Compressed asset: stream-decompress through a heap buffer.
+            // BUFSIZ is as small as 1KB on Bionic, which made the old loop
+            // syscall-bound; 64KB keeps the decompressor fed.
+            constexpr size_t buffer_size = 64 * 1024;
+            auto buf = std::make_unique<char[]>(buffer_size);
+            int nb_read = 0;
+            FILE* out = fopen(dest_filename.c_str(), "w");
+            if (out) {
+                while ((nb_read = AAsset_read(asset, buf.get(), buffer_size)) > 0) {
+                    fwrite(buf.get(), nb_read, 1, out);
                 }
                 fclose(out);
             }
-            AAsset_close(asset);
         }
+        AAsset_close(asset);
     }
     AAssetDir_close(assetDir);
 }
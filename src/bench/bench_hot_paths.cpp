@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+// Micro-benchmarks for the binding's engine-independent hot paths. Paths that
+// need a live JS runtime (NativeAccessor boxing/unboxing, WrappedObject
+// instance creation, collection iteration) are covered by the JS-side
+// performance tests run under Node; this target exists to catch regressions
+// in the pure native conversion and parsing code per commit.
+//
+// Build with -DREALM_JS_ENABLE_BENCHMARKS=ON (requires Google Benchmark).
+
+#include <benchmark/benchmark.h>
+
+#include <realm/index_set.hpp>
+#include <realm/object-store/object_schema.hpp>
+#include <realm/object-store/object_store.hpp>
+#include <realm/object-store/property.hpp>
+#include <realm/object-store/results.hpp>
+#include <realm/object-store/shared_realm.hpp>
+
+#include "js_schema.hpp"
+
+using namespace realm;
+
+// Schema property-type parsing: runs for every property of every class on
+// each Realm.open.
+static void BM_ParsePropertyType(benchmark::State& state)
+{
+    static const char* type_strings[] = {"bool",   "int",     "double",  "string",    "date",
+                                         "data",   "mixed",   "uuid",    "decimal128", "objectId",
+                                         "int[]",  "string?", "float<>", "mixed{}",   "int?[]"};
+    for (auto _ : state) {
+        for (const char* type : type_strings) {
+            Property prop;
+            prop.name = "prop";
+            js::parse_property_type("BenchObject", prop, type);
+            benchmark::DoNotOptimize(prop);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(type_strings));
+}
+BENCHMARK(BM_ParsePropertyType);
+
+// Change-set index conversion: mirrors what the notification path does per
+// delivered change set before handing indices to JS.
+static void BM_IndexSetToUint32Vector(benchmark::State& state)
+{
+    IndexSet index_set;
+    for (size_t i = 0; i < size_t(state.range(0)); ++i) {
+        index_set.add(i * 2); // alternating gaps, the common sync-integration shape
+    }
+    std::vector<uint32_t> scratch;
+    for (auto _ : state) {
+        scratch.clear();
+        scratch.reserve(index_set.count());
+        for (auto index : index_set.as_indexes()) {
+            scratch.push_back(static_cast<uint32_t>(index));
+        }
+        benchmark::DoNotOptimize(scratch.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IndexSetToUint32Vector)->Range(64, 65536);
+
+// Property lookup by name on a fixed schema: every property read and write
+// resolves names against the ObjectSchema.
+static void BM_ObjectSchemaPropertyLookup(benchmark::State& state)
+{
+    ObjectSchema schema;
+    schema.name = "BenchObject";
+    for (int i = 0; i < 16; ++i) {
+        Property prop;
+        prop.name = "property_" + std::to_string(i);
+        prop.type = PropertyType::Int;
+        schema.persisted_properties.push_back(prop);
+    }
+    for (auto _ : state) {
+        for (auto& prop : schema.persisted_properties) {
+            benchmark::DoNotOptimize(schema.property_for_name(prop.name));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+BENCHMARK(BM_ObjectSchemaPropertyLookup);
+
+// Representative open/write/refresh cycle, primarily here as the PGO training
+// scenario: it drives Realm open, write transactions, transaction-advance
+// bookkeeping and query re-evaluation — the spine every JS API call runs
+// through. Notification delivery itself needs an event-loop scheduler and is
+// covered by the JS-side performance tests.
+static void BM_OpenWriteRefresh(benchmark::State& state)
+{
+    Realm::Config config;
+    config.path = "realm-js-bench.realm";
+    config.in_memory = true;
+    config.schema_version = 0;
+    config.schema = Schema{
+        {"BenchObject",
+         {
+             {"value", PropertyType::Int},
+             {"name", PropertyType::String},
+         }},
+    };
+
+    for (auto _ : state) {
+        auto realm = Realm::get_shared_realm(config);
+        auto table = ObjectStore::table_for_object_type(realm->read_group(), "BenchObject");
+        auto col_value = table->get_column_key("value");
+        auto col_name = table->get_column_key("name");
+        for (int batch = 0; batch < 8; batch++) {
+            realm->begin_transaction();
+            for (int i = 0; i < 64; i++) {
+                auto obj = table->create_object();
+                obj.set(col_value, batch * 64 + i);
+                obj.set(col_name, StringData("bench"));
+            }
+            realm->commit_transaction();
+            realm->refresh();
+        }
+        Results results(realm, table->where().greater(col_value, 128));
+        benchmark::DoNotOptimize(results.size());
+        realm->close();
+    }
+    state.SetItemsProcessed(state.iterations() * 8 * 64);
+}
+BENCHMARK(BM_OpenWriteRefresh)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
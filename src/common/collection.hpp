@@ -21,4 +21,27 @@ struct IOCollection {
     virtual realm::Mixed get(std::string) = 0;
     virtual void remove(std::string) = 0;
     virtual bool contains(std::string) = 0;
-};
\ No newline at end of file
+
+    /*
+     * Bulk element access: one virtual dispatch moves N elements, so callers
+     * syncing many keys at once (dictionary merges, full-object rebuilds) do
+     * not pay a virtual call per element. The defaults fall back to the
+     * scalar operations; implementations backed by a core collection should
+     * override them to resolve the collection once and walk it directly.
+     */
+    virtual void get_range(const std::vector<std::string>& keys, std::vector<realm::Mixed>& out)
+    {
+        out.clear();
+        out.reserve(keys.size());
+        for (auto const& key : keys) {
+            out.push_back(get(key));
+        }
+    }
+
+    virtual void set_range(const std::vector<std::pair<std::string, realm::Mixed>>& values)
+    {
+        for (auto const& entry : values) {
+            set(entry.first, entry.second);
+        }
+    }
+};
@@ -20,6 +20,7 @@
 
 #include "object/interfaces.hpp"
 #include "object/strategies.hpp"
+#include "small_vector.hpp"
 
 namespace realm {
 namespace js {
@@ -38,7 +39,9 @@ private:
 
     std::unique_ptr<Builder> builder;
     std::unique_ptr<Collection> collection;
-    std::vector<std::unique_ptr<Subscriber>> subscribers;
+    // Inline capacity of two covers the typical listener count without a
+    // heap allocation per object.
+    common::SmallVector<std::unique_ptr<Subscriber>, 2> subscribers;
     common::JavascriptObject<GetterSetters> javascript_object;
 
 public:
@@ -101,8 +104,11 @@ public:
     void notify_subscribers(collection::Notification notification)
     {
         HANDLESCOPE(context)
+        // The change set is boxed at most once per event; every subscriber
+        // shares the carrier instead of re-converting it per listener.
+        BoxedChangeSet boxed_change_set{notification.change_set, {}};
         for (auto& subscriber : subscribers) {
-            subscriber->notify(javascript_object.get(), notification.change_set);
+            subscriber->notify(javascript_object.get(), boxed_change_set);
         }
     }
 
@@ -116,6 +122,7 @@ public:
         // We basically ignore any update if the object has been disposed.
         if (javascript_object.is_alive()) {
             builder->add_accessors(javascript_object, collection->data());
+            javascript_object.flush_pending();
             builder->remove_accessors(javascript_object, collection.get());
         }
     }
@@ -124,6 +131,7 @@ public:
     {
         builder->template add_methods<VM>(javascript_object);
         builder->add_accessors(javascript_object, collection->data());
+        javascript_object.flush_pending();
 
         javascript_object.set_collection(collection.get());
         javascript_object.set_observer(this);
@@ -52,10 +52,11 @@ private:
 
     static std::string to_string(JSContextRef context, JSStringRef value)
     {
-        std::string str;
         size_t sizeUTF8 = JSStringGetMaximumUTF8CStringSize(value);
-        str.reserve(sizeUTF8);
-        JSStringGetUTF8CString(value, str.data(), sizeUTF8);
+        std::string str(sizeUTF8, '\0');
+        size_t written = JSStringGetUTF8CString(value, str.data(), sizeUTF8);
+        // written includes the null terminator.
+        str.resize(written > 0 ? written - 1 : 0);
         return str;
     }
 
@@ -88,15 +89,18 @@ private:
         }
     }
 
-    static bool contains_key(JSContextRef ctx, JSObjectRef object, std::string key)
+    static bool contains_key(JSContextRef ctx, JSObjectRef object, const std::string& key)
     {
-        auto keys = get_private(object)->keys;
-        return keys[key.c_str()] == true;
+        // By reference: this runs per property access, and copying the whole
+        // key map per get/set dwarfed the lookup itself.
+        auto& keys = get_private(object)->keys;
+        auto it = keys.find(key);
+        return it != keys.end() && it->second;
     }
 
     static void get_property_names(JSContextRef ctx, JSObjectRef object, JSPropertyNameAccumulatorRef propertyNames)
     {
-        auto keys = get_private(object)->keys;
+        auto& keys = get_private(object)->keys;
         for (const auto& pair : keys) {
             if (pair.second) {
                 auto entry = JSStringCreateWithUTF8CString(pair.first.c_str());
@@ -114,8 +118,11 @@ private:
         }
 
         IOCollection* collection = get_private(object)->collection;
+        // The strategy is bound at compile time and only wraps the collection
+        // pointer, so the access itself is one virtual call into the
+        // collection; the key built above is handed over without re-copying.
         GetterSetter gs{collection};
-        return gs.get(accessor::Arguments{ctx, object, key.c_str(), 0, exception});
+        return gs.get(accessor::Arguments{ctx, object, std::move(key), 0, exception});
     }
 
     static bool setter(JSContextRef ctx, JSObjectRef object, JSStringRef propertyName, JSValueRef value,
@@ -129,7 +136,7 @@ private:
 
         IOCollection* collection = get_private(object)->collection;
         GetterSetter gs{collection};
-        gs.set(accessor::Arguments{ctx, object, key, value, exception});
+        gs.set(accessor::Arguments{ctx, object, std::move(key), value, exception});
         return true;
     }
 
@@ -195,6 +202,13 @@ public:
         accessors.push_back(name);
     }
 
+    void flush_pending()
+    {
+        // Nothing to do: keys only become visible when the object is lazily
+        // built from the accumulated class definition, which is already a
+        // single-shot operation.
+    }
+
     std::vector<std::string>& get_properties()
     {
         return accessors;
@@ -25,8 +25,19 @@
 
 #include "realm/object-store/dictionary.hpp"
 
+/*
+ * One per notification event, shared by every subscriber attached to the
+ * object. Whichever subscriber boxes the change set first stores the JS
+ * value in `boxed`; the rest reuse it instead of re-converting the change
+ * set per listener.
+ */
+struct BoxedChangeSet {
+    realm::DictionaryChangeSet& change_set;
+    JSValueRef boxed{nullptr}; // null until the first subscriber boxes it
+};
+
 struct Subscriber {
-    virtual void notify(JSObjectRef, realm::DictionaryChangeSet&) = 0;
+    virtual void notify(JSObjectRef, BoxedChangeSet&) = 0;
     virtual bool equals(std::unique_ptr<Subscriber>&) const = 0;
     virtual JSValueRef callback() const = 0;
     virtual ~Subscriber() = default;
@@ -34,6 +34,7 @@ private:
     ObjectObserver* observer = nullptr;
     IOCollection* collection = nullptr;
     std::vector<std::string> keys;
+    std::vector<Napi::PropertyDescriptor> pending_descriptors;
 
     template <class T>
     using ObjectAPI = realm::js::Object<T>;
@@ -115,12 +116,26 @@ public:
          */
         auto descriptor = Napi::PropertyDescriptor::Accessor(context, _object, key, Getter(key), Setter(key), rules);
 
-        // https://github.com/nodejs/node-addon-api/blob/main/doc/object.md#defineproperty
-        _object.DefineProperty(descriptor);
+        // Accumulated rather than defined immediately; flush_pending() lands
+        // the whole batch in one napi_define_properties call. Keys always
+        // flush in insertion order, so objects built from the same layout
+        // share a hidden-class history.
+        pending_descriptors.push_back(descriptor);
 
         keys.push_back(key);
     }
 
+    void flush_pending()
+    {
+        if (pending_descriptors.empty()) {
+            return;
+        }
+
+        // https://github.com/nodejs/node-addon-api/blob/main/doc/object.md#defineproperties
+        get().DefineProperties(pending_descriptors);
+        pending_descriptors.clear();
+    }
+
     template <typename RemovalCallback, typename Self>
     void finalize(RemovalCallback&& callback, Self* self)
     {
@@ -139,6 +154,9 @@ public:
 
     void remove_accessor(std::string& key)
     {
+        // A pending descriptor for this key must not outlive its removal.
+        flush_pending();
+
         Napi::Object obj = get();
 
         if (remove_key(key)) {
@@ -159,6 +177,7 @@ public:
 
     Napi::Object create()
     {
+        flush_pending();
         // Only necessary to keep compatibility with the JSCore.
         return get();
     }
@@ -19,8 +19,19 @@
 #pragma once
 #include "realm/object-store/dictionary.hpp"
 
+/*
+ * One per notification event, shared by every subscriber attached to the
+ * object. Whichever subscriber boxes the change set first stores the JS
+ * value in `boxed`; the rest reuse it instead of re-converting the change
+ * set per listener.
+ */
+struct BoxedChangeSet {
+    realm::DictionaryChangeSet& change_set;
+    Napi::Value boxed; // empty until the first subscriber boxes it
+};
+
 struct Subscriber {
-    virtual void notify(Napi::Object, realm::DictionaryChangeSet&) = 0;
+    virtual void notify(Napi::Object, BoxedChangeSet&) = 0;
     virtual bool equals(std::unique_ptr<Subscriber>&) const = 0;
     virtual Napi::Function callback() const = 0;
     virtual ~Subscriber() = default;
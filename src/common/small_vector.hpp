@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace realm {
+namespace common {
+
+/*
+ * A vector with inline storage for the first `InlineCapacity` elements.
+ * Intended for listener/subscriber lists, which nearly always hold one or
+ * two entries: those stay inside the owning object with no heap allocation,
+ * and only the rare longer list spills to the heap. Supports just what the
+ * fan-out paths need — push_back, erase, clear and contiguous iteration.
+ */
+template <typename T, size_t InlineCapacity>
+class SmallVector {
+public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() = default;
+    SmallVector(const SmallVector&) = delete;
+    SmallVector& operator=(const SmallVector&) = delete;
+
+    ~SmallVector()
+    {
+        clear();
+        if (!is_inline()) {
+            operator delete(m_data);
+        }
+    }
+
+    void push_back(T value)
+    {
+        if (m_size == m_capacity) {
+            grow();
+        }
+        new (m_data + m_size) T(std::move(value));
+        ++m_size;
+    }
+
+    iterator erase(iterator pos)
+    {
+        for (iterator it = pos; it + 1 != end(); ++it) {
+            *it = std::move(*(it + 1));
+        }
+        --m_size;
+        (m_data + m_size)->~T();
+        return pos;
+    }
+
+    void clear()
+    {
+        while (m_size > 0) {
+            --m_size;
+            (m_data + m_size)->~T();
+        }
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    iterator begin()
+    {
+        return m_data;
+    }
+
+    iterator end()
+    {
+        return m_data + m_size;
+    }
+
+    const_iterator begin() const
+    {
+        return m_data;
+    }
+
+    const_iterator end() const
+    {
+        return m_data + m_size;
+    }
+
+private:
+    bool is_inline() const
+    {
+        return m_data == reinterpret_cast<const T*>(&m_inline);
+    }
+
+    void grow()
+    {
+        size_t new_capacity = m_capacity * 2;
+        T* new_data = static_cast<T*>(operator new(new_capacity * sizeof(T)));
+        for (size_t i = 0; i < m_size; ++i) {
+            new (new_data + i) T(std::move(m_data[i]));
+            m_data[i].~T();
+        }
+        if (!is_inline()) {
+            operator delete(m_data);
+        }
+        m_data = new_data;
+        m_capacity = new_capacity;
+    }
+
+    alignas(T) unsigned char m_inline[sizeof(T) * InlineCapacity];
+    T* m_data = reinterpret_cast<T*>(&m_inline);
+    size_t m_size = 0;
+    size_t m_capacity = InlineCapacity;
+};
+
+} // namespace common
+} // namespace realm
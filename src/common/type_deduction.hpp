@@ -16,8 +16,9 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 #pragma once
-#include <iostream>
-#include <map>
+#include <cstdint>
+#include <optional>
+#include <string>
 
 #include "js_types.hpp"
 #include "types.hpp"
@@ -26,56 +27,173 @@
 namespace realm {
 namespace js {
 
+/// Packs (length, first byte, last byte) of a type name into one integer.
+/// The fixed vocabularies of Realm type names are collision-free under this
+/// key, so classifying a name is a switch on the packed value plus a single
+/// confirming compare, instead of a chain of string comparisons.
+constexpr uint32_t type_name_key(size_t size, char first, char last) noexcept
+{
+    return static_cast<uint32_t>(size) << 16 | static_cast<uint32_t>(static_cast<unsigned char>(first)) << 8 |
+           static_cast<unsigned char>(last);
+}
+
+template <size_t N>
+constexpr uint32_t type_name_key(const char (&literal)[N]) noexcept
+{
+    static_assert(N >= 2, "type names are non-empty");
+    return type_name_key(N - 1, literal[0], literal[N - 2]);
+}
+
+inline uint32_t type_name_key(StringData name) noexcept
+{
+    return name.size() == 0 ? 0 : type_name_key(name.size(), name[0], name[name.size() - 1]);
+}
+
 class GenericTypeDeductionImpl {
 private:
-    std::map<types::Type, std::string> realm_to_js_map;
-    std::map<std::string, types::Type> js_to_realm_map;
-
-    auto reverse_deduction_types_map()
+    // Both the capitalized spelling used by javascript_type and the
+    // all-lowercase variant are accepted, matching the map this replaced.
+    static std::optional<types::Type> find_realm_type(const std::string& type)
     {
-        std::map<std::string, types::Type> ret;
-        for (auto& [type, key] : realm_to_js_map) {
-            ret[key] = type; // camel_case version.
-            std::string lower_case_key;
-            // in-place lower case, we want to support multiple variation of the
-            // types written names.
-            std::transform(key.begin(), key.end(), key.begin(), [](unsigned char chr) {
-                return std::tolower(chr);
-            });
-            ret[key] = type;
+        switch (type_name_key(StringData(type))) {
+            case type_name_key("String"):
+                if (type == "String")
+                    return types::String;
+                break;
+            case type_name_key("string"):
+                if (type == "string")
+                    return types::String;
+                break;
+            case type_name_key("Int"):
+                if (type == "Int")
+                    return types::Integer;
+                break;
+            case type_name_key("int"):
+                if (type == "int")
+                    return types::Integer;
+                break;
+            case type_name_key("Float"):
+                if (type == "Float")
+                    return types::Float;
+                break;
+            case type_name_key("float"):
+                if (type == "float")
+                    return types::Float;
+                break;
+            case type_name_key("Double"):
+                if (type == "Double")
+                    return types::Double;
+                break;
+            case type_name_key("double"):
+                if (type == "double")
+                    return types::Double;
+                break;
+            case type_name_key("Decimal128"):
+                if (type == "Decimal128")
+                    return types::Decimal;
+                break;
+            case type_name_key("decimal128"):
+                if (type == "decimal128")
+                    return types::Decimal;
+                break;
+            case type_name_key("Bool"):
+                if (type == "Bool")
+                    return types::Boolean;
+                break;
+            case type_name_key("bool"):
+                if (type == "bool")
+                    return types::Boolean;
+                break;
+            case type_name_key("ObjectId"):
+                if (type == "ObjectId")
+                    return types::ObjectId;
+                break;
+            case type_name_key("objectid"):
+                if (type == "objectid")
+                    return types::ObjectId;
+                break;
+            case type_name_key("Object"):
+                if (type == "Object")
+                    return types::Object;
+                break;
+            case type_name_key("object"):
+                if (type == "object")
+                    return types::Object;
+                break;
+            case type_name_key("UUID"):
+                if (type == "UUID")
+                    return types::UUID;
+                break;
+            case type_name_key("uuid"):
+                if (type == "uuid")
+                    return types::UUID;
+                break;
+            case type_name_key("Undefined"):
+                if (type == "Undefined")
+                    return types::Undefined;
+                break;
+            case type_name_key("undefined"):
+                if (type == "undefined")
+                    return types::Undefined;
+                break;
+            case type_name_key("Null"):
+                if (type == "Null")
+                    return types::Null;
+                break;
+            case type_name_key("null"):
+                if (type == "null")
+                    return types::Null;
+                break;
         }
-        return ret;
+        return std::nullopt;
     }
 
 public:
-    GenericTypeDeductionImpl()
-    {
-        realm_to_js_map = {{types::String, "String"},     {types::Integer, "Int"},         {types::Float, "Float"},
-                           {types::Double, "Double"},     {types::Decimal, "Decimal128"},  {types::Boolean, "Bool"},
-                           {types::ObjectId, "ObjectId"}, {types::Object, "Object"},       {types::UUID, "UUID"},
-                           {types::Object, "Object"},     {types::Undefined, "Undefined"}, {types::Null, "Null"}};
-        js_to_realm_map = reverse_deduction_types_map();
-    }
-
     static GenericTypeDeductionImpl& get_instance()
     {
+        // Stateless; the instance only exists to keep the call sites unchanged.
         static GenericTypeDeductionImpl instance;
         return instance;
     }
 
     bool realm_type_exist(std::string const& type)
     {
-        return js_to_realm_map.find(type) != js_to_realm_map.end();
+        return find_realm_type(type).has_value();
     }
 
     types::Type realm_type(std::string const& type)
     {
-        return js_to_realm_map[type];
+        return find_realm_type(type).value_or(types::NotImplemented);
     }
 
     std::string javascript_type(types::Type value)
     {
-        return realm_to_js_map[value];
+        switch (value) {
+            case types::String:
+                return "String";
+            case types::Integer:
+                return "Int";
+            case types::Float:
+                return "Float";
+            case types::Double:
+                return "Double";
+            case types::Decimal:
+                return "Decimal128";
+            case types::Boolean:
+                return "Bool";
+            case types::ObjectId:
+                return "ObjectId";
+            case types::Object:
+                return "Object";
+            case types::UUID:
+                return "UUID";
+            case types::Undefined:
+                return "Undefined";
+            case types::Null:
+                return "Null";
+            default:
+                return {};
+        }
     }
 
     template <typename MixedValue>
@@ -18,85 +18,274 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
+#include <functional>
 #include <mutex>
 #include <optional>
 
 namespace realm {
 
+// A concurrent LIFO container sitting under the RPC worker and event dispatch
+// paths. `push_back`/`pop_back` — the hot pair — run lock-free on a Treiber
+// stack with a versioned head, so producers and consumers no longer serialize
+// on one mutex per item. The mutex only backs the cold paths: blocking waits
+// once the lock-free fast path has found nothing (a condition variable stands
+// in for a raw futex), `push_front`, and `pop_if`.
+//
+// LIFO order is load-bearing: the RPC worker pushes a promise per nested
+// request and each completing task must resolve the most recent one.
 template <typename T>
 class ConcurrentDeque {
 public:
+    ~ConcurrentDeque()
+    {
+        free_chain(m_head.load(std::memory_order_relaxed).node);
+        free_chain(m_free.load(std::memory_order_relaxed).node);
+    }
+
     T pop_back()
     {
+        if (auto item = try_take_stack()) {
+            return std::move(*item);
+        }
         std::unique_lock<std::mutex> lock(m_mutex);
-        m_condition.wait(lock, [this] {
-            return !m_deque.empty();
-        });
-        return do_pop_back();
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::optional<T> item;
+        while (!(item = try_take_stack()) && !(item = take_overflow_locked())) {
+            m_condition.wait(lock);
+        }
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        return std::move(*item);
     }
 
     T pop_if(std::function<bool(const T&)> predicate)
     {
+        // Cold path (nothing on the hot RPC loop calls this): detach the
+        // whole stack with one swap of the head, scan it with no shared state
+        // in play, then splice the survivors back on top of whatever was
+        // pushed meanwhile. The mutex only serializes concurrent
+        // `pop_if`/`push_front` calls.
         std::unique_lock<std::mutex> lock(m_mutex);
 
-        for (auto it = m_deque.begin(); it != m_deque.end();) {
-            if (predicate(*it)) {
-                T item = std::move(*it);
-                m_deque.erase(it);
-                return item;
+        TaggedHead head = m_head.load(std::memory_order_acquire);
+        TaggedHead detached;
+        do {
+            detached = {nullptr, head.version + 1};
+        } while (head.node && !m_head.compare_exchange_weak(head, detached, std::memory_order_acq_rel,
+                                                            std::memory_order_acquire));
+
+        Node* kept_head = nullptr;
+        Node* kept_tail = nullptr;
+        std::optional<T> match;
+        for (Node* node = head.node; node;) {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            if (!match && predicate(node->item)) {
+                match = std::move(node->item);
+                release_node(node);
             }
             else {
-                ++it;
+                // Append to preserve the relative order of survivors.
+                node->next.store(nullptr, std::memory_order_relaxed);
+                if (kept_tail) {
+                    kept_tail->next.store(node, std::memory_order_relaxed);
+                }
+                else {
+                    kept_head = node;
+                }
+                kept_tail = node;
             }
+            node = next;
+        }
+        if (kept_head) {
+            splice(kept_head, kept_tail);
         }
 
-        return nullptr;
+        if (!match) {
+            for (auto it = m_overflow.begin(); it != m_overflow.end(); ++it) {
+                if (predicate(*it)) {
+                    match = std::move(*it);
+                    m_overflow.erase(it);
+                    break;
+                }
+            }
+        }
+
+        lock.unlock();
+        if (kept_head && m_waiters.load(std::memory_order_seq_cst) > 0) {
+            m_condition.notify_all();
+        }
+        return match ? std::move(*match) : nullptr;
     }
 
     std::optional<T> try_pop_back(size_t timeout)
     {
+        if (auto item = try_take_stack()) {
+            return item;
+        }
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
         std::unique_lock<std::mutex> lock(m_mutex);
-        m_condition.wait_for(lock, std::chrono::milliseconds(timeout), [this] {
-            return !m_deque.empty();
-        });
-        return m_deque.empty() ? std::nullopt : make_optional(do_pop_back());
+        m_waiters.fetch_add(1, std::memory_order_seq_cst);
+        std::optional<T> item;
+        while (!(item = try_take_stack()) && !(item = take_overflow_locked())) {
+            if (m_condition.wait_until(lock, deadline) == std::cv_status::timeout) {
+                if (!(item = try_take_stack())) {
+                    item = take_overflow_locked();
+                }
+                break;
+            }
+        }
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+        return item;
     }
 
     void push_front(T&& item)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_deque.push_front(std::move(item));
-        lock.unlock();
-        m_condition.notify_one();
+        // Front pushes sort under everything already queued and everything
+        // queued later; they live in a mutex-guarded side deque consulted
+        // only once the lock-free stack is empty, which preserves the
+        // original pop order.
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_overflow.push_front(std::move(item));
+        }
+        notify();
     }
 
     void push_back(T&& item)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_deque.push_back(std::move(item));
-        lock.unlock();
-        m_condition.notify_one();
+        Node* node = acquire_node(std::move(item));
+        TaggedHead head = m_head.load(std::memory_order_relaxed);
+        TaggedHead desired;
+        do {
+            node->next.store(head.node, std::memory_order_relaxed);
+            desired = {node, head.version + 1};
+        } while (
+            !m_head.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed));
+        notify();
     }
 
     bool empty()
     {
+        if (m_head.load(std::memory_order_acquire).node) {
+            return false;
+        }
         std::lock_guard<std::mutex> lock(m_mutex);
-        return m_deque.empty();
+        return !m_head.load(std::memory_order_acquire).node && m_overflow.empty();
     }
 
 private:
+    struct Node {
+        T item;
+        std::atomic<Node*> next{nullptr};
+    };
+
+    // Pairing the head pointer with a version counter makes the pop CAS
+    // ABA-safe when nodes are recycled through the free list. On targets with
+    // a double-width CAS this stays lock-free; elsewhere std::atomic falls
+    // back to an internal lock but remains correct.
+    struct TaggedHead {
+        Node* node = nullptr;
+        std::uintptr_t version = 0;
+    };
+
+    std::atomic<TaggedHead> m_head{TaggedHead{}};
+    // Popped nodes are recycled rather than freed so that a racing pop
+    // reading a stale `next` pointer always touches live memory; its CAS then
+    // fails on the version and retries.
+    std::atomic<TaggedHead> m_free{TaggedHead{}};
+    std::atomic<size_t> m_waiters{0};
     std::condition_variable m_condition;
     std::mutex m_mutex;
-    std::deque<T> m_deque;
+    std::deque<T> m_overflow;
 
-    T do_pop_back()
+    std::optional<T> try_take_stack()
     {
-        T item = std::move(m_deque.back());
-        m_deque.pop_back();
+        TaggedHead head = m_head.load(std::memory_order_acquire);
+        while (head.node) {
+            TaggedHead desired{head.node->next.load(std::memory_order_relaxed), head.version + 1};
+            if (m_head.compare_exchange_weak(head, desired, std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+                Node* node = head.node;
+                std::optional<T> item(std::move(node->item));
+                release_node(node);
+                return item;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Requires m_mutex to be held.
+    std::optional<T> take_overflow_locked()
+    {
+        if (m_overflow.empty()) {
+            return std::nullopt;
+        }
+        std::optional<T> item(std::move(m_overflow.back()));
+        m_overflow.pop_back();
         return item;
     }
+
+    Node* acquire_node(T&& item)
+    {
+        TaggedHead head = m_free.load(std::memory_order_acquire);
+        while (head.node) {
+            TaggedHead desired{head.node->next.load(std::memory_order_relaxed), head.version + 1};
+            if (m_free.compare_exchange_weak(head, desired, std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+                head.node->item = std::move(item);
+                return head.node;
+            }
+        }
+        return new Node{std::move(item)};
+    }
+
+    void release_node(Node* node)
+    {
+        TaggedHead head = m_free.load(std::memory_order_relaxed);
+        TaggedHead desired;
+        do {
+            node->next.store(head.node, std::memory_order_relaxed);
+            desired = {node, head.version + 1};
+        } while (
+            !m_free.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void splice(Node* chain_head, Node* chain_tail)
+    {
+        TaggedHead head = m_head.load(std::memory_order_relaxed);
+        TaggedHead desired;
+        do {
+            chain_tail->next.store(head.node, std::memory_order_relaxed);
+            desired = {chain_head, head.version + 1};
+        } while (
+            !m_head.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void notify()
+    {
+        if (m_waiters.load(std::memory_order_seq_cst) == 0) {
+            return;
+        }
+        // Taking the lock (even briefly and empty) orders this notification
+        // against a waiter that has re-checked and is about to block.
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+        }
+        m_condition.notify_one();
+    }
+
+    static void free_chain(Node* node)
+    {
+        while (node) {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
 };
 
 } // namespace realm
@@ -0,0 +1,559 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cctype>
+#include <memory>
+#include <unordered_map>
+
+#include "hermes_types.hpp"
+#include "hermes_string.hpp"
+#include "hermes_value.hpp"
+#include "hermes_object.hpp"
+#include "hermes_function.hpp"
+#include "hermes_exception.hpp"
+#include "hermes_return_value.hpp"
+
+#include "js_class.hpp"
+#include "js_util.hpp"
+
+namespace realm {
+namespace js {
+template <typename T>
+class RealmObjectClass;
+} // namespace js
+
+namespace hermes {
+
+template <typename T>
+using ClassDefinition = js::ClassDefinition<Types, T>;
+
+using ConstructorType = js::ConstructorType<Types>;
+using ArgumentsMethodType = js::ArgumentsMethodType<Types>;
+using Arguments = js::Arguments<Types>;
+using PropertyType = js::PropertyType<Types>;
+using IndexPropertyType = js::IndexPropertyType<Types>;
+using StringPropertyType = js::StringPropertyType<Types>;
+using MethodMap = js::MethodMap<Types>;
+using PropertyMap = js::PropertyMap<Types>;
+
+// Converts a native exception into the jsi::JSError JSI expects, preserving
+// the original JS value when the exception carries one.
+inline jsi::JSError to_js_error(jsi::Runtime& rt, const std::exception& e)
+{
+    if (const Exception* js_error = dynamic_cast<const Exception*>(&e)) {
+        return jsi::JSError(rt, jsi::Value(rt, *static_cast<typename Types::Value>(*js_error)));
+    }
+    return jsi::JSError(rt, e.what());
+}
+
+// Parses `name` as a canonical array index, the way the proxies on the other
+// backends do before routing to the index accessor.
+inline bool parse_index(const std::string& name, uint32_t& index)
+{
+    if (name.empty() || name.size() > 10) {
+        return false;
+    }
+    uint64_t value = 0;
+    for (char c : name) {
+        if (!std::isdigit(static_cast<unsigned char>(c))) {
+            return false;
+        }
+        value = value * 10 + uint64_t(c - '0');
+    }
+    if (value > 0xfffffffe) {
+        return false;
+    }
+    index = uint32_t(value);
+    return true;
+}
+
+/**
+ * @brief JSI implementation of the class machinery: every wrapped native
+ * object is a jsi::HostObject, so property access traps natively in `get`/
+ * `set`/`getPropertyNames` with no JS Proxy, no trampoline and no bridge
+ * serialization — the reason this backend exists.
+ *
+ * Method and accessor lookup walks the ClassDefinition and its Parent chain
+ * directly (there is no prototype chain to delegate to). Method functions are
+ * materialized lazily and cached per instance, giving `obj.m === obj.m`
+ * stable identity for the instance's lifetime. Arbitrary JS-side writes land
+ * in a per-instance side table, emulating expando properties.
+ */
+template <typename ClassType>
+class ObjectWrap {
+    using Internal = typename ClassType::Internal;
+    using ParentClassType = typename ClassType::Parent;
+
+public:
+    static ClassType s_class;
+
+    class HostInstance : public jsi::HostObject, public std::enable_shared_from_this<HostInstance> {
+    public:
+        explicit HostInstance(Internal* internal)
+            : m_internal(internal)
+        {
+        }
+
+        ~HostInstance() override
+        {
+            delete m_internal;
+        }
+
+        Internal* internal() const
+        {
+            return m_internal;
+        }
+        void set_internal(Internal* internal)
+        {
+            m_internal = internal;
+        }
+
+        jsi::Value get(jsi::Runtime& rt, const jsi::PropNameID& name_id) override
+        {
+            HandleScope scope(&rt);
+            std::string name = name_id.utf8(rt);
+
+            uint32_t index;
+            if (get_index_accessor().getter && parse_index(name, index)) {
+                return get_index_accessor().getter(rt, *self(rt), index);
+            }
+
+            auto cached = m_side_properties.find(name);
+            if (cached != m_side_properties.end()) {
+                return jsi::Value(rt, cached->second);
+            }
+
+            if (auto* method = find_method(name)) {
+                jsi::Function fn = jsi::Function::createFromHostFunction(
+                    rt, jsi::PropNameID::forUtf8(rt, name), 0,
+                    [method = *method](jsi::Runtime& rt, const jsi::Value& this_value, const jsi::Value* args,
+                                       size_t count) {
+                        return method(rt, this_value, args, count);
+                    });
+                m_side_properties.emplace(name, jsi::Value(rt, fn));
+                return jsi::Value(rt, fn);
+            }
+
+            if (auto* property = find_property(name)) {
+                return property->getter(rt, *self(rt));
+            }
+
+            if (get_string_accessor().getter) {
+                return get_string_accessor().getter(rt, *self_object(rt), name);
+            }
+
+            return jsi::Value();
+        }
+
+        void set(jsi::Runtime& rt, const jsi::PropNameID& name_id, const jsi::Value& value) override
+        {
+            HandleScope scope(&rt);
+            std::string name = name_id.utf8(rt);
+
+            uint32_t index;
+            if (get_index_accessor() && parse_index(name, index)) {
+                if (!get_index_accessor().setter) {
+                    throw jsi::JSError(rt, util::format("Cannot assign to index %1 of %2", index, get_name()));
+                }
+                get_index_accessor().setter(rt, *self_object(rt), index, value);
+                return;
+            }
+
+            if (auto* property = find_property(name)) {
+                if (!property->setter) {
+                    throw jsi::JSError(rt, util::format("Cannot assign to read only property '%1' of %2", name,
+                                                        get_name()));
+                }
+                property->setter(rt, *self(rt), value);
+                return;
+            }
+
+            if (get_string_accessor().setter && get_string_accessor().setter(rt, *self_object(rt), name, value)) {
+                return;
+            }
+
+            m_side_properties[name] = jsi::Value(rt, value);
+        }
+
+        std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& rt) override
+        {
+            HandleScope scope(&rt);
+            std::vector<jsi::PropNameID> names;
+            if (get_string_accessor().enumerator) {
+                for (auto& name : get_string_accessor().enumerator(rt, *self_object(rt))) {
+                    names.push_back(jsi::PropNameID::forUtf8(rt, name));
+                }
+            }
+            collect_names<ClassType>(rt, names);
+            for (auto& [name, value] : m_side_properties) {
+                names.push_back(jsi::PropNameID::forUtf8(rt, name));
+            }
+            return names;
+        }
+
+    private:
+        // The generic callbacks take the instance as a value/object handle;
+        // recreate one pointing at this host object. The new handle wraps the
+        // same HostInstance, so internal state and side properties stay
+        // shared even though the JS object identity differs.
+        const jsi::Value* self(jsi::Runtime& rt)
+        {
+            return protect(jsi::Value(rt, jsi::Object::createFromHostObject(rt, shared_from_this())));
+        }
+        const jsi::Object* self_object(jsi::Runtime& rt)
+        {
+            return protect(jsi::Object::createFromHostObject(rt, shared_from_this()));
+        }
+
+        Internal* m_internal;
+        std::unordered_map<std::string, jsi::Value> m_side_properties;
+    };
+
+    static const std::string& get_name()
+    {
+        return s_class.name;
+    }
+
+    static const IndexPropertyType& get_index_accessor()
+    {
+        return s_class.index_accessor;
+    }
+
+    static const StringPropertyType& get_string_accessor()
+    {
+        return s_class.string_accessor;
+    }
+
+    // Lookup walks this class and then its parents, mirroring the prototype
+    // chain the other backends build.
+    static const typename Types::FunctionCallback* find_method(const std::string& name)
+    {
+        if (auto* method = s_class.methods.find(name)) {
+            return method;
+        }
+        if constexpr (!std::is_void_v<ParentClassType>) {
+            return ObjectWrap<ParentClassType>::find_method(name);
+        }
+        return nullptr;
+    }
+
+    static const PropertyType* find_property(const std::string& name)
+    {
+        if (auto* property = s_class.properties.find(name)) {
+            return property;
+        }
+        if constexpr (!std::is_void_v<ParentClassType>) {
+            return ObjectWrap<ParentClassType>::find_property(name);
+        }
+        return nullptr;
+    }
+
+    template <typename C>
+    static void collect_names(jsi::Runtime& rt, std::vector<jsi::PropNameID>& names)
+    {
+        for (auto& [name, method] : ObjectWrap<C>::s_class.methods) {
+            names.push_back(jsi::PropNameID::forUtf8(rt, name));
+        }
+        for (auto& [name, property] : ObjectWrap<C>::s_class.properties) {
+            names.push_back(jsi::PropNameID::forUtf8(rt, name));
+        }
+        if constexpr (!std::is_void_v<typename C::Parent>) {
+            collect_names<typename C::Parent>(rt, names);
+        }
+    }
+
+    static typename Types::Object create_instance(jsi::Runtime* rt, Internal* internal = nullptr)
+    {
+        return protect(jsi::Object::createFromHostObject(*rt, std::make_shared<HostInstance>(internal)));
+    }
+
+    static typename Types::Object create_instance_by_schema(jsi::Runtime* rt, const realm::ObjectSchema& schema,
+                                                            Internal* internal = nullptr)
+    {
+        typename Types::Function constructor = nullptr;
+        return create_instance_by_schema(rt, constructor, schema, internal);
+    }
+
+    static typename Types::Object create_instance_by_schema(jsi::Runtime* rt, typename Types::Function& constructor,
+                                                            const realm::ObjectSchema&, Internal* internal = nullptr)
+    {
+        if (constructor) {
+            // Host objects cannot adopt a user constructor's prototype chain;
+            // class-based models need the bindgen-style binding.
+            throw std::runtime_error("Class-based models are not yet supported on the Hermes backend; "
+                                     "use plain object schemas.");
+        }
+        return create_instance(rt, internal);
+    }
+
+    static jsi::Function create_constructor_function(jsi::Runtime& rt)
+    {
+        jsi::Function constructor = jsi::Function::createFromHostFunction(
+            rt, jsi::PropNameID::forUtf8(rt, s_class.name), 0,
+            [](jsi::Runtime& rt, const jsi::Value&, const jsi::Value* args, size_t count) -> jsi::Value {
+                HandleScope scope(&rt);
+                if (!s_class.constructor) {
+                    throw jsi::JSError(rt, s_class.name + " is not constructible");
+                }
+                auto instance = create_instance(&rt);
+                std::vector<typename Types::Value> arg_handles;
+                arg_handles.reserve(count);
+                for (size_t i = 0; i < count; i++) {
+                    arg_handles.push_back(&args[i]);
+                }
+                Arguments arguments{&rt, count, arg_handles.data()};
+                try {
+                    s_class.constructor(&rt, instance, arguments);
+                }
+                catch (const jsi::JSError&) {
+                    throw;
+                }
+                catch (const std::exception& e) {
+                    throw to_js_error(rt, e);
+                }
+                return jsi::Value(rt, *instance);
+            });
+
+        for (auto& [name, method] : s_class.static_methods) {
+            jsi::Function fn = jsi::Function::createFromHostFunction(
+                rt, jsi::PropNameID::forUtf8(rt, name), 0,
+                [method = method](jsi::Runtime& rt, const jsi::Value& this_value, const jsi::Value* args,
+                                  size_t count) {
+                    return method(rt, this_value, args, count);
+                });
+            constructor.setProperty(rt, jsi::PropNameID::forUtf8(rt, name), fn);
+        }
+
+        jsi::Function define_property =
+            rt.global().getPropertyAsObject(rt, "Object").getPropertyAsFunction(rt, "defineProperty");
+        for (auto& [name, property] : s_class.static_properties) {
+            jsi::Object descriptor(rt);
+            jsi::Function getter = jsi::Function::createFromHostFunction(
+                rt, jsi::PropNameID::forUtf8(rt, name), 0,
+                [getter = property.getter](jsi::Runtime& rt, const jsi::Value& this_value, const jsi::Value*,
+                                           size_t) {
+                    return getter(rt, this_value);
+                });
+            descriptor.setProperty(rt, "get", getter);
+            if (property.setter) {
+                jsi::Function setter = jsi::Function::createFromHostFunction(
+                    rt, jsi::PropNameID::forUtf8(rt, name), 1,
+                    [setter = property.setter](jsi::Runtime& rt, const jsi::Value& this_value,
+                                               const jsi::Value* args, size_t count) -> jsi::Value {
+                        setter(rt, this_value, count ? args[0] : jsi::Value());
+                        return jsi::Value();
+                    });
+                descriptor.setProperty(rt, "set", setter);
+            }
+            define_property.call(rt, constructor, jsi::String::createFromUtf8(rt, name), descriptor);
+        }
+
+        return constructor;
+    }
+
+    static typename Types::Function create_constructor(jsi::Runtime* rt)
+    {
+        return protect(create_constructor_function(*rt));
+    }
+
+    static bool has_instance(jsi::Runtime* rt, const typename Types::Object& object)
+    {
+        if (!object->isHostObject(*rt)) {
+            return false;
+        }
+        return dynamic_cast<HostInstance*>(object->getHostObject(*rt).get()) != nullptr;
+    }
+
+    static bool has_instance(jsi::Runtime* rt, const typename Types::Value& value)
+    {
+        return value->isObject() && has_instance(rt, protect(value->getObject(*rt)));
+    }
+
+    static Internal* get_internal(jsi::Runtime* rt, const typename Types::Object& object)
+    {
+        auto* instance = dynamic_cast<HostInstance*>(object->getHostObject(*rt).get());
+        if (!instance) {
+            throw std::runtime_error("Object is not a " + s_class.name);
+        }
+        return instance->internal();
+    }
+
+    static void set_internal(jsi::Runtime* rt, const typename Types::Object& object, Internal* internal)
+    {
+        auto* instance = dynamic_cast<HostInstance*>(object->getHostObject(*rt).get());
+        if (instance) {
+            instance->set_internal(internal);
+        }
+    }
+
+    static void on_context_destroy(jsi::Runtime*, std::string)
+    {
+        // Nothing cached per runtime; host instances die with the runtime.
+    }
+};
+
+template <typename ClassType>
+ClassType ObjectWrap<ClassType>::s_class;
+
+} // namespace hermes
+
+namespace js {
+
+template <typename ClassType>
+class ObjectWrap<hermes::Types, ClassType> : public hermes::ObjectWrap<ClassType> {};
+
+template <hermes::ArgumentsMethodType F>
+jsi::Value wrap(jsi::Runtime& rt, const jsi::Value& this_value, const jsi::Value* args, size_t count)
+{
+    hermes::HandleScope scope(&rt);
+    const jsi::Object* this_object =
+        this_value.isObject() ? hermes::protect(this_value.getObject(rt)) : hermes::protect(jsi::Object(rt));
+    std::vector<typename hermes::Types::Value> arg_handles;
+    arg_handles.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        arg_handles.push_back(&args[i]);
+    }
+    hermes::Arguments arguments{&rt, count, arg_handles.data()};
+    hermes::ReturnValue return_value(&rt);
+    try {
+        F(&rt, this_object, arguments, return_value);
+        return return_value.take();
+    }
+    catch (const jsi::JSError&) {
+        throw;
+    }
+    catch (const std::exception& e) {
+        throw hermes::to_js_error(rt, e);
+    }
+}
+
+template <hermes::PropertyType::GetterType F>
+jsi::Value wrap(jsi::Runtime& rt, const jsi::Value& this_value)
+{
+    hermes::HandleScope scope(&rt);
+    hermes::ReturnValue return_value(&rt);
+    try {
+        F(&rt, hermes::protect(this_value.getObject(rt)), return_value);
+        return return_value.take();
+    }
+    catch (const jsi::JSError&) {
+        throw;
+    }
+    catch (const std::exception& e) {
+        throw hermes::to_js_error(rt, e);
+    }
+}
+
+template <hermes::PropertyType::SetterType F>
+void wrap(jsi::Runtime& rt, const jsi::Value& this_value, const jsi::Value& value)
+{
+    hermes::HandleScope scope(&rt);
+    try {
+        F(&rt, hermes::protect(this_value.getObject(rt)), &value);
+    }
+    catch (const jsi::JSError&) {
+        throw;
+    }
+    catch (const std::exception& e) {
+        throw hermes::to_js_error(rt, e);
+    }
+}
+
+template <hermes::IndexPropertyType::GetterType F>
+jsi::Value wrap(jsi::Runtime& rt, const jsi::Object& instance, uint32_t index)
+{
+    hermes::HandleScope scope(&rt);
+    hermes::ReturnValue return_value(&rt);
+    try {
+        F(&rt, &instance, index, return_value);
+        return return_value.take();
+    }
+    catch (std::out_of_range&) {
+        // Out-of-bounds index reads answer undefined, matching JS arrays.
+        return jsi::Value();
+    }
+    catch (const jsi::JSError&) {
+        throw;
+    }
+    catch (const std::exception& e) {
+        throw hermes::to_js_error(rt, e);
+    }
+}
+
+template <hermes::IndexPropertyType::SetterType F>
+bool wrap(jsi::Runtime& rt, const jsi::Object& instance, uint32_t index, const jsi::Value& value)
+{
+    hermes::HandleScope scope(&rt);
+    try {
+        return F(&rt, &instance, index, &value);
+    }
+    catch (const jsi::JSError&) {
+        throw;
+    }
+    catch (const std::exception& e) {
+        throw hermes::to_js_error(rt, e);
+    }
+}
+
+template <hermes::StringPropertyType::GetterType F>
+jsi::Value wrap(jsi::Runtime& rt, const jsi::Object& instance, const std::string& name)
+{
+    hermes::HandleScope scope(&rt);
+    hermes::ReturnValue return_value(&rt);
+    try {
+        F(&rt, &instance, name, return_value);
+        return return_value.take();
+    }
+    catch (const jsi::JSError&) {
+        throw;
+    }
+    catch (const std::exception& e) {
+        throw hermes::to_js_error(rt, e);
+    }
+}
+
+template <hermes::StringPropertyType::SetterType F>
+bool wrap(jsi::Runtime& rt, const jsi::Object& instance, const std::string& name, const jsi::Value& value)
+{
+    hermes::HandleScope scope(&rt);
+    try {
+        return F(&rt, &instance, name, &value);
+    }
+    catch (const jsi::JSError&) {
+        throw;
+    }
+    catch (const std::exception& e) {
+        throw hermes::to_js_error(rt, e);
+    }
+}
+
+template <hermes::StringPropertyType::EnumeratorType F>
+std::vector<std::string> wrap(jsi::Runtime& rt, const jsi::Object& instance)
+{
+    hermes::HandleScope scope(&rt);
+    std::vector<std::string> names;
+    for (auto& name : F(&rt, &instance)) {
+        names.push_back(name);
+    }
+    return names;
+}
+
+} // namespace js
+} // namespace realm
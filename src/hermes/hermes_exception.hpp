@@ -0,0 +1,35 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "hermes_types.hpp"
+#include "hermes_value.hpp"
+
+namespace realm {
+namespace js {
+
+template <>
+inline typename hermes::Types::Value hermes::Exception::value(jsi::Runtime* rt, const std::string& message)
+{
+    jsi::Function error_constructor = hermes::global_constructor(*rt, "Error");
+    return hermes::protect(error_constructor.callAsConstructor(*rt, jsi::String::createFromUtf8(*rt, message)));
+}
+
+} // namespace js
+} // namespace realm
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "hermes_types.hpp"
+#include "hermes_exception.hpp"
+
+#include <vector>
+
+namespace realm {
+namespace js {
+
+template <>
+inline typename hermes::Types::Value hermes::Function::call(jsi::Runtime* rt, const FunctionType& function,
+                                                            const ObjectType& this_object, size_t argc,
+                                                            const ValueType arguments[])
+{
+    std::vector<jsi::Value> args;
+    args.reserve(argc);
+    for (size_t i = 0; i < argc; i++) {
+        args.emplace_back(*rt, *arguments[i]);
+    }
+    try {
+        jsi::Function fn = function->getFunction(*rt);
+        if (this_object) {
+            return hermes::protect(fn.callWithThis(*rt, *this_object, static_cast<const jsi::Value*>(args.data()),
+                                                   argc));
+        }
+        return hermes::protect(fn.call(*rt, static_cast<const jsi::Value*>(args.data()), argc));
+    }
+    catch (const jsi::JSError& error) {
+        throw hermes::Exception(rt, hermes::protect(*rt, error.value()));
+    }
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Function::callback(jsi::Runtime* rt, const FunctionType& function,
+                                                                const ObjectType& this_object, size_t argc,
+                                                                const ValueType arguments[])
+{
+    return hermes::Function::call(rt, function, this_object, argc, arguments);
+}
+
+template <>
+inline typename hermes::Types::Object hermes::Function::construct(jsi::Runtime* rt, const FunctionType& function,
+                                                                  size_t argc, const ValueType arguments[])
+{
+    std::vector<jsi::Value> args;
+    args.reserve(argc);
+    for (size_t i = 0; i < argc; i++) {
+        args.emplace_back(*rt, *arguments[i]);
+    }
+    try {
+        return hermes::protect(function->getFunction(*rt)
+                                   .callAsConstructor(*rt, static_cast<const jsi::Value*>(args.data()), argc)
+                                   .getObject(*rt));
+    }
+    catch (const jsi::JSError& error) {
+        throw hermes::Exception(rt, hermes::protect(*rt, error.value()));
+    }
+}
+
+} // namespace js
+} // namespace realm
@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <realm/object-store/impl/realm_coordinator.hpp>
+#include <realm/object-store/sync/app.hpp>
+#include <realm/object-store/sync/subscribable.hpp>
+#include <realm/object-store/sync/sync_user.hpp>
+
+#include "hermes_init.hpp"
+#include "platform.hpp"
+
+#include "js_notifications.hpp"
+
+namespace realm {
+namespace hermes {
+
+void install(jsi::Runtime& rt)
+{
+    HandleScope scope(&rt);
+
+    typename Types::Function realm_constructor = js::RealmClass<Types>::create_constructor(&rt);
+
+    jsi::Object descriptor(rt);
+    descriptor.setProperty(rt, "value", jsi::Value(rt, *realm_constructor));
+    descriptor.setProperty(rt, "writable", false);
+    descriptor.setProperty(rt, "enumerable", false);
+    descriptor.setProperty(rt, "configurable", false);
+    rt.global()
+        .getPropertyAsObject(rt, "Object")
+        .getPropertyAsFunction(rt, "defineProperty")
+        .call(rt, rt.global(), jsi::String::createFromUtf8(rt, "Realm"), descriptor);
+}
+
+void invalidate_caches()
+{
+    // Close all cached Realms
+    realm::_impl::RealmCoordinator::clear_all_caches();
+    // Clear the Object Store App cache, to prevent instances from using a context that was released
+    realm::app::App::clear_cached_apps();
+    // Clear notifications
+    realm::js::notifications::NotificationBucket<Types, NotificationToken>::clear();
+    realm::js::notifications::NotificationBucket<Types, Subscribable<realm::SyncUser>::Token>::clear();
+    realm::js::notifications::NotificationBucket<Types, Subscribable<realm::app::App>::Token>::clear();
+    // Drop cached session wrappers, which hold Protected values tied to the released context
+    realm::js::SessionWrapperCache<Types>::clear();
+}
+
+} // namespace hermes
+} // namespace realm
@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "hermes_types.hpp"
+#include "hermes_string.hpp"
+#include "hermes_protected.hpp"
+#include "hermes_context.hpp"
+#include "hermes_value.hpp"
+#include "hermes_object.hpp"
+#include "hermes_function.hpp"
+#include "hermes_exception.hpp"
+#include "hermes_return_value.hpp"
+#include "hermes_class.hpp"
+
+// FIXME: js_object_accessor.hpp includes js_list.hpp which includes js_object_accessor.hpp.
+#include "js_object_accessor.hpp"
+
+#include "js_realm.hpp"
+
+namespace realm {
+namespace hermes {
+
+/// Installs the Realm constructor into the runtime's global object. Called
+/// once per runtime, directly from the host (TurboModule install or
+/// equivalent) — there is no remote-debugging RPC fallback on this backend;
+/// Hermes debugging happens on-device through the inspector.
+void install(jsi::Runtime& rt);
+
+/// Drops process-wide caches when the runtime is torn down (dev-mode reload).
+void invalidate_caches();
+
+} // namespace hermes
+} // namespace realm
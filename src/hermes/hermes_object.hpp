@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "hermes_types.hpp"
+#include "hermes_value.hpp"
+
+namespace realm {
+namespace js {
+
+template <>
+inline typename hermes::Types::Value hermes::Object::get_prototype(jsi::Runtime* rt, const ObjectType& object)
+{
+    jsi::Function get_proto = hermes::global_constructor(*rt, "Object").getPropertyAsFunction(*rt, "getPrototypeOf");
+    return hermes::protect(get_proto.call(*rt, *object));
+}
+
+template <>
+inline void hermes::Object::set_prototype(jsi::Runtime* rt, const ObjectType& object, const ValueType& prototype)
+{
+    jsi::Function set_proto = hermes::global_constructor(*rt, "Object").getPropertyAsFunction(*rt, "setPrototypeOf");
+    set_proto.call(*rt, *object, *prototype);
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Object::get_property(jsi::Runtime* rt, const ObjectType& object,
+                                                                  StringData key)
+{
+    return hermes::protect(object->getProperty(*rt, jsi::String::createFromUtf8(*rt, std::string(key))));
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Object::get_property(jsi::Runtime* rt, const ObjectType& object,
+                                                                  const hermes::String& key)
+{
+    return hermes::protect(object->getProperty(*rt, key.to_jsi(*rt)));
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Object::get_property(jsi::Runtime* rt, const ObjectType& object,
+                                                                  uint32_t index)
+{
+    return hermes::protect(object->getArray(*rt).getValueAtIndex(*rt, index));
+}
+
+template <>
+inline void hermes::Object::set_property(jsi::Runtime* rt, ObjectType& object, const hermes::String& key,
+                                         const ValueType& value, PropertyAttributes attributes)
+{
+    if (attributes) {
+        jsi::Object descriptor(*rt);
+        descriptor.setProperty(*rt, "value", *value);
+        descriptor.setProperty(*rt, "writable", !(attributes & ReadOnly));
+        descriptor.setProperty(*rt, "enumerable", !(attributes & DontEnum));
+        descriptor.setProperty(*rt, "configurable", !(attributes & DontDelete));
+        jsi::Function define_property =
+            hermes::global_constructor(*rt, "Object").getPropertyAsFunction(*rt, "defineProperty");
+        define_property.call(*rt, *object, key.to_jsi(*rt), descriptor);
+        return;
+    }
+    const_cast<jsi::Object*>(object)->setProperty(*rt, key.to_jsi(*rt), *value);
+}
+
+template <>
+inline void hermes::Object::set_property(jsi::Runtime* rt, ObjectType& object, uint32_t index,
+                                         const ValueType& value)
+{
+    object->getArray(*rt).setValueAtIndex(*rt, index, *value);
+}
+
+template <>
+inline std::vector<hermes::String> hermes::Object::get_property_names(jsi::Runtime* rt, const ObjectType& object)
+{
+    jsi::Array names = object->getPropertyNames(*rt);
+    size_t count = names.size(*rt);
+    std::vector<hermes::String> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        result.push_back(names.getValueAtIndex(*rt, i).getString(*rt).utf8(*rt));
+    }
+    return result;
+}
+
+template <>
+inline void hermes::Object::set_global(jsi::Runtime* rt, const hermes::String& key, const ValueType& value)
+{
+    rt->global().setProperty(*rt, key.to_jsi(*rt), *value);
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Object::get_global(jsi::Runtime* rt, const hermes::String& key)
+{
+    return hermes::protect(rt->global().getProperty(*rt, key.to_jsi(*rt)));
+}
+
+template <>
+inline void hermes::Object::set_lazy_property(jsi::Runtime* rt, ObjectType object, const hermes::String& key,
+                                              LazyPropertyFactory factory)
+{
+    // No lazy materialization hook without a native getter object per
+    // property; the value is simply computed eagerly. The class machinery's
+    // own lazy paths sidestep this by living on the host object.
+    ValueType value = factory(rt, object, key);
+    hermes::Object::set_property(rt, object, key, value);
+}
+
+template <>
+inline typename hermes::Types::Object hermes::Object::create_empty(jsi::Runtime* rt)
+{
+    return hermes::protect(jsi::Object(*rt));
+}
+
+template <>
+inline typename hermes::Types::Object
+hermes::Object::create_obj(jsi::Runtime* rt, std::initializer_list<std::pair<hermes::String, ValueType>> values)
+{
+    jsi::Object object(*rt);
+    for (auto& [key, value] : values) {
+        object.setProperty(*rt, key.to_jsi(*rt), *value);
+    }
+    return hermes::protect(std::move(object));
+}
+
+template <>
+inline typename hermes::Types::Object hermes::Object::create_array(jsi::Runtime* rt, uint32_t length,
+                                                                   const ValueType values[])
+{
+    jsi::Array array(*rt, length);
+    for (uint32_t i = 0; i < length; i++) {
+        array.setValueAtIndex(*rt, i, *values[i]);
+    }
+    return hermes::protect(std::move(array));
+}
+
+template <>
+inline typename hermes::Types::Object hermes::Object::create_uint32_array(jsi::Runtime* rt,
+                                                                          const std::vector<uint32_t>& values)
+{
+    jsi::Array array(*rt, values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        array.setValueAtIndex(*rt, i, double(values[i]));
+    }
+    return hermes::protect(std::move(array));
+}
+
+template <>
+inline typename hermes::Types::Object hermes::Object::create_date(jsi::Runtime* rt, double time)
+{
+    jsi::Function date_constructor = hermes::global_constructor(*rt, "Date");
+    return hermes::protect(date_constructor.callAsConstructor(*rt, time).getObject(*rt));
+}
+
+template <>
+template <typename ClassType>
+inline typename hermes::Types::Object hermes::Object::create_instance(jsi::Runtime* rt,
+                                                                      typename ClassType::Internal* internal)
+{
+    return hermes::ObjectWrap<ClassType>::create_instance(rt, internal);
+}
+
+template <>
+template <typename ClassType>
+inline typename hermes::Types::Object
+hermes::Object::create_instance_by_schema(jsi::Runtime* rt, typename hermes::Types::Function& constructor,
+                                          const realm::ObjectSchema& schema,
+                                          typename ClassType::Internal* internal)
+{
+    return hermes::ObjectWrap<ClassType>::create_instance_by_schema(rt, constructor, schema, internal);
+}
+
+template <>
+template <typename ClassType>
+inline typename hermes::Types::Object
+hermes::Object::create_instance_by_schema(jsi::Runtime* rt, const realm::ObjectSchema& schema,
+                                          typename ClassType::Internal* internal)
+{
+    return hermes::ObjectWrap<ClassType>::create_instance_by_schema(rt, schema, internal);
+}
+
+template <>
+template <typename ClassType>
+inline bool hermes::Object::is_instance(jsi::Runtime* rt, const ObjectType& object)
+{
+    return hermes::ObjectWrap<ClassType>::has_instance(rt, object);
+}
+
+template <>
+template <typename ClassType>
+inline typename ClassType::Internal* hermes::Object::get_internal(jsi::Runtime* rt, const ObjectType& object)
+{
+    return hermes::ObjectWrap<ClassType>::get_internal(rt, object);
+}
+
+template <>
+template <typename ClassType>
+inline void hermes::Object::set_internal(jsi::Runtime* rt, const ObjectType& object,
+                                         typename ClassType::Internal* internal)
+{
+    hermes::ObjectWrap<ClassType>::set_internal(rt, object, internal);
+}
+
+} // namespace js
+} // namespace realm
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "hermes_types.hpp"
+
+#include <memory>
+
+namespace realm {
+namespace js {
+
+// A jsi::Value owned from C++ is itself a strong reference — there is no
+// separate protect/unprotect API as in JSC or N-API. Protected therefore just
+// owns a heap copy of the value, shared between copies of the Protected, and
+// hands out a pointer to it as the handle. The owned copy is independent of
+// any HandleScope, which is the point: Protected is how a handle outlives the
+// native call that produced it.
+template <>
+class Protected<const jsi::Value*> {
+    jsi::Runtime* m_rt = nullptr;
+    std::shared_ptr<jsi::Value> m_value;
+
+public:
+    Protected() = default;
+    Protected(jsi::Runtime* rt, const jsi::Value* value)
+        : m_rt(rt)
+        , m_value(std::make_shared<jsi::Value>(*rt, *value))
+    {
+    }
+
+    operator const jsi::Value*() const
+    {
+        return m_value.get();
+    }
+    explicit operator bool() const
+    {
+        return m_value != nullptr;
+    }
+
+    bool operator==(const jsi::Value* other) const
+    {
+        return m_value && jsi::Value::strictEquals(*m_rt, *m_value, *other);
+    }
+    bool operator!=(const jsi::Value* other) const
+    {
+        return !(*this == other);
+    }
+    bool operator==(const Protected& other) const
+    {
+        return m_value == other.m_value ||
+               (m_value && other.m_value && jsi::Value::strictEquals(*m_rt, *m_value, *other.m_value));
+    }
+    bool operator!=(const Protected& other) const
+    {
+        return !(*this == other);
+    }
+
+    struct Comparator {
+        bool operator()(const Protected& a, const Protected& b) const
+        {
+            return a == b;
+        }
+    };
+};
+
+// Covers Protected<ObjectType> and Protected<FunctionType>, which alias the
+// same handle type in this backend.
+template <>
+class Protected<const jsi::Object*> {
+    jsi::Runtime* m_rt = nullptr;
+    std::shared_ptr<jsi::Object> m_object;
+
+public:
+    Protected() = default;
+    Protected(jsi::Runtime* rt, const jsi::Object* object)
+        : m_rt(rt)
+        , m_object(std::make_shared<jsi::Object>(jsi::Value(*rt, *object).getObject(*rt)))
+    {
+    }
+
+    operator const jsi::Object*() const
+    {
+        return m_object.get();
+    }
+    explicit operator bool() const
+    {
+        return m_object != nullptr;
+    }
+
+    bool operator==(const jsi::Object* other) const
+    {
+        return m_object && jsi::Object::strictEquals(*m_rt, *m_object, *other);
+    }
+    bool operator!=(const jsi::Object* other) const
+    {
+        return !(*this == other);
+    }
+    bool operator==(const Protected& other) const
+    {
+        return m_object == other.m_object ||
+               (m_object && other.m_object && jsi::Object::strictEquals(*m_rt, *m_object, *other.m_object));
+    }
+    bool operator!=(const Protected& other) const
+    {
+        return !(*this == other);
+    }
+
+    struct Comparator {
+        bool operator()(const Protected& a, const Protected& b) const
+        {
+            return a == b;
+        }
+    };
+};
+
+template <>
+class Protected<jsi::Runtime*> {
+    jsi::Runtime* m_rt = nullptr;
+
+public:
+    Protected() = default;
+    explicit Protected(jsi::Runtime* rt)
+        : m_rt(rt)
+    {
+    }
+
+    operator jsi::Runtime*() const
+    {
+        return m_rt;
+    }
+    explicit operator bool() const
+    {
+        return m_rt != nullptr;
+    }
+
+    struct Comparator {
+        bool operator()(const Protected& a, const Protected& b) const
+        {
+            return a.m_rt == b.m_rt;
+        }
+    };
+};
+
+} // namespace js
+} // namespace realm
@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include "hermes_types.hpp"
+#include "hermes_string.hpp"
+#include "hermes_value.hpp"
+
+namespace realm {
+namespace js {
+
+template <>
+class ReturnValue<hermes::Types> {
+    jsi::Runtime* m_rt;
+    jsi::Value m_value; // undefined until set
+
+public:
+    ReturnValue(jsi::Runtime* rt)
+        : m_rt(rt)
+    {
+    }
+
+    void set(const typename hermes::Types::Value& value)
+    {
+        m_value = jsi::Value(*m_rt, *value);
+    }
+    void set(const std::string& string)
+    {
+        m_value = jsi::String::createFromUtf8(*m_rt, string);
+    }
+    void set(const char* string)
+    {
+        m_value = jsi::String::createFromUtf8(*m_rt, string);
+    }
+    void set(bool boolean)
+    {
+        m_value = jsi::Value(boolean);
+    }
+    void set(double number)
+    {
+        m_value = jsi::Value(number);
+    }
+    void set(int32_t number)
+    {
+        m_value = jsi::Value(double(number));
+    }
+    void set(uint32_t number)
+    {
+        m_value = jsi::Value(double(number));
+    }
+    void set(realm::Mixed mixed)
+    {
+        m_value = jsi::Value(*m_rt, *Value<hermes::Types>::from_mixed(m_rt, nullptr, mixed));
+    }
+    // Typed direct-set paths mirroring the node ReturnValue: getter callbacks
+    // on hot property and index reads hand the engine-native value straight
+    // through without an intermediate conversion.
+    void set_prewrapped(const typename hermes::Types::Value& value)
+    {
+        m_value = jsi::Value(*m_rt, *value);
+    }
+    void set_int64(int64_t number)
+    {
+        m_value = jsi::Value(double(number));
+    }
+    void set_bool(bool boolean)
+    {
+        m_value = jsi::Value(boolean);
+    }
+    void set_string_view(std::string_view string)
+    {
+        m_value = jsi::String::createFromUtf8(*m_rt, std::string(string));
+    }
+    void set_null()
+    {
+        m_value = jsi::Value(nullptr);
+    }
+    void set_undefined()
+    {
+        m_value = jsi::Value();
+    }
+
+    template <typename T>
+    void set(const std::optional<T>& value)
+    {
+        if (value) {
+            set(*value);
+        }
+        else {
+            set_undefined();
+        }
+    }
+
+    /// Moves the result out for returning from a host function.
+    jsi::Value take()
+    {
+        return std::move(m_value);
+    }
+
+    operator typename hermes::Types::Value() const
+    {
+        return hermes::protect(*m_rt, m_value);
+    }
+};
+
+} // namespace js
+} // namespace realm
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "hermes_types.hpp"
+
+#include <string>
+
+namespace realm {
+namespace js {
+
+// JSI has no runtime-independent string handle (jsi::String and jsi::PropNameID
+// are both runtime-bound), so the backend's string wrapper is UTF-8 in a plain
+// std::string, converted at the runtime boundary — the same choice the node
+// backend makes.
+template <>
+class String<hermes::Types> {
+    using StringType = String<hermes::Types>;
+
+    std::string m_str;
+
+public:
+    static bson::Bson to_bson(StringType stringified_ejson)
+    {
+        return bson::parse(std::string(stringified_ejson));
+    }
+
+    static StringType from_bson(const bson::Bson& bson)
+    {
+        return StringType(bson.to_string());
+    }
+
+    String(const char* s)
+        : m_str(s)
+    {
+    }
+    String(StringData str)
+        : m_str(str.data(), str.size())
+    {
+    }
+    String(std::string str)
+        : m_str(std::move(str))
+    {
+    }
+    String(const StringType& o) = default;
+    String(StringType&& o) = default;
+    StringType& operator=(const StringType&) = default;
+    StringType& operator=(StringType&&) = default;
+
+    operator std::string() const&
+    {
+        return m_str;
+    }
+    operator std::string() &&
+    {
+        return std::move(m_str);
+    }
+
+    const std::string& str() const
+    {
+        return m_str;
+    }
+
+    jsi::String to_jsi(jsi::Runtime& rt) const
+    {
+        return jsi::String::createFromUtf8(rt, m_str);
+    }
+
+    jsi::PropNameID to_prop_name(jsi::Runtime& rt) const
+    {
+        return jsi::PropNameID::forUtf8(rt, m_str);
+    }
+};
+
+} // namespace js
+} // namespace realm
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <deque>
+#include <string>
+
+#include <jsi/jsi.h>
+
+// JSI values are scoped C++ objects rather than the trivially copyable
+// handles the template machinery was written against (napi_value,
+// JSValueRef), so this backend adds its own handle scope: every native entry
+// point opens one, values created during the call live in it, and the
+// `Types::Value`/`Types::Object` aliases are stable pointers into it. The
+// lifetime rules end up identical to N-API's — a handle must not be used
+// after the scope that produced it closes; anything longer-lived goes
+// through `Protected`.
+#define HANDLESCOPE(context) realm::hermes::HandleScope handle_scope(context);
+
+namespace realm {
+namespace hermes {
+
+namespace jsi = facebook::jsi;
+
+/// Arena owning the jsi::Value/jsi::Object instances behind the pointer
+/// handles handed to the generic layer. Scopes nest; allocation goes to the
+/// innermost one. Deques give the elements stable addresses.
+class HandleScope {
+public:
+    explicit HandleScope(jsi::Runtime* rt)
+        : m_runtime(rt)
+        , m_parent(current())
+    {
+        current() = this;
+    }
+
+    ~HandleScope()
+    {
+        current() = m_parent;
+    }
+
+    HandleScope(const HandleScope&) = delete;
+    HandleScope& operator=(const HandleScope&) = delete;
+
+    static HandleScope* current_scope()
+    {
+        return current();
+    }
+
+    const jsi::Value* add(jsi::Value&& value)
+    {
+        m_values.push_back(std::move(value));
+        return &m_values.back();
+    }
+
+    const jsi::Object* add(jsi::Object&& object)
+    {
+        m_objects.push_back(std::move(object));
+        return &m_objects.back();
+    }
+
+    jsi::Runtime* runtime() const
+    {
+        return m_runtime;
+    }
+
+private:
+    static HandleScope*& current()
+    {
+        static thread_local HandleScope* s_current = nullptr;
+        return s_current;
+    }
+
+    jsi::Runtime* m_runtime;
+    HandleScope* m_parent;
+    std::deque<jsi::Value> m_values;
+    std::deque<jsi::Object> m_objects;
+};
+
+/// Moves `value` into the innermost handle scope and returns its handle.
+inline const jsi::Value* protect(jsi::Value&& value)
+{
+    return HandleScope::current_scope()->add(std::move(value));
+}
+
+inline const jsi::Object* protect(jsi::Object&& object)
+{
+    return HandleScope::current_scope()->add(std::move(object));
+}
+
+/// Copies an existing handle into the innermost scope, e.g. to outlive an
+/// inner scope that is about to close.
+inline const jsi::Value* protect(jsi::Runtime& rt, const jsi::Value& value)
+{
+    return protect(jsi::Value(rt, value));
+}
+
+inline const jsi::Object* protect(jsi::Runtime& rt, const jsi::Object& object)
+{
+    return protect(jsi::Value(rt, object).getObject(rt));
+}
+
+struct Types {
+    using Context = jsi::Runtime*;
+    using GlobalContext = jsi::Runtime*;
+    using Value = const jsi::Value*;
+    using Object = const jsi::Object*;
+    using String = std::string;
+    using Function = const jsi::Object*;
+
+    // Native callbacks are plain function pointers, like the other backends;
+    // per-instance state travels through the host object, not captures.
+    using FunctionCallback = jsi::Value (*)(jsi::Runtime&, const jsi::Value& this_value, const jsi::Value* args,
+                                            size_t count);
+    using ConstructorCallback = FunctionCallback;
+    using PropertyGetterCallback = jsi::Value (*)(jsi::Runtime&, const jsi::Value& this_value);
+    using PropertySetterCallback = void (*)(jsi::Runtime&, const jsi::Value& this_value, const jsi::Value& value);
+    using IndexPropertyGetterCallback = jsi::Value (*)(jsi::Runtime&, const jsi::Object& instance, uint32_t index);
+    using IndexPropertySetterCallback = bool (*)(jsi::Runtime&, const jsi::Object& instance, uint32_t index,
+                                                 const jsi::Value& value);
+    using StringPropertyGetterCallback = jsi::Value (*)(jsi::Runtime&, const jsi::Object& instance,
+                                                        const std::string& name);
+    using StringPropertySetterCallback = bool (*)(jsi::Runtime&, const jsi::Object& instance, const std::string& name,
+                                                  const jsi::Value& value);
+    using StringPropertyEnumeratorCallback = std::vector<std::string> (*)(jsi::Runtime&, const jsi::Object& instance);
+};
+
+template <typename ClassType>
+class ObjectWrap;
+
+} // namespace hermes
+} // namespace realm
+
+#include "js_types.hpp"
+
+namespace realm {
+namespace hermes {
+
+using String = js::String<Types>;
+using Context = js::Context<Types>;
+using Value = js::Value<Types>;
+using Function = js::Function<Types>;
+using Object = js::Object<Types>;
+using Exception = js::Exception<Types>;
+using ReturnValue = js::ReturnValue<Types>;
+
+} // namespace hermes
+} // namespace realm
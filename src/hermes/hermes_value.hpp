@@ -0,0 +1,442 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "hermes_types.hpp"
+#include "hermes_string.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace realm {
+namespace hermes {
+
+// Looks up a constructor on the global object, e.g. Date or ArrayBuffer.
+inline jsi::Function global_constructor(jsi::Runtime& rt, const char* name)
+{
+    return rt.global().getPropertyAsFunction(rt, name);
+}
+
+// Looks up a constructor hung off the global Realm constructor (the BSON
+// re-exports: Realm.Decimal128, Realm._ObjectId, Realm._UUID).
+inline jsi::Function realm_constructor(jsi::Runtime& rt, const char* name)
+{
+    return rt.global()
+        .getPropertyAsObject(rt, "Realm")
+        .getPropertyAsFunction(rt, name);
+}
+
+inline bool instance_of_global(jsi::Runtime& rt, const jsi::Value& value, const char* constructor)
+{
+    if (!value.isObject()) {
+        return false;
+    }
+    return value.getObject(rt).instanceOf(rt, global_constructor(rt, constructor));
+}
+
+inline bool instance_of_realm_type(jsi::Runtime& rt, const jsi::Value& value, const char* constructor)
+{
+    if (!value.isObject()) {
+        return false;
+    }
+    jsi::Value realm = rt.global().getProperty(rt, "Realm");
+    if (!realm.isObject()) {
+        return false;
+    }
+    jsi::Value ctor = realm.getObject(rt).getProperty(rt, constructor);
+    if (!ctor.isObject() || !ctor.getObject(rt).isFunction(rt)) {
+        return false;
+    }
+    return value.getObject(rt).instanceOf(rt, ctor.getObject(rt).getFunction(rt));
+}
+
+} // namespace hermes
+
+namespace js {
+
+template <>
+inline bool hermes::Value::is_valid(const ValueType& value)
+{
+    return value != nullptr;
+}
+
+template <>
+inline const char* hermes::Value::typeof(jsi::Runtime* rt, const ValueType& value)
+{
+    if (value->isUndefined()) {
+        return "undefined";
+    }
+    if (value->isNull()) {
+        return "object";
+    }
+    if (value->isBool()) {
+        return "boolean";
+    }
+    if (value->isNumber()) {
+        return "number";
+    }
+    if (value->isString()) {
+        return "string";
+    }
+    if (value->isSymbol()) {
+        return "symbol";
+    }
+    if (value->getObject(*rt).isFunction(*rt)) {
+        return "function";
+    }
+    return "object";
+}
+
+template <>
+inline bool hermes::Value::is_undefined(jsi::Runtime*, const ValueType& value)
+{
+    return value->isUndefined();
+}
+
+template <>
+inline bool hermes::Value::is_null(jsi::Runtime*, const ValueType& value)
+{
+    return value->isNull();
+}
+
+template <>
+inline bool hermes::Value::is_boolean(jsi::Runtime*, const ValueType& value)
+{
+    return value->isBool();
+}
+
+template <>
+inline bool hermes::Value::is_number(jsi::Runtime*, const ValueType& value)
+{
+    return value->isNumber();
+}
+
+template <>
+inline bool hermes::Value::is_string(jsi::Runtime*, const ValueType& value)
+{
+    return value->isString();
+}
+
+template <>
+inline bool hermes::Value::is_object(jsi::Runtime*, const ValueType& value)
+{
+    return value->isObject();
+}
+
+template <>
+inline bool hermes::Value::is_function(jsi::Runtime* rt, const ValueType& value)
+{
+    return value->isObject() && value->getObject(*rt).isFunction(*rt);
+}
+
+template <>
+inline bool hermes::Value::is_constructor(jsi::Runtime* rt, const ValueType& value)
+{
+    // JSI has no constructability check; every function is assumed
+    // constructible, as on the node backend.
+    return hermes::Value::is_function(rt, value);
+}
+
+template <>
+inline bool hermes::Value::is_array(jsi::Runtime* rt, const ValueType& value)
+{
+    return value->isObject() && value->getObject(*rt).isArray(*rt);
+}
+
+template <>
+inline bool hermes::Value::is_array_buffer(jsi::Runtime* rt, const ValueType& value)
+{
+    return value->isObject() && value->getObject(*rt).isArrayBuffer(*rt);
+}
+
+template <>
+inline bool hermes::Value::is_array_buffer_view(jsi::Runtime* rt, const ValueType& value)
+{
+    jsi::Function is_view = hermes::global_constructor(*rt, "ArrayBuffer").getPropertyAsFunction(*rt, "isView");
+    return is_view.call(*rt, *value).getBool();
+}
+
+template <>
+inline bool hermes::Value::is_binary(jsi::Runtime* rt, const ValueType& value)
+{
+    return hermes::Value::is_array_buffer(rt, value) || hermes::Value::is_array_buffer_view(rt, value);
+}
+
+template <>
+inline bool hermes::Value::is_date(jsi::Runtime* rt, const ValueType& value)
+{
+    return hermes::instance_of_global(*rt, *value, "Date");
+}
+
+template <>
+inline bool hermes::Value::is_error(jsi::Runtime* rt, const ValueType& value)
+{
+    return hermes::instance_of_global(*rt, *value, "Error");
+}
+
+template <>
+inline bool hermes::Value::is_decimal128(jsi::Runtime* rt, const ValueType& value)
+{
+    return hermes::instance_of_realm_type(*rt, *value, "_Decimal128");
+}
+
+template <>
+inline bool hermes::Value::is_object_id(jsi::Runtime* rt, const ValueType& value)
+{
+    return hermes::instance_of_realm_type(*rt, *value, "_ObjectId");
+}
+
+template <>
+inline bool hermes::Value::is_uuid(jsi::Runtime* rt, const ValueType& value)
+{
+    return hermes::instance_of_realm_type(*rt, *value, "_UUID");
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Value::from_boolean(jsi::Runtime*, bool boolean)
+{
+    return hermes::protect(jsi::Value(boolean));
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Value::from_null(jsi::Runtime*)
+{
+    return hermes::protect(jsi::Value(nullptr));
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Value::from_undefined(jsi::Runtime*)
+{
+    return hermes::protect(jsi::Value());
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Value::from_number(jsi::Runtime*, double number)
+{
+    return hermes::protect(jsi::Value(number));
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Value::from_nonnull_string(jsi::Runtime* rt,
+                                                                        const hermes::String& string)
+{
+    return hermes::protect(jsi::Value(*rt, string.to_jsi(*rt)));
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Value::from_nonnull_binary(jsi::Runtime* rt, BinaryData data)
+{
+    jsi::Object buffer = hermes::global_constructor(*rt, "ArrayBuffer")
+                             .callAsConstructor(*rt, double(data.size()))
+                             .getObject(*rt);
+    if (data.size()) {
+        std::memcpy(buffer.getArrayBuffer(*rt).data(*rt), data.data(), data.size());
+    }
+    return hermes::protect(jsi::Value(*rt, buffer));
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Value::from_decimal128(jsi::Runtime* rt, const Decimal128& value)
+{
+    jsi::Function ctor = hermes::realm_constructor(*rt, "_Decimal128");
+    return hermes::protect(
+        ctor.getPropertyAsFunction(*rt, "fromString").call(*rt, jsi::String::createFromUtf8(*rt, value.to_string())));
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Value::from_object_id(jsi::Runtime* rt, const ObjectId& value)
+{
+    jsi::Function ctor = hermes::realm_constructor(*rt, "_ObjectId");
+    return hermes::protect(ctor.callAsConstructor(*rt, jsi::String::createFromUtf8(*rt, value.to_string())));
+}
+
+template <>
+inline typename hermes::Types::Value hermes::Value::from_uuid(jsi::Runtime* rt, const UUID& value)
+{
+    jsi::Function ctor = hermes::realm_constructor(*rt, "_UUID");
+    return hermes::protect(ctor.callAsConstructor(*rt, jsi::String::createFromUtf8(*rt, value.to_string())));
+}
+
+template <>
+inline bool hermes::Value::to_boolean(jsi::Runtime* rt, const ValueType& value)
+{
+    // JSI exposes no ToBoolean; this is the spec coercion by hand.
+    if (value->isBool()) {
+        return value->getBool();
+    }
+    if (value->isUndefined() || value->isNull()) {
+        return false;
+    }
+    if (value->isNumber()) {
+        double number = value->getNumber();
+        return number != 0 && !std::isnan(number);
+    }
+    if (value->isString()) {
+        return !value->getString(*rt).utf8(*rt).empty();
+    }
+    return true;
+}
+
+template <>
+inline double hermes::Value::to_number(jsi::Runtime* rt, const ValueType& value)
+{
+    double number;
+    if (value->isNumber()) {
+        number = value->getNumber();
+    }
+    else {
+        number = hermes::global_constructor(*rt, "Number").call(*rt, *value).asNumber();
+    }
+    if (std::isnan(number)) {
+        throw std::invalid_argument(
+            util::format("Value '%1' not convertible to a number.", (std::string)to_string(rt, value)));
+    }
+    return number;
+}
+
+template <>
+inline hermes::String hermes::Value::to_string(jsi::Runtime* rt, const ValueType& value)
+{
+    return value->toString(*rt).utf8(*rt);
+}
+
+template <>
+inline void hermes::Value::to_string_buffer(jsi::Runtime* rt, const ValueType& value, std::string& out)
+{
+    out = value->toString(*rt).utf8(*rt);
+}
+
+template <>
+inline typename hermes::Types::Object hermes::Value::to_object(jsi::Runtime* rt, const ValueType& value)
+{
+    if (!value->isObject()) {
+        // Match the JSC backend: coercing a primitive wraps it via Object().
+        return hermes::protect(hermes::global_constructor(*rt, "Object").call(*rt, *value).getObject(*rt));
+    }
+    return hermes::protect(value->getObject(*rt));
+}
+
+template <>
+inline typename hermes::Types::Object hermes::Value::to_array(jsi::Runtime* rt, const ValueType& value)
+{
+    return hermes::Value::to_object(rt, value);
+}
+
+template <>
+inline typename hermes::Types::Object hermes::Value::to_date(jsi::Runtime* rt, const ValueType& value)
+{
+    if (value->isString()) {
+        jsi::Function date_ctor = hermes::global_constructor(*rt, "Date");
+        return hermes::protect(date_ctor.callAsConstructor(*rt, *value).getObject(*rt));
+    }
+    return hermes::Value::to_object(rt, value);
+}
+
+template <>
+inline typename hermes::Types::Function hermes::Value::to_function(jsi::Runtime* rt, const ValueType& value)
+{
+    if (!hermes::Value::is_function(rt, value)) {
+        throw std::invalid_argument("Value is not a function.");
+    }
+    return hermes::protect(value->getObject(*rt));
+}
+
+template <>
+inline typename hermes::Types::Function hermes::Value::to_constructor(jsi::Runtime* rt, const ValueType& value)
+{
+    return hermes::Value::to_function(rt, value);
+}
+
+template <>
+inline OwnedBinaryData hermes::Value::to_binary(jsi::Runtime* rt, const ValueType& value)
+{
+    jsi::Object object = value->getObject(*rt);
+    jsi::ArrayBuffer buffer = [&] {
+        if (object.isArrayBuffer(*rt)) {
+            return object.getArrayBuffer(*rt);
+        }
+        return object.getPropertyAsObject(*rt, "buffer").getArrayBuffer(*rt);
+    }();
+
+    size_t byte_offset = 0;
+    size_t byte_length = buffer.size(*rt);
+    if (!object.isArrayBuffer(*rt)) {
+        byte_offset = size_t(object.getProperty(*rt, "byteOffset").asNumber());
+        byte_length = size_t(object.getProperty(*rt, "byteLength").asNumber());
+    }
+
+    auto data = std::make_unique<char[]>(byte_length);
+    if (byte_length) {
+        std::memcpy(data.get(), buffer.data(*rt) + byte_offset, byte_length);
+    }
+    return OwnedBinaryData(std::move(data), byte_length);
+}
+
+template <>
+inline BinaryData hermes::Value::to_binary_view(jsi::Runtime* rt, const ValueType& value, OwnedBinaryData&)
+{
+    // JSI exposes the ArrayBuffer's backing store directly, so the view can
+    // alias JS memory with no copy; it stays valid while the buffer handle
+    // is alive in the current scope.
+    jsi::Object object = value->getObject(*rt);
+    if (object.isArrayBuffer(*rt)) {
+        jsi::ArrayBuffer buffer = object.getArrayBuffer(*rt);
+        return BinaryData(reinterpret_cast<const char*>(buffer.data(*rt)), buffer.size(*rt));
+    }
+    jsi::ArrayBuffer buffer = object.getPropertyAsObject(*rt, "buffer").getArrayBuffer(*rt);
+    size_t byte_offset = size_t(object.getProperty(*rt, "byteOffset").asNumber());
+    size_t byte_length = size_t(object.getProperty(*rt, "byteLength").asNumber());
+    return BinaryData(reinterpret_cast<const char*>(buffer.data(*rt)) + byte_offset, byte_length);
+}
+
+template <>
+inline Decimal128 hermes::Value::to_decimal128(jsi::Runtime* rt, const ValueType& value)
+{
+    jsi::Object object = value->getObject(*rt);
+    jsi::Value ejson = object.getProperty(*rt, "$numberDecimal");
+    std::string string = ejson.isString()
+                             ? ejson.getString(*rt).utf8(*rt)
+                             : object.getPropertyAsFunction(*rt, "toString").callWithThis(*rt, object).getString(*rt).utf8(*rt);
+    return Decimal128(StringData(string));
+}
+
+template <>
+inline ObjectId hermes::Value::to_object_id(jsi::Runtime* rt, const ValueType& value)
+{
+    jsi::Object object = value->getObject(*rt);
+    jsi::Value ejson = object.getProperty(*rt, "$oid");
+    std::string string = ejson.isString()
+                             ? ejson.getString(*rt).utf8(*rt)
+                             : object.getPropertyAsFunction(*rt, "toHexString").callWithThis(*rt, object).getString(*rt).utf8(*rt);
+    return ObjectId(string.c_str());
+}
+
+template <>
+inline UUID hermes::Value::to_uuid(jsi::Runtime* rt, const ValueType& value)
+{
+    jsi::Object object = value->getObject(*rt);
+    jsi::Value ejson = object.getProperty(*rt, "$uuid");
+    std::string string = ejson.isString()
+                             ? ejson.getString(*rt).utf8(*rt)
+                             : object.getPropertyAsFunction(*rt, "toHexString").callWithThis(*rt, object).getString(*rt).utf8(*rt);
+    return UUID(string.c_str());
+}
+
+} // namespace js
+} // namespace realm
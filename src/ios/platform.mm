@@ -24,6 +24,9 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#include <sys/clonefile.h>
+#include <cerrno>
+
 #import <Foundation/Foundation.h>
 
 static NSString *error_description(NSError *error) {
@@ -100,8 +103,19 @@ void copy_bundled_realm_files()
                     continue;
                 }
 
+                NSString *sourcePath = [resourcePath stringByAppendingPathComponent:path];
+
+                // The app bundle and Documents live on the same APFS volume,
+                // so a copy-on-write clone installs the seed file in constant
+                // time instead of streaming its bytes. Cross-volume setups
+                // (and pre-APFS filesystems) report EXDEV/ENOTSUP and fall
+                // back to the byte copy below.
+                if (clonefile(sourcePath.fileSystemRepresentation, docsPath.fileSystemRepresentation, 0) == 0) {
+                    continue;
+                }
+
                 NSError *error = nil;
-                if (![manager copyItemAtPath:[resourcePath stringByAppendingPathComponent:path] toPath:docsPath error:&error]) {
+                if (![manager copyItemAtPath:sourcePath toPath:docsPath error:&error]) {
                     throw std::runtime_error(util::format("Failed to copy file from \"%1\" to \"%2\": %3",
                                                           path.UTF8String, docsPath.UTF8String, error_description(error).UTF8String));
                 }
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <map>
 #include <optional>
 
 #include <realm/object-store/sync/generic_network_transport.hpp>
@@ -58,6 +59,21 @@ public:
     SharedApp m_app;
 };
 
+// Repeated `new Realm.App(...)` with the same configuration is common when
+// dependency-injected services each construct their own handle. Core already
+// caches the App by id, but reaching it still meant building a fresh network
+// transport and dispatcher per construction; this cache keys on the full
+// configuration so a repeat construction reuses the existing App — and its
+// JavaScriptNetworkTransport — outright, while a changed baseUrl or timeout
+// takes the full path. Apps are constructed on the JS thread only, so the
+// cache is thread-confined; entries hold weak references and age out when
+// their slot is next touched.
+static inline std::map<std::string, std::weak_ptr<app::App>>& app_fingerprint_cache()
+{
+    static thread_local std::map<std::string, std::weak_ptr<app::App>> s_cache;
+    return s_cache;
+}
+
 template <typename T>
 class AppClass : public ClassDefinition<T, realm::js::App<T>> {
     using ContextType = typename T::Context;
@@ -115,6 +131,7 @@ public:
                                        {"allUsers", {wrap<get_all_users>, nullptr}}};
 
     static void log_in(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void log_in_many(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void switch_user(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void remove_user(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void delete_user(ContextType, ObjectType, Arguments&, ReturnValue&);
@@ -130,6 +147,7 @@ public:
 
     MethodMap<T> const methods = {
         {"_logIn", wrap<log_in>},
+        {"_logInMany", wrap<log_in_many>},
         {"switchUser", wrap<switch_user>},
         {"_removeUser", wrap<remove_user>},
         {"_deleteUser", wrap<delete_user>},
@@ -218,6 +236,31 @@ void AppClass<T>::constructor(ContextType ctx, ObjectType this_object, Arguments
         throw std::runtime_error("Expected either a configuration object or an app id string.");
     }
 
+    // Everything that distinguishes one App construction from another is in
+    // the scalar config fields parsed above, so they fingerprint the config
+    // exactly. '\0' separators keep "ab"+"c" and "a"+"bc" distinct.
+    std::string fingerprint = config.app_id;
+    fingerprint.push_back('\0');
+    fingerprint.append(config.base_url.value_or(""));
+    fingerprint.push_back('\0');
+    if (config.default_request_timeout_ms) {
+        fingerprint.append(std::to_string(*config.default_request_timeout_ms));
+    }
+    fingerprint.push_back('\0');
+    fingerprint.append(config.local_app_name.value_or(""));
+    fingerprint.push_back('\0');
+    fingerprint.append(config.local_app_version.value_or(""));
+
+    auto& cache = app_fingerprint_cache();
+    auto it = cache.find(fingerprint);
+    if (it != cache.end()) {
+        if (SharedApp cached_app = it->second.lock()) {
+            set_internal<T, AppClass<T>>(ctx, this_object, new realm::js::App<T>(cached_app));
+            return;
+        }
+        cache.erase(it);
+    }
+
     config.transport = AppClass<T>::transport_generator(Protected(Context::get_global_context(ctx)),
                                                         NetworkTransport::make_dispatcher());
 
@@ -234,6 +277,7 @@ void AppClass<T>::constructor(ContextType ctx, ObjectType this_object, Arguments
     client_config.user_agent_binding_info = get_user_agent();
 
     SharedApp app = app::App::get_shared_app(config, client_config);
+    cache[std::move(fingerprint)] = app;
 
     set_internal<T, AppClass<T>>(ctx, this_object, new realm::js::App<T>(app));
 }
@@ -272,6 +316,84 @@ void AppClass<T>::log_in(ContextType ctx, ObjectType this_object, Arguments& arg
                                      }));
 }
 
+template <typename T>
+void AppClass<T>::log_in_many(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(2);
+
+    auto app = get_internal<T, AppClass<T>>(ctx, this_object)->m_app;
+
+    auto credentials_array = Value::validated_to_array(ctx, args[0], "credentials");
+    auto callback_function = Value::validated_to_function(ctx, args[1]);
+
+    uint32_t count = Object::validated_get_length(ctx, credentials_array);
+    std::vector<app::AppCredentials> all_credentials;
+    all_credentials.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        auto credentials_object =
+            Value::validated_to_object(ctx, Object::get_property(ctx, credentials_array, i), "credentials");
+        all_credentials.push_back(*get_internal<T, CredentialsClass<T>>(ctx, credentials_object));
+    }
+
+    // All logins are handed to the transport up front so the requests overlap
+    // on the network instead of being awaited one at a time, and the JS
+    // callback runs once with every user instead of waking the event loop per
+    // login. Completion handlers arrive on the event loop, so no locking is
+    // needed around the shared state.
+    struct BatchState {
+        Protected<typename T::GlobalContext> ctx;
+        Protected<ObjectType> this_object;
+        Protected<FunctionType> callback;
+        SharedApp app;
+        size_t remaining;
+        std::vector<SharedUser> users;
+        std::optional<app::AppError> first_error;
+    };
+    auto state = std::shared_ptr<BatchState>(
+        new BatchState{Protected(Context<T>::get_global_context(ctx)), Protected(ctx, this_object),
+                       Protected(ctx, callback_function), app, count, std::vector<SharedUser>(count), std::nullopt});
+
+    if (count == 0) {
+        Function::callback(ctx, callback_function, this_object,
+                           {Object::create_array(ctx, {}), Value::from_undefined(ctx)});
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        app->log_in_with_credentials(
+            all_credentials[i], [state, i](SharedUser user, util::Optional<app::AppError> error) {
+                if (error) {
+                    if (!state->first_error) {
+                        state->first_error = *error;
+                    }
+                }
+                else {
+                    state->users[i] = std::move(user);
+                }
+                if (--state->remaining > 0) {
+                    return;
+                }
+
+                HANDLESCOPE(state->ctx)
+                if (state->first_error) {
+                    Function::callback(state->ctx, state->callback, state->this_object,
+                                       {Value::from_undefined(state->ctx),
+                                        Object::create_from_optional_app_error(state->ctx, state->first_error)});
+                    return;
+                }
+                std::vector<ValueType> user_objects;
+                user_objects.reserve(state->users.size());
+                for (auto& user : state->users) {
+                    user_objects.push_back(
+                        UserClass<T>::create_instance(state->ctx, std::move(user), state->app));
+                }
+                Function::callback(state->ctx, state->callback, state->this_object,
+                                   {Object::create_array(state->ctx, user_objects),
+                                    Value::from_undefined(state->ctx)});
+            });
+    }
+}
+
 template <typename T>
 void AppClass<T>::get_all_users(ContextType ctx, ObjectType this_object, ReturnValue& return_value)
 {
@@ -359,6 +481,10 @@ template <typename T>
 void AppClass<T>::clear_app_cache(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
     args.validate_count(0);
+    // JS-held App objects can keep an entry lockable after core's cache is
+    // cleared, so drop the fingerprint cache too — tests clearing state
+    // expect the next construction to build a fresh App.
+    app_fingerprint_cache().clear();
     realm::app::App::clear_cached_apps();
 }
 
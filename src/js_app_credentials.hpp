@@ -21,12 +21,36 @@
 #include <stdexcept>
 #include "js_class.hpp"
 #include <realm/object-store/sync/app_credentials.hpp>
+#include <realm/util/optional.hpp>
 
 namespace realm {
 namespace js {
 
+// AppCredentials is immutable once constructed, so the JSON payload handed to
+// core on every login can be serialized once and reused; server processes
+// re-authenticating many short-lived sessions with the same credentials
+// object otherwise redo the BSON-to-JSON conversion per login.
+class Credentials : public app::AppCredentials {
+public:
+    Credentials(app::AppCredentials credentials)
+        : app::AppCredentials(std::move(credentials))
+    {
+    }
+
+    const std::string& payload_json()
+    {
+        if (!m_payload_json) {
+            m_payload_json = serialize_as_json();
+        }
+        return *m_payload_json;
+    }
+
+private:
+    util::Optional<std::string> m_payload_json;
+};
+
 template <typename T>
-class CredentialsClass : public ClassDefinition<T, realm::app::AppCredentials> {
+class CredentialsClass : public ClassDefinition<T, Credentials> {
     using ContextType = typename T::Context;
     using FunctionType = typename T::Function;
     using ObjectType = typename T::Object;
@@ -87,7 +111,7 @@ void CredentialsClass<T>::facebook(ContextType ctx, ObjectType, Arguments& argum
     realm::app::AppCredentialsToken token = Value::validated_to_string(ctx, arguments[0]);
 
     auto credentials = realm::app::AppCredentials::facebook(token);
-    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new app::AppCredentials(credentials)));
+    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new Credentials(std::move(credentials))));
 }
 
 template <typename T>
@@ -97,7 +121,7 @@ void CredentialsClass<T>::anonymous(ContextType ctx, ObjectType this_object, Arg
     arguments.validate_maximum(0);
 
     auto credentials = realm::app::AppCredentials::anonymous();
-    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new app::AppCredentials(credentials)));
+    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new Credentials(std::move(credentials))));
 }
 
 template <typename T>
@@ -109,7 +133,7 @@ void CredentialsClass<T>::apple(ContextType ctx, ObjectType this_object, Argumen
     realm::app::AppCredentialsToken token = Value::validated_to_string(ctx, arguments[0]);
 
     auto credentials = realm::app::AppCredentials::apple(token);
-    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new app::AppCredentials(credentials)));
+    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new Credentials(std::move(credentials))));
 }
 
 template <typename T>
@@ -152,7 +176,7 @@ void CredentialsClass<T>::google(ContextType ctx, ObjectType this_object, Argume
     };
 
     app::AppCredentials credentials = decode_arg(arguments[0]);
-    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new app::AppCredentials(credentials)));
+    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new Credentials(std::move(credentials))));
 }
 
 template <typename T>
@@ -164,7 +188,7 @@ void CredentialsClass<T>::jwt(ContextType ctx, ObjectType this_object, Arguments
     realm::app::AppCredentialsToken token = Value::validated_to_string(ctx, arguments[0]);
 
     auto credentials = realm::app::AppCredentials::custom(token);
-    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new app::AppCredentials(credentials)));
+    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new Credentials(std::move(credentials))));
 }
 
 template <typename T>
@@ -177,7 +201,7 @@ void CredentialsClass<T>::email_password(ContextType ctx, ObjectType this_object
     const std::string password = Value::validated_to_string(ctx, arguments[1], "password");
 
     auto credentials = realm::app::AppCredentials::username_password(email, password);
-    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new app::AppCredentials(credentials)));
+    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new Credentials(std::move(credentials))));
 }
 
 template <typename T>
@@ -191,7 +215,7 @@ void CredentialsClass<T>::function(ContextType ctx, ObjectType this_object, Argu
         throw std::invalid_argument("payload must be a json object");
 
     auto credentials = realm::app::AppCredentials::function(payload_bson.operator const bson::BsonDocument&());
-    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new app::AppCredentials(credentials)));
+    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new Credentials(std::move(credentials))));
 }
 
 template <typename T>
@@ -202,7 +226,7 @@ void CredentialsClass<T>::user_api_key(ContextType ctx, ObjectType this_object,
     const std::string user_api_key = Value::validated_to_string(ctx, arguments[0], "user API key");
 
     auto credentials = realm::app::AppCredentials::user_api_key(user_api_key);
-    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new app::AppCredentials(credentials)));
+    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new Credentials(std::move(credentials))));
 }
 template <typename T>
 void CredentialsClass<T>::server_api_key(ContextType ctx, ObjectType this_object, Arguments& arguments,
@@ -212,7 +236,7 @@ void CredentialsClass<T>::server_api_key(ContextType ctx, ObjectType this_object
     const std::string server_api_key = Value::validated_to_string(ctx, arguments[0], "server API key");
 
     auto credentials = realm::app::AppCredentials::server_api_key(server_api_key);
-    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new app::AppCredentials(credentials)));
+    return_value.set(create_object<T, CredentialsClass<T>>(ctx, new Credentials(std::move(credentials))));
 }
 
 template <typename T>
@@ -229,7 +253,7 @@ template <typename T>
 void CredentialsClass<T>::get_payload(ContextType ctx, ObjectType this_object, ReturnValue& return_value)
 {
     auto credentials = get_internal<T, CredentialsClass<T>>(ctx, this_object);
-    return_value.set(Value::from_string(ctx, credentials->serialize_as_json()));
+    return_value.set(Value::from_string(ctx, credentials->payload_json()));
 }
 
 } // namespace js
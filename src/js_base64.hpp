@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <realm/string_data.hpp>
+#include <realm/util/base64.hpp>
+#include <realm/util/optional.hpp>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define REALM_JS_BASE64_SSSE3 1
+#include <immintrin.h>
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define REALM_JS_BASE64_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace realm {
+namespace js {
+
+// Vectorized base64 with the same contracts as the scalar routines in
+// realm/util/base64.hpp, for the binding's bulk paths: EJSON conversion of
+// binary property values and the RPC debug channel. The kernels are the
+// Muła/Lemire SIMD algorithms — SSSE3 on x86-64 (runtime-detected; every
+// 64-bit x86 CPU of the last decade has it) and NEON on arm64 — and handle
+// only canonical input: the standard alphabet, length a multiple of four,
+// trailing '=' padding. Anything else, and any platform without a kernel,
+// falls through to realm::util, so observable behavior for edge cases is
+// exactly the scalar codec's.
+namespace base64 {
+namespace _impl {
+
+#if REALM_JS_BASE64_SSSE3
+
+inline bool cpu_has_ssse3()
+{
+    static const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+    return has_ssse3;
+}
+
+// Encodes as many 12-byte groups as allow a full 16-byte load to stay in
+// bounds, writing 16 chars per group; returns input bytes consumed.
+__attribute__((target("ssse3"))) inline size_t encode_bulk(const unsigned char* in, size_t size, char* out)
+{
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m128i offsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+    size_t consumed = 0;
+    while (size - consumed >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + consumed));
+        chunk = _mm_shuffle_epi8(chunk, shuffle);
+        // Split each 24-bit group into four 6-bit indices.
+        __m128i t0 = _mm_and_si128(chunk, _mm_set1_epi32(0x0fc0fc00));
+        __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        __m128i t2 = _mm_and_si128(chunk, _mm_set1_epi32(0x003f03f0));
+        __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        __m128i indices = _mm_or_si128(t1, t3);
+        // Translate indices to ASCII with a 14-entry offset table.
+        __m128i reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        reduced = _mm_sub_epi8(reduced, _mm_cmpgt_epi8(indices, _mm_set1_epi8(25)));
+        __m128i ascii = _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, reduced));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), ascii);
+        consumed += 12;
+        out += 16;
+    }
+    return consumed;
+}
+
+// Decodes `blocks` 16-char groups of canonical, unpadded base64 into 12
+// bytes each; writes in 16-byte stores, so the caller guarantees 4 bytes of
+// slack after the last group. Returns false on any non-alphabet byte.
+__attribute__((target("ssse3"))) inline bool decode_bulk(const unsigned char* in, size_t blocks,
+                                                         unsigned char* out)
+{
+    const __m128i lut_lo =
+        _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lut_hi =
+        _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask_0f = _mm_set1_epi8(0x0f);
+    for (size_t block = 0; block < blocks; block++) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(chunk, 4), mask_0f);
+        __m128i lo_nibbles = _mm_and_si128(chunk, mask_0f);
+        // The two nibble tables share a bit only for valid alphabet bytes.
+        __m128i hit = _mm_and_si128(_mm_shuffle_epi8(lut_lo, lo_nibbles), _mm_shuffle_epi8(lut_hi, hi_nibbles));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(hit, _mm_setzero_si128())) != 0xFFFF) {
+            return false;
+        }
+        __m128i eq_slash = _mm_cmpeq_epi8(chunk, _mm_set1_epi8(0x2f));
+        __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_slash, hi_nibbles));
+        __m128i sextets = _mm_add_epi8(chunk, roll);
+        // Pack four 6-bit values per group back into three bytes.
+        __m128i merged = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+        __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        packed = _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), packed);
+        in += 16;
+        out += 12;
+    }
+    return true;
+}
+
+#elif REALM_JS_BASE64_NEON
+
+inline uint8x16_t translate_encode(uint8x16_t indices)
+{
+    const uint8x16_t offsets = {65,  71,  0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+                                0xfc, 0xfc, 0xfc, 0xfc, 0xed, 0xf0, 0,   0};
+    uint8x16_t reduced = vqsubq_u8(indices, vdupq_n_u8(51));
+    reduced = vsubq_u8(reduced, vcgtq_u8(indices, vdupq_n_u8(25)));
+    return vaddq_u8(indices, vqtbl1q_u8(offsets, reduced));
+}
+
+// Encodes as many 48-byte groups as fit, 64 chars each, using the
+// deinterleaving loads; returns input bytes consumed.
+inline size_t encode_bulk(const unsigned char* in, size_t size, char* out)
+{
+    size_t consumed = 0;
+    while (size - consumed >= 48) {
+        uint8x16x3_t bytes = vld3q_u8(in + consumed);
+        uint8x16x4_t ascii;
+        ascii.val[0] = translate_encode(vshrq_n_u8(bytes.val[0], 2));
+        ascii.val[1] = translate_encode(
+            vorrq_u8(vshlq_n_u8(vandq_u8(bytes.val[0], vdupq_n_u8(0x03)), 4), vshrq_n_u8(bytes.val[1], 4)));
+        ascii.val[2] = translate_encode(
+            vorrq_u8(vshlq_n_u8(vandq_u8(bytes.val[1], vdupq_n_u8(0x0f)), 2), vshrq_n_u8(bytes.val[2], 6)));
+        ascii.val[3] = translate_encode(vandq_u8(bytes.val[2], vdupq_n_u8(0x3f)));
+        vst4q_u8(reinterpret_cast<uint8_t*>(out), ascii);
+        consumed += 48;
+        out += 64;
+    }
+    return consumed;
+}
+
+// Decodes one vector of base64 chars to sextets; ORs validation failures
+// into `invalid` (nonzero lanes mark non-alphabet bytes).
+inline uint8x16_t translate_decode(uint8x16_t chars, uint8x16_t& invalid)
+{
+    const uint8x16_t lut_lo = {0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                               0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A};
+    const uint8x16_t lut_hi = {0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                               0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10};
+    const uint8x16_t lut_roll = {0, 16, 19, 4, 0xbf, 0xbf, 0xb9, 0xb9, 0, 0, 0, 0, 0, 0, 0, 0};
+    uint8x16_t hi_nibbles = vshrq_n_u8(chars, 4);
+    uint8x16_t lo_nibbles = vandq_u8(chars, vdupq_n_u8(0x0f));
+    uint8x16_t hit = vandq_u8(vqtbl1q_u8(lut_lo, lo_nibbles), vqtbl1q_u8(lut_hi, hi_nibbles));
+    invalid = vorrq_u8(invalid, vceqq_u8(hit, vdupq_n_u8(0)));
+    uint8x16_t eq_slash = vceqq_u8(chars, vdupq_n_u8(0x2f));
+    uint8x16_t roll = vqtbl1q_u8(lut_roll, vaddq_u8(eq_slash, hi_nibbles));
+    return vaddq_u8(chars, roll);
+}
+
+// Decodes `blocks` 64-char groups of canonical, unpadded base64 into 48
+// bytes each. Returns false on any non-alphabet byte.
+inline bool decode_bulk(const unsigned char* in, size_t blocks, unsigned char* out)
+{
+    for (size_t block = 0; block < blocks; block++) {
+        uint8x16x4_t chars = vld4q_u8(in);
+        uint8x16_t invalid = vdupq_n_u8(0);
+        uint8x16_t s0 = translate_decode(chars.val[0], invalid);
+        uint8x16_t s1 = translate_decode(chars.val[1], invalid);
+        uint8x16_t s2 = translate_decode(chars.val[2], invalid);
+        uint8x16_t s3 = translate_decode(chars.val[3], invalid);
+        if (vmaxvq_u8(invalid) != 0) {
+            return false;
+        }
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(s0, 2), vshrq_n_u8(s1, 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(s1, 4), vshrq_n_u8(s2, 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(s2, 6), s3);
+        vst3q_u8(out, bytes);
+        in += 64;
+        out += 48;
+    }
+    return true;
+}
+
+#endif // REALM_JS_BASE64_NEON
+
+// 6-bit value for an alphabet byte, -1 otherwise; used for the scalar quads
+// the kernels leave behind.
+inline int decode_char(unsigned char c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if (c == '+')
+        return 62;
+    if (c == '/')
+        return 63;
+    return -1;
+}
+
+} // namespace _impl
+
+/// Drop-in for util::base64_encode. `out_size` must hold
+/// util::base64_encoded_size(size) bytes or the call degrades to the scalar
+/// routine and its error behavior.
+inline size_t encode(const char* data, size_t size, char* out, size_t out_size)
+{
+    if (out_size < util::base64_encoded_size(size)) {
+        return util::base64_encode(data, size, out, out_size);
+    }
+    size_t consumed = 0;
+#if REALM_JS_BASE64_SSSE3
+    if (_impl::cpu_has_ssse3()) {
+        consumed = _impl::encode_bulk(reinterpret_cast<const unsigned char*>(data), size, out);
+    }
+#elif REALM_JS_BASE64_NEON
+    consumed = _impl::encode_bulk(reinterpret_cast<const unsigned char*>(data), size, out);
+#endif
+    size_t written = consumed / 3 * 4;
+    // The scalar routine finishes the sub-group tail and writes the padding.
+    written += util::base64_encode(data + consumed, size - consumed, out + written, out_size - written);
+    return written;
+}
+
+/// Drop-in for util::base64_decode. Canonical input takes the vectorized
+/// path; anything else — embedded whitespace, missing padding, a short
+/// output buffer — is handed to the scalar routine unchanged.
+inline util::Optional<size_t> decode(StringData input, char* out, size_t out_size)
+{
+    size_t size = input.size();
+    if (size == 0 || size % 4 != 0 || out_size < util::base64_decoded_size(size)) {
+        return util::base64_decode(input, out, out_size);
+    }
+    const unsigned char* in = reinterpret_cast<const unsigned char*>(input.data());
+
+    // The last quad is excluded from the bulk kernels since it may carry
+    // padding; everything before it must be pure alphabet bytes.
+    size_t bulk_chars = 0;
+#if REALM_JS_BASE64_SSSE3
+    if (_impl::cpu_has_ssse3()) {
+        size_t blocks = (size - 4) / 16;
+        // Each 16-char group decodes to 12 bytes but is written with a
+        // 16-byte store, so the last group needs 4 bytes of slack after the
+        // bulk output. A buffer sized exactly base64_decoded_size() falls
+        // 1 byte short of that when size % 16 == 4; shrink the bulk run to
+        // what fits and let the scalar quad loop absorb the rest.
+        if (blocks > 0 && blocks * 12 + 4 > out_size) {
+            blocks = (out_size - 4) / 12;
+        }
+        if (!_impl::decode_bulk(in, blocks, reinterpret_cast<unsigned char*>(out))) {
+            return util::base64_decode(input, out, out_size);
+        }
+        bulk_chars = blocks * 16;
+    }
+#elif REALM_JS_BASE64_NEON
+    size_t blocks = (size - 4) / 64;
+    if (!_impl::decode_bulk(in, blocks, reinterpret_cast<unsigned char*>(out))) {
+        return util::base64_decode(input, out, out_size);
+    }
+    bulk_chars = blocks * 64;
+#endif
+
+    size_t out_pos = bulk_chars / 4 * 3;
+    for (size_t in_pos = bulk_chars; in_pos < size; in_pos += 4) {
+        int c0 = _impl::decode_char(in[in_pos]);
+        int c1 = _impl::decode_char(in[in_pos + 1]);
+        if (c0 < 0 || c1 < 0) {
+            return util::base64_decode(input, out, out_size);
+        }
+        int c2 = _impl::decode_char(in[in_pos + 2]);
+        int c3 = _impl::decode_char(in[in_pos + 3]);
+        bool final_quad = in_pos + 4 == size;
+        if (c2 < 0 || c3 < 0) {
+            // Padding is only valid in the final quad, as "xx==" or "xxx=".
+            bool valid_padding = final_quad && in[in_pos + 3] == '=' && (c2 >= 0 || in[in_pos + 2] == '=');
+            if (!valid_padding) {
+                return util::base64_decode(input, out, out_size);
+            }
+        }
+        out[out_pos++] = static_cast<char>(c0 << 2 | c1 >> 4);
+        if (c2 >= 0) {
+            out[out_pos++] = static_cast<char>((c1 & 0x0f) << 4 | c2 >> 2);
+        }
+        if (c3 >= 0) {
+            out[out_pos++] = static_cast<char>((c2 & 0x03) << 6 | c3);
+        }
+    }
+    return out_pos;
+}
+
+/// Drop-in for util::base64_decode_to_vector.
+inline util::Optional<std::vector<char>> decode_to_vector(StringData encoded)
+{
+    std::vector<char> buffer(util::base64_decoded_size(encoded.size()));
+    if (auto size = decode(encoded, buffer.data(), buffer.size())) {
+        buffer.resize(*size);
+        return buffer;
+    }
+    return util::none;
+}
+
+} // namespace base64
+} // namespace js
+} // namespace realm
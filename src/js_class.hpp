@@ -18,8 +18,11 @@
 
 #pragma once
 
-#include <map>
+#include <algorithm>
+#include <initializer_list>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "js_types.hpp"
@@ -27,6 +30,84 @@
 namespace realm {
 namespace js {
 
+/// Markers for declaring a method's expected arguments as template
+/// parameters of Arguments::validate. AnyArgument accepts every value and
+/// compiles to no per-argument check; the typed markers map onto the
+/// corresponding Value<T>::is_* predicate.
+struct AnyArgument;
+struct ArrayArgument;
+struct BooleanArgument;
+struct FunctionArgument;
+struct NumberArgument;
+struct ObjectArgument;
+struct StringArgument;
+
+/// Wraps a trailing marker to allow the argument to be omitted or passed as
+/// undefined.
+template <typename Spec>
+struct Optional;
+
+namespace _impl {
+
+template <typename Spec>
+struct ArgumentOptionality {
+    static constexpr bool optional = false;
+    using Inner = Spec;
+};
+
+template <typename Spec>
+struct ArgumentOptionality<Optional<Spec>> {
+    static constexpr bool optional = true;
+    using Inner = Spec;
+};
+
+template <typename T, typename Spec>
+struct ArgumentCheck;
+
+template <typename T>
+struct ArgumentCheck<T, AnyArgument> {
+    static constexpr const char* type_name = "value";
+    static bool matches(typename T::Context, const typename T::Value&) noexcept
+    {
+        return true;
+    }
+};
+
+#define ARGUMENT_CHECK(Marker, type)                                                                                 \
+    template <typename T>                                                                                            \
+    struct ArgumentCheck<T, Marker> {                                                                                \
+        static constexpr const char* type_name = #type;                                                              \
+        static bool matches(typename T::Context ctx, const typename T::Value& value)                                 \
+        {                                                                                                            \
+            return Value<T>::is_##type(ctx, value);                                                                  \
+        }                                                                                                            \
+    };
+
+ARGUMENT_CHECK(ArrayArgument, array)
+ARGUMENT_CHECK(BooleanArgument, boolean)
+ARGUMENT_CHECK(FunctionArgument, function)
+ARGUMENT_CHECK(NumberArgument, number)
+ARGUMENT_CHECK(ObjectArgument, object)
+ARGUMENT_CHECK(StringArgument, string)
+
+#undef ARGUMENT_CHECK
+
+constexpr bool optionals_trail(std::initializer_list<bool> optionals)
+{
+    bool seen_optional = false;
+    for (bool optional : optionals) {
+        if (optional) {
+            seen_optional = true;
+        }
+        else if (seen_optional) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace _impl
+
 template <typename T>
 struct Arguments {
     const typename T::Context ctx;
@@ -64,6 +145,68 @@ struct Arguments {
                 util::format("Invalid arguments: expected between %1 and %2, but %3 supplied.", min, max, count));
         }
     }
+
+    /// Validates against a signature declared as template parameters:
+    ///
+    ///     args.validate<ObjectArgument, Optional<StringArgument>>();
+    ///
+    /// The arity bounds are computed at compile time, so the hot path is a
+    /// single range check plus one predicate per typed argument (none for
+    /// AnyArgument); the util::format calls building an error message are
+    /// only instantiated in the cold failure branches. The error messages
+    /// match those of the imperative validate_* helpers above, which remain
+    /// for call sites whose argument handling is too dynamic to declare.
+    template <typename... Spec>
+    void validate() const
+    {
+        constexpr size_t max = sizeof...(Spec);
+        constexpr size_t min = (size_t(0) + ... + (_impl::ArgumentOptionality<Spec>::optional ? 0 : 1));
+        static_assert(_impl::optionals_trail({_impl::ArgumentOptionality<Spec>::optional...}),
+                      "Optional arguments must come after all required arguments.");
+        if (count < min || count > max) {
+            throw_invalid_count(min, max);
+        }
+        size_t index = 0;
+        ((validate_argument<Spec>(index), ++index), ...);
+        static_cast<void>(index);
+    }
+
+private:
+    template <typename Spec>
+    void validate_argument(size_t index) const
+    {
+        using Optionality = _impl::ArgumentOptionality<Spec>;
+        using Check = _impl::ArgumentCheck<T, typename Optionality::Inner>;
+        if constexpr (std::is_same_v<typename Optionality::Inner, AnyArgument>) {
+            return;
+        }
+        else {
+            if (index >= count) {
+                return; // an omitted trailing optional
+            }
+            if (Optionality::optional && Value<T>::is_undefined(ctx, value[index])) {
+                return;
+            }
+            if (!Check::matches(ctx, value[index])) {
+                throw TypeErrorException(util::format("Argument %1", index + 1).c_str(), Check::type_name,
+                                         Value<T>::to_string(ctx, value[index]));
+            }
+        }
+    }
+
+    [[noreturn]] void throw_invalid_count(size_t min, size_t max) const
+    {
+        if (min == 0) {
+            throw std::invalid_argument(
+                util::format("Invalid arguments: at most %1 expected, but %2 supplied.", max, count));
+        }
+        if (min == max) {
+            throw std::invalid_argument(
+                util::format("Invalid arguments: %1 expected, but %2 supplied.", max, count));
+        }
+        throw std::invalid_argument(
+            util::format("Invalid arguments: expected between %1 and %2, but %3 supplied.", min, max, count));
+    }
 };
 
 template <typename T>
@@ -106,11 +249,65 @@ struct StringPropertyType {
     typename T::StringPropertyEnumeratorCallback enumerator;
 };
 
+/// Method and property tables for a class definition. Entries are written in
+/// brace-initializer form in the class definitions and sorted once by name at
+/// construction, so they live contiguously instead of in std::map nodes.
+/// Iteration yields (name, value) pairs in lexicographic order, matching the
+/// std::map these tables replaced.
+template <typename V>
+class StringTable {
+public:
+    using value_type = std::pair<std::string, V>;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    StringTable() = default;
+    StringTable(std::initializer_list<value_type> entries)
+        : m_entries(entries)
+    {
+        std::sort(m_entries.begin(), m_entries.end(), [](const value_type& a, const value_type& b) {
+            return a.first < b.first;
+        });
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return m_entries.begin();
+    }
+    const_iterator end() const noexcept
+    {
+        return m_entries.end();
+    }
+    bool empty() const noexcept
+    {
+        return m_entries.empty();
+    }
+    size_t size() const noexcept
+    {
+        return m_entries.size();
+    }
+
+    /// Binary-searches for `name`; returns nullptr when absent.
+    const V* find(const std::string& name) const noexcept
+    {
+        auto it = std::lower_bound(m_entries.begin(), m_entries.end(), name,
+                                   [](const value_type& entry, const std::string& key) {
+                                       return entry.first < key;
+                                   });
+        if (it == m_entries.end() || it->first != name) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+private:
+    std::vector<value_type> m_entries;
+};
+
 template <typename T>
-using MethodMap = std::map<std::string, typename T::FunctionCallback>;
+using MethodMap = StringTable<typename T::FunctionCallback>;
 
 template <typename T>
-using PropertyMap = std::map<std::string, PropertyType<T>>;
+using PropertyMap = StringTable<PropertyType<T>>;
 
 template <typename T, typename U, typename V = void>
 struct ClassDefinition {
@@ -22,6 +22,9 @@
 #include "js_types.hpp"
 #include "js_observable.hpp"
 
+#include <memory>
+#include <optional>
+#include <vector>
 #include <realm/object-store/collection_notifications.hpp>
 #include <realm/object-store/object.hpp>
 #include <realm/object-store/object_changeset.hpp>
@@ -38,6 +41,65 @@ struct RealmObjectClass;
 // Empty class that merely serves as useful type for now.
 class Collection {};
 
+// Version-stamped size cache embedded in the collection wrappers. Outside a
+// write transaction a collection's size can only change when the read version
+// advances, so `.length` reads in loop conditions cost a version compare
+// instead of a view re-validation per iteration. Inside a write transaction
+// every read goes to core, since sizes change mid-transaction without any
+// version bump.
+class CollectionSizeCache {
+public:
+    template <typename F>
+    size_t get(const std::shared_ptr<realm::Realm>& realm, F&& compute)
+    {
+        // No caching without a read transaction to stamp against (computing
+        // the size will begin one as a side effect).
+        if (realm->is_in_transaction() || !realm->is_in_read_transaction()) {
+            return compute();
+        }
+        auto version = realm->read_transaction_version().version;
+        if (!m_version || *m_version != version) {
+            m_size = compute();
+            m_version = version;
+        }
+        return m_size;
+    }
+
+private:
+    std::optional<uint64_t> m_version;
+    size_t m_size = 0;
+};
+
+// Backs the `version` property on the collection wrappers: a monotonically
+// increasing integer that advances whenever the collection's contents may
+// have changed, so JS memoization layers can replace a listener registration
+// (or a deep compare) with a single integer compare per read. The counter is
+// stamped against the Realm's read transaction version — the same signal
+// `CollectionSizeCache` keys on — so it can over-report (any commit bumps
+// it, related or not) but never under-reports. Inside a write transaction,
+// or before a read transaction exists, there is no version to stamp against,
+// so every read bumps: callers see "maybe changed", never a stale
+// "unchanged".
+class CollectionVersionTracker {
+public:
+    uint32_t get(const std::shared_ptr<realm::Realm>& realm)
+    {
+        if (realm->is_in_transaction() || !realm->is_in_read_transaction()) {
+            return ++m_counter;
+        }
+        auto version = realm->read_transaction_version().version;
+        if (!m_version || *m_version != version) {
+            ++m_counter;
+            m_version = version;
+        }
+        return m_counter;
+    }
+
+private:
+    std::optional<uint64_t> m_version;
+    uint32_t m_counter = 0;
+};
+
 template <typename T>
 struct CollectionClass : ClassDefinition<T, Collection, ObservableClass<T>> {
     using ContextType = typename T::Context;
@@ -48,10 +110,50 @@ struct CollectionClass : ClassDefinition<T, Collection, ObservableClass<T>> {
 
     std::string const name = "Collection";
 
+    /**
+     * @brief A `CollectionChangeSet` flattened into the exact buffers the JS
+     * change object is built from.
+     * Core computes change sets on its background notifier thread, but the
+     * `IndexSet` trees it hands to the callback still had to be walked on the
+     * JS thread, once per delivery. Flattening happens once when the
+     * notification arrives; boxing the result is then a handful of
+     * `Uint32Array` constructions from contiguous memory.
+     */
+    struct PrecomputedChangeSet {
+        std::vector<uint32_t> deletions;
+        std::vector<uint32_t> insertions;
+        std::vector<uint32_t> modifications;
+        std::vector<uint32_t> modifications_new;
+        bool collection_cleared = false;
+
+        PrecomputedChangeSet(const CollectionChangeSet& change_set)
+        {
+            if (change_set.deletions.count() == std::numeric_limits<size_t>::max()) {
+                collection_cleared = true;
+            }
+            else {
+                flatten(change_set.deletions, deletions);
+            }
+            flatten(change_set.insertions, insertions);
+            flatten(change_set.modifications, modifications);
+            flatten(change_set.modifications_new, modifications_new);
+        }
+
+    private:
+        static void flatten(realm::IndexSet const& index_set, std::vector<uint32_t>& out)
+        {
+            out.reserve(index_set.count());
+            for (auto index : index_set.as_indexes()) {
+                out.push_back(static_cast<uint32_t>(index));
+            }
+        }
+    };
+
     static inline ValueType create_collection_change_set(ContextType ctx, StringData object_type,
                                                          const ObjectChangeSet& change_set,
                                                          realm::SharedRealm old_realm, realm::SharedRealm new_realm);
     static inline ValueType create_collection_change_set(ContextType ctx, const CollectionChangeSet& change_set);
+    static inline ValueType create_collection_change_set(ContextType ctx, const PrecomputedChangeSet& change_set);
 };
 
 template <typename T>
@@ -101,27 +203,28 @@ template <typename T>
 typename T::Value CollectionClass<T>::create_collection_change_set(ContextType ctx,
                                                                    const CollectionChangeSet& change_set)
 {
-    ObjectType object = Object::create_empty(ctx);
-    std::vector<ValueType> scratch;
-    auto make_array = [&](realm::IndexSet const& index_set) {
-        scratch.clear();
-        scratch.reserve(index_set.count());
-        for (auto index : index_set.as_indexes()) {
-            scratch.push_back(Value::from_number(ctx, index));
-        }
-        return Object::create_array(ctx, scratch);
-    };
+    return create_collection_change_set(ctx, PrecomputedChangeSet(change_set));
+}
 
-    if (change_set.deletions.count() == std::numeric_limits<size_t>::max()) {
+template <typename T>
+typename T::Value CollectionClass<T>::create_collection_change_set(ContextType ctx,
+                                                                   const PrecomputedChangeSet& change_set)
+{
+    ObjectType object = Object::create_empty(ctx);
+    // Indices go out as Uint32Arrays built from native memory in one engine
+    // call — a 10k-row sync integration would otherwise allocate 10k boxed
+    // Numbers per index vector.
+    if (change_set.collection_cleared) {
         Object::set_property(ctx, object, "deletions", Object::create_array(ctx, {Value::from_null(ctx)}));
     }
     else {
-        Object::set_property(ctx, object, "deletions", make_array(change_set.deletions));
+        Object::set_property(ctx, object, "deletions", Object::create_uint32_array(ctx, change_set.deletions));
     }
-    Object::set_property(ctx, object, "insertions", make_array(change_set.insertions));
-    Object::set_property(ctx, object, "newModifications", make_array(change_set.modifications_new));
+    Object::set_property(ctx, object, "insertions", Object::create_uint32_array(ctx, change_set.insertions));
+    Object::set_property(ctx, object, "newModifications",
+                         Object::create_uint32_array(ctx, change_set.modifications_new));
 
-    auto old_modifications = make_array(change_set.modifications);
+    auto old_modifications = Object::create_uint32_array(ctx, change_set.modifications);
     Object::set_property(ctx, object, "modifications", old_modifications);
     Object::set_property(ctx, object, "oldModifications", old_modifications);
 
@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "js_class.hpp"
+#include "js_types.hpp"
+#include "js_results.hpp"
+
+#include <realm/object-store/keypath_helpers.hpp>
+#include <realm/object-store/results.hpp>
+#include <realm/parser/query_parser.hpp>
+
+#include <optional>
+#include <string>
+
+namespace realm {
+namespace js {
+
+template <typename>
+class NativeAccessor;
+
+// Holder behind Realm.compileQuery — everything about a query that can be
+// resolved once and reused per execution: the object schema, the key-path
+// mapping and, for argument-free queries, the fully parsed Query with its
+// ordering. Core's parser bakes bound argument values into the Query it
+// produces, so parameterized executions still parse, but they skip the
+// schema lookup, mapping population and argument-count plumbing that
+// filtered() pays on every call; argument-free executions are parse-free
+// after the first run.
+template <typename T>
+class CompiledQuery {
+public:
+    CompiledQuery(SharedRealm realm, ObjectSchema object_schema, std::string query_string,
+                  query_parser::KeyPathMapping mapping)
+        : realm(std::move(realm))
+        , object_schema(std::move(object_schema))
+        , query_string(std::move(query_string))
+        , mapping(std::move(mapping))
+    {
+    }
+
+    SharedRealm realm;
+    ObjectSchema object_schema;
+    std::string query_string;
+    query_parser::KeyPathMapping mapping;
+
+    // Parse-free fast path for argument-free executions, filled on first run.
+    std::optional<realm::Query> query;
+    realm::DescriptorOrdering ordering;
+    bool has_ordering = false;
+};
+
+template <typename T>
+class CompiledQueryClass : public ClassDefinition<T, CompiledQuery<T>> {
+    using ContextType = typename T::Context;
+    using FunctionType = typename T::Function;
+    using ObjectType = typename T::Object;
+    using ValueType = typename T::Value;
+    using Value = js::Value<T>;
+    using Object = js::Object<T>;
+    using ReturnValue = js::ReturnValue<T>;
+    using Arguments = js::Arguments<T>;
+
+public:
+    const std::string name = "CompiledQuery";
+
+    static ObjectType create_instance(ContextType, SharedRealm, const ObjectSchema&, std::string query_string);
+
+    static void run(ContextType, ObjectType, Arguments&, ReturnValue&);
+
+    static void get_object_type(ContextType, ObjectType, ReturnValue&);
+    static void get_query_string(ContextType, ObjectType, ReturnValue&);
+
+    MethodMap<T> const methods = {
+        {"run", wrap<run>},
+    };
+
+    PropertyMap<T> const properties = {
+        {"objectType", {wrap<get_object_type>, nullptr}},
+        {"queryString", {wrap<get_query_string>, nullptr}},
+    };
+};
+
+template <typename T>
+typename T::Object CompiledQueryClass<T>::create_instance(ContextType ctx, SharedRealm realm,
+                                                          const ObjectSchema& object_schema,
+                                                          std::string query_string)
+{
+    query_parser::KeyPathMapping mapping;
+    realm::populate_keypath_mapping(mapping, *realm);
+    return create_object<T, CompiledQueryClass<T>>(
+        ctx, new CompiledQuery<T>(std::move(realm), object_schema, std::move(query_string), std::move(mapping)));
+}
+
+template <typename T>
+void CompiledQueryClass<T>::run(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    auto compiled = get_internal<T, CompiledQueryClass<T>>(ctx, this_object);
+    auto const& realm = compiled->realm;
+    realm->verify_open();
+
+    if (args.count == 0 && compiled->query) {
+        realm::Query query(*compiled->query);
+        if (compiled->has_ordering) {
+            return_value.set(ResultsClass<T>::create_instance(
+                ctx,
+                realm::Results(realm, std::move(query)).apply_ordering(realm::DescriptorOrdering(compiled->ordering))));
+        }
+        else {
+            return_value.set(ResultsClass<T>::create_instance(ctx, realm::Results(realm, std::move(query))));
+        }
+        return;
+    }
+
+    NativeAccessor<T> accessor(ctx, realm, compiled->object_schema);
+    query_parser::ArgumentConverter<ValueType, NativeAccessor<T>> converter(accessor, args.value, args.count);
+
+    auto table = realm->read_group().get_table(compiled->object_schema.table_key);
+    auto query = table->query(compiled->query_string, converter, compiled->mapping);
+    auto ordering = query.get_ordering();
+
+    if (args.count == 0) {
+        compiled->query = query;
+        compiled->ordering = ordering ? *ordering : realm::DescriptorOrdering();
+        compiled->has_ordering = bool(ordering);
+    }
+
+    if (ordering) {
+        return_value.set(ResultsClass<T>::create_instance(
+            ctx, realm::Results(realm, std::move(query)).apply_ordering(std::move(*ordering))));
+    }
+    else {
+        return_value.set(ResultsClass<T>::create_instance(ctx, realm::Results(realm, std::move(query))));
+    }
+}
+
+template <typename T>
+void CompiledQueryClass<T>::get_object_type(ContextType ctx, ObjectType object, ReturnValue& return_value)
+{
+    auto compiled = get_internal<T, CompiledQueryClass<T>>(ctx, object);
+    return_value.set(compiled->object_schema.name);
+}
+
+template <typename T>
+void CompiledQueryClass<T>::get_query_string(ContextType ctx, ObjectType object, ReturnValue& return_value)
+{
+    auto compiled = get_internal<T, CompiledQueryClass<T>>(ctx, object);
+    return_value.set(compiled->query_string);
+}
+
+} // namespace js
+} // namespace realm
@@ -149,6 +149,7 @@ struct DictionaryClass : ClassDefinition<T, realm::js::Dictionary<T>, Collection
     static void remove(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void has(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void keys(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void entries(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void set(ContextType, ObjectType, Arguments&, ReturnValue&);
     // observables
     static void add_listener(ContextType, ObjectType, Arguments&, ReturnValue&);
@@ -167,6 +168,7 @@ struct DictionaryClass : ClassDefinition<T, realm::js::Dictionary<T>, Collection
         {"remove", wrap<remove>},
         {"_has", wrap<has>},
         {"_keys", wrap<keys>},
+        {"_entries", wrap<entries>},
         {"set", wrap<set>},
         {"addListener", wrap<add_listener>},
         {"removeListener", wrap<remove_listener>},
@@ -307,6 +309,31 @@ void DictionaryClass<T>::keys(ContextType ctx, ObjectType this_object, Arguments
     return_value.set(keys);
 }
 
+template <typename T>
+void DictionaryClass<T>::entries(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(0);
+    auto dictionary = get_internal<T, DictionaryClass<T>>(ctx, this_object);
+
+    // All key/value pairs are materialized in one call so readers don't pay
+    // one native crossing (and one proxy trap) per key.
+    std::vector<ValueType> key_vector;
+    std::vector<ValueType> value_vector;
+    key_vector.reserve(dictionary->size());
+    value_vector.reserve(dictionary->size());
+
+    auto realm = dictionary->get_realm();
+    for (auto&& [k, v] : *dictionary) {
+        key_vector.push_back(Value::from_string(ctx, k.get_string()));
+        value_vector.push_back(Value::from_mixed(ctx, realm, v));
+    }
+
+    return_value.set(Object::create_obj(ctx, {
+                                                 {"keys", Object::create_array(ctx, key_vector)},
+                                                 {"values", Object::create_array(ctx, value_vector)},
+                                             }));
+}
+
 template <typename T>
 typename T::Value DictionaryClass<T>::create_dictionary_change_set(ContextType ctx,
                                                                    DictionaryChangeSet const& change_set)
@@ -337,16 +364,59 @@ void DictionaryClass<T>::add_listener(ContextType ctx, ObjectType this_object, A
 {
     auto dictionary = get_internal<T, DictionaryClass<T>>(ctx, this_object);
 
-    args.validate_maximum(1);
+    args.validate_maximum(2);
     auto callback = Value::validated_to_function(ctx, args[0]);
+
+    // An optional array of keys restricts the listener to changes of those
+    // entries. The filter is applied natively before any JS work happens, so
+    // a listener watching one key of a large dictionary is not woken — let
+    // alone invoked — by updates to the other keys.
+    std::vector<std::string> key_filter;
+    if (args.count == 2 && !Value::is_undefined(ctx, args[1]) && !Value::is_null(ctx, args[1])) {
+        ObjectType js_keys = Value::validated_to_array(ctx, args[1], "keys");
+        uint32_t length = Object::validated_get_length(ctx, js_keys);
+        key_filter.reserve(length);
+        for (uint32_t i = 0; i < length; i++) {
+            key_filter.push_back(Object::validated_get_string(ctx, js_keys, i, "keys"));
+        }
+    }
+
     Protected<FunctionType> protected_callback(ctx, callback);
     Protected<ObjectType> protected_this(ctx, this_object);
     Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
     auto token = dictionary->add_key_based_notification_callback([=](DictionaryChangeSet const& change_set) {
+        DictionaryChangeSet filtered;
+        const DictionaryChangeSet* effective = &change_set;
+        if (!key_filter.empty()) {
+            bool any_match = false;
+            auto keep_matching = [&](std::vector<Mixed> const& keys, std::vector<Mixed>& out) {
+                for (auto const& key : keys) {
+                    if (!key.is_type(realm::type_String)) {
+                        continue;
+                    }
+                    for (auto const& watched : key_filter) {
+                        if (key.get_string() == StringData(watched)) {
+                            out.push_back(key);
+                            any_match = true;
+                            break;
+                        }
+                    }
+                }
+            };
+            keep_matching(change_set.deletions, filtered.deletions);
+            keep_matching(change_set.insertions, filtered.insertions);
+            keep_matching(change_set.modifications, filtered.modifications);
+            filtered.collection_root_was_deleted = change_set.collection_root_was_deleted;
+            if (!any_match && !filtered.collection_root_was_deleted) {
+                return;
+            }
+            effective = &filtered;
+        }
+
         HANDLESCOPE(protected_ctx)
 
         ValueType arguments[]{DictionaryClass<T>::create_instance(protected_ctx, *dictionary),
-                              DictionaryClass<T>::create_dictionary_change_set(protected_ctx, change_set)};
+                              DictionaryClass<T>::create_dictionary_change_set(protected_ctx, *effective)};
 
         Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, arguments);
     });
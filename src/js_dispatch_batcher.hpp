@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "js_metrics.hpp"
+
+#include <realm/object-store/util/event_loop_dispatcher.hpp>
+#include <realm/util/functional.hpp>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace realm {
+namespace js {
+
+/**
+ * @brief Coalesces cross-thread callbacks into one event-loop wakeup per
+ * scheduling window.
+ *
+ * `util::EventLoopDispatcher` schedules one wakeup per invocation, so a burst
+ * of sync progress/error callbacks turns into a burst of `uv_async` signals.
+ * The batcher instead queues each callback and only wakes the JS thread when
+ * the queue transitions from empty to non-empty; the single wakeup drains
+ * everything that accumulated, including callbacks posted while the drain is
+ * running. Invocation order is preserved.
+ *
+ * One batcher exists per JS thread, created lazily by the first
+ * `BatchedEventLoopDispatcher` constructed there (construction must happen on
+ * the JS thread, same as for the plain dispatcher). Batch depth and queue
+ * latency feed the `Realm._metrics` counters.
+ */
+class DispatchBatcher {
+public:
+    static const std::shared_ptr<DispatchBatcher>& shared_for_this_thread()
+    {
+        static thread_local auto s_batcher = std::make_shared<DispatchBatcher>();
+        return s_batcher;
+    }
+
+    DispatchBatcher()
+        : m_state(std::make_shared<State>())
+        , m_wakeup([state = m_state] {
+            drain(*state);
+        })
+    {
+    }
+
+    /// Callable from any thread. Queues `func` and schedules a wakeup only if
+    /// none is already pending.
+    void post(util::UniqueFunction<void()> func)
+    {
+        bool needs_wakeup;
+        {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            if (m_state->queue.empty()) {
+                m_state->oldest_post = std::chrono::steady_clock::now();
+            }
+            m_state->queue.push_back(std::move(func));
+            needs_wakeup = !m_state->wakeup_pending;
+            m_state->wakeup_pending = true;
+        }
+        metrics::increment(metrics::counters().dispatch_posts);
+        if (needs_wakeup) {
+            metrics::increment(metrics::counters().dispatch_wakeups);
+            m_wakeup();
+        }
+    }
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::vector<util::UniqueFunction<void()>> queue;
+        bool wakeup_pending = false;
+        // Enqueue time of the oldest undrained callback, for the latency counter.
+        std::chrono::steady_clock::time_point oldest_post;
+    };
+
+    static void drain(State& state)
+    {
+        // Re-check after each batch: callbacks that arrived while the batch
+        // ran set wakeup_pending without signalling, and belong to this drain.
+        for (;;) {
+            std::vector<util::UniqueFunction<void()>> batch;
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                if (state.queue.empty()) {
+                    state.wakeup_pending = false;
+                    return;
+                }
+                batch.swap(state.queue);
+                auto waited = std::chrono::steady_clock::now() - state.oldest_post;
+                metrics::increment(metrics::counters().dispatch_queue_nanos,
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count());
+            }
+            for (auto& func : batch) {
+                func();
+            }
+        }
+    }
+
+    std::shared_ptr<State> m_state;
+    util::EventLoopDispatcher<void()> m_wakeup;
+};
+
+template <typename>
+class BatchedEventLoopDispatcher;
+
+/**
+ * @brief Drop-in replacement for `util::EventLoopDispatcher` that routes
+ * invocations through the calling JS thread's `DispatchBatcher`.
+ *
+ * Used for the recurring callbacks — sync errors, transfer progress,
+ * connection-state changes, SSL verification, compaction decisions — where
+ * several invocations commonly land within one scheduling window. One-shot
+ * completions keep the plain dispatcher; there is nothing to coalesce.
+ */
+template <typename... Args>
+class BatchedEventLoopDispatcher<void(Args...)> {
+public:
+    BatchedEventLoopDispatcher(util::UniqueFunction<void(Args...)> func)
+        : m_func(std::make_shared<util::UniqueFunction<void(Args...)>>(std::move(func)))
+        , m_batcher(DispatchBatcher::shared_for_this_thread())
+    {
+    }
+
+    const util::UniqueFunction<void(Args...)>& func() const
+    {
+        return *m_func;
+    }
+
+    void operator()(Args... args)
+    {
+        m_batcher->post([func = m_func, args = std::make_tuple(std::move(args)...)]() mutable {
+            std::apply(*func, std::move(args));
+        });
+    }
+
+private:
+    std::shared_ptr<util::UniqueFunction<void(Args...)>> m_func;
+    std::shared_ptr<DispatchBatcher> m_batcher;
+};
+
+} // namespace js
+} // namespace realm
@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#include <cinttypes>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/mman.h>
+#endif
+
+namespace realm {
+namespace js {
+namespace io_hints {
+
+/// How an application expects to read a Realm file. `WillNeed` asks the
+/// kernel to prefetch the whole file up front; `Sequential` and `Random`
+/// tune readahead for full scans and point lookups respectively.
+enum class AccessPattern {
+    Random,
+    Sequential,
+    WillNeed,
+};
+
+inline AccessPattern parse_access_pattern(const std::string& name)
+{
+    if (name == "random") {
+        return AccessPattern::Random;
+    }
+    if (name == "sequential") {
+        return AccessPattern::Sequential;
+    }
+    if (name == "willneed") {
+        return AccessPattern::WillNeed;
+    }
+    throw std::invalid_argument("accessPattern must be 'sequential', 'willneed' or 'random', got '" + name + "'.");
+}
+
+/// Applies `pattern` to every live mapping of the file at `path`.
+///
+/// The mappings belong to core, so there is no address to madvise directly;
+/// on Linux and Android they are located by scanning /proc/self/maps for the
+/// file's resolved path. Mappings created after the call start with the
+/// kernel default again, which is why the hint is re-applied per operation
+/// rather than only at open. Platforms without procfs are a no-op: the hint
+/// is strictly advisory and its absence only costs the default readahead
+/// behavior.
+inline void apply_access_pattern(const std::string& path, AccessPattern pattern)
+{
+#if defined(__linux__)
+    if (path.empty()) {
+        return;
+    }
+    // /proc/self/maps records the resolved path, so follow symlinks first.
+    char resolved[PATH_MAX];
+    const char* target = ::realpath(path.c_str(), resolved) ? resolved : path.c_str();
+    size_t target_length = std::strlen(target);
+
+    FILE* maps = std::fopen("/proc/self/maps", "r");
+    if (!maps) {
+        return;
+    }
+
+    int advice;
+    switch (pattern) {
+        case AccessPattern::Sequential:
+            advice = MADV_SEQUENTIAL;
+            break;
+        case AccessPattern::WillNeed:
+            advice = MADV_WILLNEED;
+            break;
+        default:
+            advice = MADV_RANDOM;
+            break;
+    }
+
+    // Lines look like "start-end perms offset dev inode  /path/to/file\n".
+    char line[PATH_MAX + 128];
+    while (std::fgets(line, sizeof(line), maps)) {
+        char* name = std::strchr(line, '/');
+        if (!name) {
+            continue;
+        }
+        size_t name_length = std::strcspn(name, "\n");
+        if (name_length != target_length || std::strncmp(name, target, target_length) != 0) {
+            continue;
+        }
+        uintptr_t start, end;
+        if (std::sscanf(line, "%" SCNxPTR "-%" SCNxPTR, &start, &end) != 2) {
+            continue;
+        }
+        // A failed madvise is just a missed hint; nothing to report.
+        ::madvise(reinterpret_cast<void*>(start), end - start, advice);
+    }
+    std::fclose(maps);
+#else
+    static_cast<void>(path);
+    static_cast<void>(pattern);
+#endif
+}
+
+} // namespace io_hints
+} // namespace js
+} // namespace realm
@@ -45,6 +45,8 @@ public:
     }
 
     notifications::NotificationHandle<T, NotificationToken> m_notification_handle;
+    CollectionSizeCache m_size_cache;
+    CollectionVersionTracker m_version_tracker;
 };
 
 template <typename T>
@@ -64,6 +66,7 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
 
     // properties
     static void get_length(ContextType, ObjectType, ReturnValue&);
+    static void get_version(ContextType, ObjectType, ReturnValue&);
     static void get_type(ContextType, ObjectType, ReturnValue&);
     static void get_optional(ContextType, ObjectType, ReturnValue&);
     static void get_index(ContextType, ObjectType, uint32_t, ReturnValue&);
@@ -75,12 +78,16 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
     static void unshift(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void shift(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void splice(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void move(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void swap(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void snapshot(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void filtered(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void sorted(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void is_valid(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void is_empty(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void index_of(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void to_values(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void replace_all(ContextType, ObjectType, Arguments&, ReturnValue&);
 
     // observable
     static void add_listener(ContextType, ObjectType, Arguments&, ReturnValue&);
@@ -95,12 +102,16 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
         {"unshift", wrap<unshift>},
         {"shift", wrap<shift>},
         {"splice", wrap<splice>},
+        {"move", wrap<move>},
+        {"swap", wrap<swap>},
         {"snapshot", wrap<snapshot>},
         {"filtered", wrap<filtered>},
         {"sorted", wrap<sorted>},
         {"isValid", wrap<is_valid>},
         {"isEmpty", wrap<is_empty>},
         {"indexOf", wrap<index_of>},
+        {"toValues", wrap<to_values>},
+        {"replaceAll", wrap<replace_all>},
         {"min", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Min>>},
         {"max", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Max>>},
         {"sum", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Sum>>},
@@ -112,6 +123,7 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
 
     PropertyMap<T> const properties = {
         {"length", {wrap<get_length>, nullptr}},
+        {"version", {wrap<get_version>, nullptr}},
         {"type", {wrap<get_type>, nullptr}},
         {"optional", {wrap<get_optional>, nullptr}},
     };
@@ -120,6 +132,7 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
 
 private:
     static void validate_value(ContextType, realm::List&, ValueType);
+    static std::vector<ValueType> validated_value_batch(ContextType, realm::List&, ValueType array_value);
 };
 
 template <typename T>
@@ -132,21 +145,30 @@ template <typename T>
 void ListClass<T>::get_length(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
     auto list = get_internal<T, ListClass<T>>(ctx, object);
-    return_value.set(static_cast<uint32_t>(list->size()));
+    return_value.set(static_cast<uint32_t>(list->m_size_cache.get(list->get_realm(), [&] {
+        return list->size();
+    })));
+}
+
+template <typename T>
+void ListClass<T>::get_version(ContextType ctx, ObjectType object, ReturnValue& return_value)
+{
+    auto list = get_internal<T, ListClass<T>>(ctx, object);
+    return_value.set(list->m_version_tracker.get(list->get_realm()));
 }
 
 template <typename T>
 void ListClass<T>::get_type(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
     auto list = get_internal<T, ListClass<T>>(ctx, object);
-    return_value.set(local_string_for_property_type(list->get_type() & ~realm::PropertyType::Flags));
+    return_value.set_string_view(local_string_for_property_type(list->get_type() & ~realm::PropertyType::Flags));
 }
 
 template <typename T>
 void ListClass<T>::get_optional(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
     auto list = get_internal<T, ListClass<T>>(ctx, object);
-    return_value.set(is_nullable(list->get_type()));
+    return_value.set_bool(is_nullable(list->get_type()));
 }
 
 template <typename T>
@@ -154,7 +176,7 @@ void ListClass<T>::get_index(ContextType ctx, ObjectType object, uint32_t index,
 {
     auto list = get_internal<T, ListClass<T>>(ctx, object);
     NativeAccessor<T> accessor(ctx, *list);
-    return_value.set(list->get(accessor, index));
+    return_value.set_prewrapped(list->get(accessor, index));
 }
 
 template <typename T>
@@ -171,6 +193,21 @@ template <typename T>
 void ListClass<T>::push(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
     auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+
+    // Fast path: push(array) appends the array's elements through a single
+    // pass, resolving the element type once instead of per element. Mixed
+    // lists are excluded since an array is a legal element value for them.
+    if (args.count == 1 && Value::is_array(ctx, args[0]) &&
+        (list->get_type() & ~realm::PropertyType::Flags) != realm::PropertyType::Mixed) {
+        auto values = validated_value_batch(ctx, *list, args[0]);
+        NativeAccessor<T> accessor(ctx, *list);
+        for (auto const& value : values) {
+            list->add(accessor, value);
+        }
+        return_value.set((uint32_t)list->size());
+        return;
+    }
+
     for (size_t i = 0; i < args.count; i++) {
         validate_value(ctx, *list, args[i]);
     }
@@ -186,7 +223,7 @@ void ListClass<T>::push(ContextType ctx, ObjectType this_object, Arguments& args
 template <typename T>
 void ListClass<T>::pop(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
-    args.validate_maximum(0);
+    args.validate<>();
 
     auto list = get_internal<T, ListClass<T>>(ctx, this_object);
     auto size = static_cast<unsigned int>(list->size());
@@ -219,7 +256,7 @@ void ListClass<T>::unshift(ContextType ctx, ObjectType this_object, Arguments& a
 template <typename T>
 void ListClass<T>::shift(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
-    args.validate_maximum(0);
+    args.validate<>();
 
     auto list = get_internal<T, ListClass<T>>(ctx, this_object);
     if (list->size() == 0) {
@@ -266,12 +303,55 @@ void ListClass<T>::splice(ContextType ctx, ObjectType this_object, Arguments& ar
     return_value.set(Object::create_array(ctx, removed_objects));
 }
 
+template <typename T>
+void ListClass<T>::move(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate<NumberArgument, NumberArgument>();
+
+    auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+    list->verify_in_transaction();
+    size_t size = list->size();
+    long from = Value::validated_to_number(ctx, args[0], "from");
+    long to = Value::validated_to_number(ctx, args[1], "to");
+    if (from < 0 || static_cast<size_t>(from) >= size) {
+        throw std::out_of_range(util::format("Index %1 is outside of range 0..%2.", from, size - 1));
+    }
+    if (to < 0 || static_cast<size_t>(to) >= size) {
+        throw std::out_of_range(util::format("Index %1 is outside of range 0..%2.", to, size - 1));
+    }
+
+    // Core's move primitive reorders in place and reports a single move
+    // entry in the change-set, unlike a splice which reports a deletion
+    // and an insertion and shifts storage twice.
+    list->move(from, to);
+}
+
+template <typename T>
+void ListClass<T>::swap(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate<NumberArgument, NumberArgument>();
+
+    auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+    list->verify_in_transaction();
+    size_t size = list->size();
+    long index1 = Value::validated_to_number(ctx, args[0], "index1");
+    long index2 = Value::validated_to_number(ctx, args[1], "index2");
+    if (index1 < 0 || static_cast<size_t>(index1) >= size) {
+        throw std::out_of_range(util::format("Index %1 is outside of range 0..%2.", index1, size - 1));
+    }
+    if (index2 < 0 || static_cast<size_t>(index2) >= size) {
+        throw std::out_of_range(util::format("Index %1 is outside of range 0..%2.", index2, size - 1));
+    }
+
+    list->swap(index1, index2);
+}
+
 template <typename T>
 void ListClass<T>::snapshot(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
-    args.validate_maximum(0);
+    args.validate<>();
     auto list = get_internal<T, ListClass<T>>(ctx, this_object);
-    return_value.set(ResultsClass<T>::create_instance(ctx, list->snapshot()));
+    return_value.set(ResultsClass<T>::create_snapshot(ctx, list->as_results()));
 }
 
 template <typename T>
@@ -285,7 +365,7 @@ template <typename T>
 void ListClass<T>::sorted(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
     auto list = get_internal<T, ListClass<T>>(ctx, this_object);
-    return_value.set(ResultsClass<T>::create_instance(ctx, list->sort(ResultsClass<T>::get_keypaths(ctx, args))));
+    return_value.set(ResultsClass<T>::create_instance(ctx, ResultsClass<T>::sort_collection(ctx, *list, args)));
 }
 
 template <typename T>
@@ -311,6 +391,50 @@ void ListClass<T>::index_of(ContextType ctx, ObjectType this_object, Arguments&
     ResultsClass<T>::index_of(ctx, fn, args, return_value);
 }
 
+template <typename T>
+void ListClass<T>::to_values(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate<Optional<NumberArgument>, Optional<NumberArgument>>();
+
+    auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+    size_t size = list->size();
+    size_t start = 0, end = size;
+    if (args.count > 0 && !Value::is_undefined(ctx, args[0])) {
+        start = std::min<size_t>(Value::validated_to_number(ctx, args[0], "start"), size);
+    }
+    if (args.count > 1 && !Value::is_undefined(ctx, args[1])) {
+        end = std::min<size_t>(Value::validated_to_number(ctx, args[1], "end"), size);
+    }
+    if (end < start) {
+        end = start;
+    }
+
+    NativeAccessor<T> accessor(ctx, *list);
+    std::vector<ValueType> values;
+    values.reserve(end - start);
+    for (size_t i = start; i < end; ++i) {
+        values.push_back(list->get(accessor, i));
+    }
+    return_value.set(Object::create_array(ctx, values));
+}
+
+template <typename T>
+void ListClass<T>::replace_all(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate<Optional<AnyArgument>>();
+
+    auto list = get_internal<T, ListClass<T>>(ctx, this_object);
+    auto values = validated_value_batch(ctx, *list, args[0]);
+
+    list->remove_all();
+    NativeAccessor<T> accessor(ctx, *list);
+    for (auto const& value : values) {
+        list->add(accessor, value);
+    }
+
+    return_value.set((uint32_t)list->size());
+}
+
 template <typename T>
 void ListClass<T>::add_listener(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
@@ -330,7 +454,7 @@ template <typename T>
 void ListClass<T>::remove_all_listeners(ContextType ctx, ObjectType this_object, Arguments& args,
                                         ReturnValue& return_value)
 {
-    args.validate_maximum(0);
+    args.validate<>();
     auto list = get_internal<T, ListClass<T>>(ctx, this_object);
     NotificationBucket::erase(list->m_notification_handle);
 }
@@ -349,5 +473,33 @@ void ListClass<T>::validate_value(ContextType ctx, realm::List& list, ValueType
     }
 }
 
+template <typename T>
+std::vector<typename T::Value> ListClass<T>::validated_value_batch(ContextType ctx, realm::List& list,
+                                                                   ValueType array_value)
+{
+    ObjectType array = Value::validated_to_array(ctx, array_value, "values");
+    size_t count = Object::validated_get_length(ctx, array);
+
+    // The element type and object schema are resolved once for the whole
+    // batch rather than per element as validate_value does.
+    auto type = list.get_type();
+    StringData object_type;
+    if (type == realm::PropertyType::Object) {
+        object_type = list.get_object_schema().name;
+    }
+
+    std::vector<ValueType> values;
+    values.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        ValueType value = Object::validated_get_property(ctx, array, (uint32_t)i);
+        if (!Value::is_valid_for_property_type(ctx, value, type, object_type)) {
+            throw TypeErrorException("Property", object_type ? object_type : local_string_for_property_type(type),
+                                     Value::to_string(ctx, value));
+        }
+        values.push_back(value);
+    }
+    return values;
+}
+
 } // namespace js
 } // namespace realm
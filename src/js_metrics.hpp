@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace realm::js::metrics {
+
+/**
+ * @brief Always-on counters for the binding's hot paths, exposed to JS as the
+ * `Realm._metrics` snapshot.
+ * Each counter is a relaxed atomic increment — a few nanoseconds, cheap
+ * enough to stay enabled in production — so conversion volume, transaction
+ * durations, notification fan-out and proxy-trap rates can be read without
+ * attaching a profiler.
+ *
+ * @note Counters are process-wide, monotonic and 64-bit; `reset` zeroes them.
+ * Relaxed ordering means a snapshot racing an increment may be off by the
+ * in-flight events, which is fine for rate observation.
+ */
+struct Counters {
+    std::atomic<uint64_t> values_unboxed{0};
+    std::atomic<uint64_t> writes{0};
+    std::atomic<uint64_t> write_nanos{0};
+    std::atomic<uint64_t> commits{0};
+    std::atomic<uint64_t> notifications_delivered{0};
+    std::atomic<uint64_t> proxy_get_traps{0};
+    std::atomic<uint64_t> proxy_set_traps{0};
+    std::atomic<uint64_t> schema_cache_hits{0};
+    std::atomic<uint64_t> schema_cache_misses{0};
+    std::atomic<uint64_t> schema_cache_evictions{0};
+    std::atomic<uint64_t> network_request_attempts{0};
+    std::atomic<uint64_t> network_request_retries{0};
+    std::atomic<uint64_t> network_request_nanos{0};
+    std::atomic<uint64_t> dispatch_posts{0};
+    std::atomic<uint64_t> dispatch_wakeups{0};
+    std::atomic<uint64_t> dispatch_queue_nanos{0};
+    std::atomic<uint64_t> write_lock_waits{0};
+    std::atomic<uint64_t> write_lock_wait_nanos{0};
+    std::atomic<uint64_t> write_lock_max_wait_nanos{0};
+    // Gauge, not a monotonic counter: async write-lock requests currently
+    // queued. Deliberately left out of reset() so an in-flight request can
+    // never drive it negative.
+    std::atomic<uint64_t> write_lock_queue_depth{0};
+
+    void reset()
+    {
+        values_unboxed.store(0, std::memory_order_relaxed);
+        writes.store(0, std::memory_order_relaxed);
+        write_nanos.store(0, std::memory_order_relaxed);
+        commits.store(0, std::memory_order_relaxed);
+        notifications_delivered.store(0, std::memory_order_relaxed);
+        proxy_get_traps.store(0, std::memory_order_relaxed);
+        proxy_set_traps.store(0, std::memory_order_relaxed);
+        schema_cache_hits.store(0, std::memory_order_relaxed);
+        schema_cache_misses.store(0, std::memory_order_relaxed);
+        schema_cache_evictions.store(0, std::memory_order_relaxed);
+        network_request_attempts.store(0, std::memory_order_relaxed);
+        network_request_retries.store(0, std::memory_order_relaxed);
+        network_request_nanos.store(0, std::memory_order_relaxed);
+        dispatch_posts.store(0, std::memory_order_relaxed);
+        dispatch_wakeups.store(0, std::memory_order_relaxed);
+        dispatch_queue_nanos.store(0, std::memory_order_relaxed);
+        write_lock_waits.store(0, std::memory_order_relaxed);
+        write_lock_wait_nanos.store(0, std::memory_order_relaxed);
+        write_lock_max_wait_nanos.store(0, std::memory_order_relaxed);
+    }
+};
+
+// Function-local static rather than a namespace-scope object: this header is
+// included from multiple translation units and must not depend on
+// initialization order.
+inline Counters& counters()
+{
+    static Counters s_counters;
+    return s_counters;
+}
+
+inline void increment(std::atomic<uint64_t>& counter, uint64_t amount = 1)
+{
+    counter.fetch_add(amount, std::memory_order_relaxed);
+}
+
+inline void decrement(std::atomic<uint64_t>& counter, uint64_t amount = 1)
+{
+    counter.fetch_sub(amount, std::memory_order_relaxed);
+}
+
+inline void update_max(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    uint64_t current = counter.load(std::memory_order_relaxed);
+    while (value > current && !counter.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+/// Measures a scope's duration and adds it to `nanos` on destruction.
+class TimedScope {
+public:
+    TimedScope(std::atomic<uint64_t>& nanos)
+        : m_nanos(nanos)
+        , m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~TimedScope()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - m_start;
+        increment(m_nanos, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+private:
+    std::atomic<uint64_t>& m_nanos;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace realm::js::metrics
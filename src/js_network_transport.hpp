@@ -19,8 +19,16 @@
 #pragma once
 
 #include <realm/object-store/sync/generic_network_transport.hpp>
+#include "js_metrics.hpp"
 #include "js_types.hpp"
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
 #include <string>
+#include <thread>
 
 namespace realm {
 namespace js {
@@ -35,6 +43,13 @@ public:
     }
 
     ResponseHandlerCompletionCallback m_completion_callback;
+
+    // Streaming state for chunked delivery (onResponseBegin/Chunk/End). The
+    // RPC transport feeds large bodies through here in fixed-size frames so
+    // no single message over the JSON channel carries the whole payload.
+    int m_status_code = 0;
+    std::map<std::string, std::string> m_headers;
+    std::string m_body;
 };
 
 template <typename T>
@@ -59,10 +74,16 @@ public:
 
     static void on_success(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void on_error(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void on_response_begin(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void on_response_chunk(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void on_response_end(ContextType, ObjectType, Arguments&, ReturnValue&);
 
     MethodMap<T> const methods = {
         {"onSuccess", wrap<on_success>},
         {"onError", wrap<on_error>},
+        {"onResponseBegin", wrap<on_response_begin>},
+        {"onResponseChunk", wrap<on_response_chunk>},
+        {"onResponseEnd", wrap<on_response_end>},
     };
 };
 
@@ -117,12 +138,82 @@ void ResponseHandlerClass<T>::on_success(ContextType ctx, ObjectType this_object
 
     ValueType body_value = Object::get_property(ctx, response_object, response_body);
     if (!Value::is_undefined(ctx, body_value)) {
-        body = Value::validated_to_string(ctx, body_value);
+        if (Value::is_binary(ctx, body_value)) {
+            // ArrayBuffer/typed-array bodies are read straight out of the engine's
+            // buffer, sparing multi-megabyte responses the UTF-8 transcode that a
+            // JS string round-trip would cost.
+            OwnedBinaryData storage;
+            BinaryData data = Value::to_binary_view(ctx, body_value, storage);
+            body.assign(data.data(), data.size());
+        }
+        else {
+            body = Value::validated_to_string(ctx, body_value);
+        }
     }
     response_handler->m_completion_callback(app::Response{http_status_code, custom_status_code, headers, body});
 }
 
 
+// Chunked delivery: the RPC transport announces status and headers up front,
+// then streams the body in fixed-size frames — one RPC message each — and
+// finally completes. Each frame call only returns to the sender once it has
+// been consumed here, so the sender cannot run ahead of the receiver.
+template <typename T>
+void ResponseHandlerClass<T>::on_response_begin(ContextType ctx, ObjectType this_object, Arguments& args,
+                                                ReturnValue& return_value)
+{
+    static const String response_status_code = "statusCode";
+    static const String response_headers = "headers";
+
+    args.validate_count(1);
+
+    auto response_handler = get_internal<T, ResponseHandlerClass<T>>(ctx, this_object);
+    ObjectType response_object = Value::validated_to_object(ctx, args[0]);
+
+    response_handler->m_status_code = 0;
+    response_handler->m_headers.clear();
+    response_handler->m_body.clear();
+
+    ValueType status_code_value = Object::get_property(ctx, response_object, response_status_code);
+    if (!Value::is_undefined(ctx, status_code_value)) {
+        response_handler->m_status_code = static_cast<int>(Value::validated_to_number(ctx, status_code_value));
+    }
+
+    ValueType headers_value = Object::get_property(ctx, response_object, response_headers);
+    if (!Value::is_undefined(ctx, headers_value)) {
+        ObjectType headers_object = Value::validated_to_object(ctx, headers_value);
+        for (auto key : Object::get_property_names(ctx, headers_object)) {
+            ValueType value = Object::get_property(ctx, headers_object, key);
+            std::string value_as_string = Value::validated_to_string(ctx, value);
+            response_handler->m_headers.insert(std::pair<std::string, std::string>(key, value_as_string));
+        }
+    }
+}
+
+template <typename T>
+void ResponseHandlerClass<T>::on_response_chunk(ContextType ctx, ObjectType this_object, Arguments& args,
+                                                ReturnValue& return_value)
+{
+    args.validate_count(1);
+
+    auto response_handler = get_internal<T, ResponseHandlerClass<T>>(ctx, this_object);
+    std::string chunk = Value::validated_to_string(ctx, args[0], "chunk");
+    response_handler->m_body.append(chunk);
+}
+
+template <typename T>
+void ResponseHandlerClass<T>::on_response_end(ContextType ctx, ObjectType this_object, Arguments& args,
+                                              ReturnValue& return_value)
+{
+    args.validate_maximum(0);
+
+    auto response_handler = get_internal<T, ResponseHandlerClass<T>>(ctx, this_object);
+    int custom_status_code = 0;
+    response_handler->m_completion_callback(app::Response{response_handler->m_status_code, custom_status_code,
+                                                          std::move(response_handler->m_headers),
+                                                          std::move(response_handler->m_body)});
+}
+
 template <typename T>
 void ResponseHandlerClass<T>::on_error(ContextType ctx, ObjectType this_object, Arguments& args,
                                        ReturnValue& return_value)
@@ -223,24 +314,110 @@ struct JavaScriptNetworkTransport : public app::GenericNetworkTransport {
     void send_request_to_server(app::Request&& request,
                                 util::UniqueFunction<void(const app::Response&)>&& completion_callback) override
     {
-        m_dispatcher([ctx = m_ctx, request = std::move(request),
-                      completion_callback = std::move(completion_callback)]() mutable {
-            HANDLESCOPE(ctx);
-
-            ObjectType realm_constructor = Value::validated_to_object(ctx, Object::get_global(ctx, "Realm"));
-            ValueType network_transport = Object::get_property(ctx, realm_constructor, "_networkTransport");
-
-            Object::call_method(ctx, Value::to_object(ctx, network_transport), "fetchWithCallbacks",
-                                {
-                                    makeRequest(ctx, request),
-                                    ResponseHandlerClass<T>::create_instance(ctx, std::move(completion_callback)),
-                                });
-        });
+        auto state = std::make_shared<RequestState>(
+            RequestState{m_dispatcher, m_transport_cache, std::move(request), std::move(completion_callback)});
+        dispatch_attempt(m_ctx, std::move(state));
     }
 
 private:
     ContextType m_ctx;
     Dispatcher m_dispatcher;
+    std::shared_ptr<std::optional<Protected<ObjectType>>> m_transport_cache =
+        std::make_shared<std::optional<Protected<ObjectType>>>();
+
+    // Transport failures and throttling/server errors are retried here, below
+    // the object-store completion, so a flaky request costs one marshaling
+    // pass instead of one per attempt: the JS request object (headers and
+    // body included) is built on the first attempt and handed to the
+    // transport verbatim on every retry.
+    static constexpr int s_max_request_attempts = 3;
+    static constexpr std::chrono::milliseconds s_retry_base_delay{250};
+    static constexpr std::chrono::milliseconds s_retry_max_delay{5000};
+
+    // Everything one logical request needs across attempts. Shared by the
+    // queued dispatches and the backoff timer thread, so it outlives the
+    // transport the same way m_transport_cache does.
+    struct RequestState {
+        Dispatcher dispatcher;
+        std::shared_ptr<std::optional<Protected<ObjectType>>> transport_cache;
+        app::Request request;
+        util::UniqueFunction<void(const app::Response&)> completion_callback;
+        std::optional<Protected<ObjectType>> request_object;
+        int attempt = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    };
+
+    static bool should_retry(const app::Response& response)
+    {
+        if (response.custom_status_code != 0) {
+            // Transport-level failure (DNS, reset, timeout) — the classic
+            // flaky-network case.
+            return true;
+        }
+        return response.http_status_code == 429 || response.http_status_code == 500 ||
+               response.http_status_code == 502 || response.http_status_code == 503 ||
+               response.http_status_code == 504;
+    }
+
+    static std::chrono::milliseconds retry_delay(int attempt)
+    {
+        auto backoff = s_retry_base_delay.count() << (attempt - 1);
+        auto capped = std::min<std::chrono::milliseconds::rep>(backoff, s_retry_max_delay.count());
+        // Jitter in [capped/2, capped] decorrelates clients that all lost
+        // connectivity at the same moment without collapsing the backoff.
+        static thread_local std::mt19937_64 s_rng{std::random_device{}()};
+        return std::chrono::milliseconds(
+            std::uniform_int_distribution<std::chrono::milliseconds::rep>(capped / 2, capped)(s_rng));
+    }
+
+    static void dispatch_attempt(ContextType ctx, std::shared_ptr<RequestState> state)
+    {
+        auto& dispatcher = state->dispatcher;
+        dispatcher([ctx, state]() mutable {
+            HANDLESCOPE(ctx);
+
+            // `Realm._networkTransport` is installed once at module load and never
+            // replaced, so resolve it on the first request and reuse the protected
+            // reference afterwards instead of walking the global object every time.
+            // The cache is shared rather than owned so that dispatches still queued
+            // when the transport is destroyed keep it alive.
+            if (!state->transport_cache->has_value()) {
+                ObjectType realm_constructor = Value::validated_to_object(ctx, Object::get_global(ctx, "Realm"));
+                ValueType network_transport = Object::get_property(ctx, realm_constructor, "_networkTransport");
+                state->transport_cache->emplace(ctx, Value::to_object(ctx, network_transport));
+            }
+
+            if (!state->request_object) {
+                state->request_object.emplace(ctx, makeRequest(ctx, state->request));
+            }
+            metrics::increment(metrics::counters().network_request_attempts);
+
+            Object::call_method(
+                ctx, **state->transport_cache, "fetchWithCallbacks",
+                {
+                    static_cast<ObjectType>(*state->request_object),
+                    ResponseHandlerClass<T>::create_instance(ctx, [ctx, state](const app::Response& response) {
+                        if (state->attempt + 1 < s_max_request_attempts && should_retry(response)) {
+                            ++state->attempt;
+                            metrics::increment(metrics::counters().network_request_retries);
+                            // Nothing here exposes an event-loop timer, so a
+                            // short-lived thread sleeps out the backoff and
+                            // re-dispatches onto the JS thread.
+                            std::thread([ctx, state, delay = retry_delay(state->attempt)] {
+                                std::this_thread::sleep_for(delay);
+                                dispatch_attempt(ctx, state);
+                            }).detach();
+                            return;
+                        }
+                        auto elapsed = std::chrono::steady_clock::now() - state->start;
+                        metrics::increment(
+                            metrics::counters().network_request_nanos,
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+                        state->completion_callback(response);
+                    }),
+                });
+        });
+    }
 
     std::string static fromHttpMethod(app::HttpMethod method)
     {
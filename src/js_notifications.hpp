@@ -18,7 +18,11 @@
 
 #pragma once
 
-#include <map>
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include <realm/object-store/collection_notifications.hpp>
@@ -29,6 +33,16 @@ namespace realm::js::notifications {
 
 using IdType = unsigned long long;
 
+/**
+ * @brief Global count of live tokens across every `NotificationBucket`
+ * instantiation, feeding `Realm.memoryStats()`.
+ */
+inline std::atomic<size_t>& total_token_count()
+{
+    static std::atomic<size_t> s_count{0};
+    return s_count;
+}
+
 template <typename T, typename Token>
 class NotificationHandle;
 
@@ -46,15 +60,29 @@ class NotificationHandle;
 template <typename T, typename Token>
 class NotificationBucket {
     using ProtectedFunction = Protected<typename T::Function>;
-    using TokensMap = std::map<IdType, std::vector<std::pair<ProtectedFunction, Token>>>;
+    using TokensMap = std::unordered_map<IdType, std::vector<std::pair<ProtectedFunction, Token>>>;
     using Handle = NotificationHandle<T, Token>;
 
+    /**
+     * @brief One shard of the token registry. The registry is sharded by
+     * handle id so that registration, removal and bulk teardown of many
+     * listeners don't funnel through one map and one lock: each handle only
+     * ever touches its own shard, and erase by handle is an O(1) hash lookup.
+     */
+    struct Shard {
+        std::mutex mutex;
+        TokensMap tokens;
+    };
+    static constexpr size_t s_shard_count = 16;
+
 public:
     static void emplace(Handle& handle, ProtectedFunction&& callback, Token&& token)
     {
         if (handle) {
-            auto& s_tokens = get_tokens();
-            s_tokens[handle].emplace_back(std::move(callback), std::move(token));
+            auto& shard = shard_for(handle);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.tokens[handle].emplace_back(std::move(callback), std::move(token));
+            total_token_count()++;
         }
         else {
             throw std::runtime_error("Cannot emplace notifications using an unset handle");
@@ -63,45 +91,129 @@ public:
 
     static void clear()
     {
-        auto& s_tokens = get_tokens();
-        s_tokens.clear();
+        for (auto& shard : get_shards()) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (auto const& entry : shard.tokens) {
+                total_token_count() -= entry.second.size();
+            }
+            shard.tokens.clear();
+        }
     }
 
     static void erase(Handle& handle)
     {
         if (handle) {
-            auto& s_tokens = get_tokens();
-            s_tokens.erase(handle);
+            auto& shard = shard_for(handle);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.tokens.find(handle);
+            if (it != shard.tokens.end()) {
+                total_token_count() -= it->second.size();
+                shard.tokens.erase(it);
+            }
         }
     }
 
     static void erase(Handle& handle, ProtectedFunction&& callback)
     {
         if (handle) {
-            auto& s_tokens = get_tokens();
-            auto& tokens = s_tokens[handle];
+            auto& shard = shard_for(handle);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto& tokens = shard.tokens[handle];
             auto compare = [&callback](auto&& token) {
                 return typename ProtectedFunction::Comparator()(token.first, callback);
             };
+            auto size_before = tokens.size();
             tokens.erase(std::remove_if(tokens.begin(), tokens.end(), compare), tokens.end());
+            total_token_count() -= size_before - tokens.size();
         }
         else {
             throw std::runtime_error("Cannot erase notifications using an unset handle");
         }
     }
 
+private:
+    static Shard& shard_for(IdType id)
+    {
+        return get_shards()[id % s_shard_count];
+    }
+
     /**
-     * @brief Get the static tokens object.
+     * @brief Get the static array of shards.
      *
      * @note We cannot use a simple static object on the namespace, because we are referencing this across multiple
      * translation units and this could lead to code using this before it's initialized.
      *
-     * @return auto& A reference to the static map of tokens.
+     * @return auto& A reference to the static shards holding the tokens.
      */
-    inline static TokensMap& get_tokens()
+    inline static std::array<Shard, s_shard_count>& get_shards()
+    {
+        static std::array<Shard, s_shard_count> s_shards;
+        return s_shards;
+    }
+};
+
+/**
+ * @brief Coalesces collection notification deliveries into one pass per Realm
+ * version advance.
+ * When batching is enabled, collection listeners enqueue their delivery
+ * instead of entering JS immediately; `RealmDelegate::did_change` flushes the
+ * queue after the object store has run every notifier for the new version, so
+ * a write touching many collections enters JS once instead of once per
+ * listener. Deliveries are queued per Realm, keyed by the delegate's opaque
+ * key, so one Realm's version advance never delivers (or delays) another's.
+ *
+ * @note Disabled by default; toggled from JS via `Realm._setBatchedNotifications`.
+ * @note Initial notifications must not be enqueued here: they are delivered
+ * when a notifier first runs, not on a version advance, so nothing would
+ * flush them until some unrelated later write. Listeners deliver those
+ * directly — see `ResultsClass::add_listener`.
+ *
+ * @tparam T The JS runtime types.
+ */
+template <typename T>
+class NotificationBatcher {
+public:
+    static bool& enabled()
+    {
+        static bool s_enabled = false;
+        return s_enabled;
+    }
+
+    static void enqueue(const void* realm_key, std::function<void()>&& delivery)
+    {
+        get_pending()[realm_key].push_back(std::move(delivery));
+    }
+
+    static void flush(const void* realm_key)
+    {
+        auto& pending = get_pending();
+        auto it = pending.find(realm_key);
+        if (it == pending.end()) {
+            return;
+        }
+        // Deliveries may add or remove listeners, so detach the batch before
+        // invoking anything.
+        std::vector<std::function<void()>> batch = std::move(it->second);
+        pending.erase(it);
+        for (auto& delivery : batch) {
+            delivery();
+        }
+    }
+
+    /**
+     * @brief Drops a Realm's queue without delivering, so queued deliveries
+     * (and the `Protected` values they capture) don't outlive their Realm.
+     */
+    static void drop(const void* realm_key)
+    {
+        get_pending().erase(realm_key);
+    }
+
+private:
+    inline static std::unordered_map<const void*, std::vector<std::function<void()>>>& get_pending()
     {
-        static TokensMap s_tokens;
-        return s_tokens;
+        static std::unordered_map<const void*, std::vector<std::function<void()>>> s_pending;
+        return s_pending;
     }
 };
 
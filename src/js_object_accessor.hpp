@@ -18,18 +18,23 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <unordered_map>
 
 #include <realm/keys.hpp>
 #include <vector>
 
 #include "js_list.hpp"
+#include "js_metrics.hpp"
 #include "js_set.hpp"
 #include "js_realm_object.hpp"
 #include "js_schema.hpp"
 
 #if REALM_ENABLE_SYNC
 #include <realm/util/base64.hpp>
+
+#include "js_base64.hpp"
 #endif
 
 namespace realm {
@@ -44,6 +49,110 @@ namespace js {
 namespace _impl {
 template <typename JSEngine, typename T>
 struct Unbox;
+
+// A table of property validators compiled once per ObjectSchema. The schema is
+// fixed after the Realm is opened, so the per-value switch on PropertyType in
+// Value::is_valid_for_property can be resolved up front to one function
+// pointer per column; hot write paths then pay a single indirect call per
+// value instead of re-selecting the conversion routine every time.
+template <typename JSEngine>
+struct PropertyConverterTable {
+    using ContextType = typename JSEngine::Context;
+    using ValueType = typename JSEngine::Value;
+    using Validator = bool (*)(ContextType, ValueType const&);
+
+    struct Entry {
+        const Property* property;
+        Validator validate; // null means fall back to the generic check
+        bool nullable;
+    };
+    std::vector<Entry> entries;
+
+    explicit PropertyConverterTable(const ObjectSchema& object_schema)
+    {
+        entries.reserve(object_schema.persisted_properties.size());
+        for (auto& prop : object_schema.persisted_properties) {
+            entries.push_back({&prop, compile(prop), realm::is_nullable(prop.type)});
+        }
+    }
+
+    bool is_valid(ContextType ctx, Entry const& entry, ValueType const& value) const
+    {
+        using Value = js::Value<JSEngine>;
+        if (entry.nullable && (Value::is_null(ctx, value) || Value::is_undefined(ctx, value))) {
+            return true;
+        }
+        if (entry.validate) {
+            return entry.validate(ctx, value);
+        }
+        return Value::is_valid_for_property(ctx, value, *entry.property);
+    }
+
+private:
+    static Validator compile(const Property& prop)
+    {
+        using realm::PropertyType;
+        using Value = js::Value<JSEngine>;
+        if (realm::is_array(prop.type) || realm::is_set(prop.type) || realm::is_dictionary(prop.type)) {
+            return nullptr; // collections still need the instance checks in is_valid_for_property
+        }
+        switch (prop.type & ~PropertyType::Flags) {
+            case PropertyType::Int:
+            case PropertyType::Float:
+            case PropertyType::Double:
+                return &Value::is_number;
+            case PropertyType::Decimal:
+                return &Value::is_decimal128;
+            case PropertyType::ObjectId:
+                return &Value::is_object_id;
+            case PropertyType::Bool:
+                return &Value::is_boolean;
+            case PropertyType::String:
+                return &Value::is_string;
+            case PropertyType::Data:
+                return [](ContextType ctx, ValueType const& value) {
+                    return Value::is_binary(ctx, value) || Value::is_string(ctx, value);
+                };
+            case PropertyType::Date:
+                return [](ContextType ctx, ValueType const& value) {
+                    return Value::is_date(ctx, value) || Value::is_string(ctx, value);
+                };
+            case PropertyType::UUID:
+                return &Value::is_uuid;
+            case PropertyType::Object:
+            case PropertyType::Mixed:
+                return [](ContextType, ValueType const&) {
+                    return true;
+                };
+            default:
+                return nullptr;
+        }
+    }
+};
+} // namespace _impl
+
+// Shape-cached conversion plan for Mixed-heavy plain objects. Documents
+// written through a Mixed dictionary tend to come in a handful of fixed
+// shapes — the same keys in the same order, carrying the same value types —
+// so the conversion branch each field took last time is remembered per shape
+// and verified against the next object with a single type check instead of
+// re-deducing from scratch (see Value::classify_for_mixed). Plans are
+// adaptive: a field whose prediction misses falls back to full deduction and
+// overwrites the prediction. The cache is keyed by a hash of the key list
+// and verified against the stored keys, so a collision costs a plan rebuild,
+// never a wrong plan.
+struct MixedShapePlan {
+    std::vector<std::string> keys;
+    std::vector<MixedConversion> fields;
+};
+
+inline std::unordered_map<uint64_t, MixedShapePlan>& mixed_shape_cache()
+{
+    // Thread-local like the other binding-side caches. Map entries are
+    // stable in memory once created, so a plan pointer held across the
+    // enumeration of a nested document stays valid.
+    static thread_local std::unordered_map<uint64_t, MixedShapePlan> s_cache;
+    return s_cache;
 }
 
 template <typename JSEngine>
@@ -117,11 +226,68 @@ public:
         return value;
     }
 
+    // Bulk ingestion support. Resolves every property value of `dict` up front,
+    // in persisted-property order, into a staging buffer that is reused across
+    // rows. Large imports (arrays of plain objects fed to `Realm.create`) can
+    // then be walked with one property lookup per column instead of
+    // re-resolving names and re-validating per value inside the object store.
+    std::vector<OptionalValue>& stage_values_for_object(ValueType dict, const ObjectSchema& object_schema)
+    {
+        auto& converters = converter_table(object_schema);
+        m_staged_values.clear();
+        m_staged_values.reserve(converters.entries.size());
+        ObjectType object = Value::validated_to_object(m_ctx, dict);
+        for (auto& entry : converters.entries) {
+            auto& prop = *entry.property;
+            ValueType value =
+                Object::get_property(m_ctx, object, !prop.public_name.empty() ? prop.public_name : prop.name);
+            if (Value::is_undefined(m_ctx, value)) {
+                m_staged_values.push_back(std::nullopt);
+                continue;
+            }
+            if (!converters.is_valid(m_ctx, entry, value)) {
+                throw TypeErrorException(*this, object_schema.name, prop, value);
+            }
+            m_staged_values.push_back(value);
+        }
+        return m_staged_values;
+    }
+
+    // Returns the compiled converter table for `object_schema`, building it on
+    // first use. The table borrows the schema's Property pointers, so it is
+    // discarded whenever the accessor is pointed at a different schema.
+    const _impl::PropertyConverterTable<JSEngine>& converter_table(const ObjectSchema& object_schema)
+    {
+        if (!m_converter_table || m_converter_table_schema != &object_schema) {
+            m_converter_table = std::make_unique<_impl::PropertyConverterTable<JSEngine>>(object_schema);
+            m_converter_table_schema = &object_schema;
+        }
+        return *m_converter_table;
+    }
+
+    // Walks a JS array of plain objects, staging each element's values and
+    // invoking `func(index, staged_values)`. The staging buffer is owned by
+    // this accessor and overwritten on each iteration, so callers must consume
+    // a row's values before the next one is produced.
+    template <typename Fn>
+    void enumerate_staged_objects(ValueType array_value, const ObjectSchema& object_schema, Fn&& func)
+    {
+        auto array = Value::validated_to_array(m_ctx, array_value, "objects");
+        uint32_t size = Object::validated_get_length(m_ctx, array);
+        for (uint32_t i = 0; i < size; ++i) {
+            func(i, stage_values_for_object(Object::get_property(m_ctx, array, i), object_schema));
+        }
+    }
+
     OptionalValue default_value_for_property(const ObjectSchema& object_schema, const Property& prop)
     {
-        auto defaults = get_delegate<JSEngine>(m_realm.get())->m_defaults[object_schema.name];
-        auto it = defaults.find(prop.name);
-        return it != defaults.end() ? util::make_optional(ValueType(it->second)) : std::nullopt;
+        auto& defaults_map = *get_delegate<JSEngine>(m_realm.get())->m_defaults;
+        auto defaults = defaults_map.find(object_schema.name);
+        if (defaults == defaults_map.end()) {
+            return std::nullopt;
+        }
+        auto it = defaults->second.find(prop.name);
+        return it != defaults->second.end() ? util::make_optional(ValueType(it->second)) : std::nullopt;
     }
 
     template <typename T>
@@ -286,10 +452,26 @@ public:
     void enumerate_dictionary(ValueType value, Fn&& func)
     {
         auto js_object = Value::validated_to_object(m_ctx, value);
-        for (auto&& key : Object::get_property_names(m_ctx, js_object)) {
-            ValueType val = Object::get_property(m_ctx, js_object, key);
-            func(std::string(key), val);
+        auto names = Object::get_property_names(m_ctx, js_object);
+
+        std::vector<std::string> keys;
+        keys.reserve(names.size());
+        for (auto&& name : names) {
+            keys.push_back(std::string(name));
+        }
+
+        // Arm the shape plan's prediction for each field before handing the
+        // value over; Unbox<Mixed> consumes it. For typed dictionaries the
+        // hint is simply never read.
+        MixedShapePlan* plan = mixed_shape_plan(keys);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            ValueType val = Object::get_property(m_ctx, js_object, names[i]);
+            if (plan) {
+                m_mixed_conversion_hint = &plan->fields[i];
+            }
+            func(keys[i], val);
         }
+        m_mixed_conversion_hint = nullptr;
     }
 
     bool is_same_list(realm::List const& list, ValueType const& value) const noexcept
@@ -341,6 +523,34 @@ private:
     const ObjectSchema* m_object_schema;
     std::string m_string_buffer;
     OwnedBinaryData m_owned_binary_data;
+    // Prediction slot for the next Mixed unboxing, armed per field by
+    // enumerate_dictionary from the object's shape plan.
+    MixedConversion* m_mixed_conversion_hint = nullptr;
+
+    // Looks up (building on first sight) the conversion plan for an object
+    // shape, identified by an FNV-1a hash of its key list.
+    MixedShapePlan* mixed_shape_plan(std::vector<std::string> const& keys)
+    {
+        if (keys.empty()) {
+            return nullptr;
+        }
+        uint64_t hash = 14695981039346656037ull;
+        for (auto& key : keys) {
+            for (unsigned char c : key) {
+                hash = (hash ^ c) * 1099511628211ull;
+            }
+            hash = (hash ^ 0xffu) * 1099511628211ull;
+        }
+        auto& plan = mixed_shape_cache()[hash];
+        if (plan.keys != keys) {
+            plan.keys = keys;
+            plan.fields.assign(keys.size(), MixedConversion::Unsupported);
+        }
+        return &plan;
+    }
+    std::vector<OptionalValue> m_staged_values;
+    std::unique_ptr<_impl::PropertyConverterTable<JSEngine>> m_converter_table;
+    const ObjectSchema* m_converter_table_schema = nullptr;
     template <typename, typename>
     friend struct _impl::Unbox;
 };
@@ -456,7 +666,13 @@ struct Unbox<JSEngine, StringData> {
         if (ctx->is_null(value)) {
             return StringData();
         }
-        ctx->m_string_buffer = js::Value<JSEngine>::validated_to_string(ctx->m_ctx, value, "Property");
+        if (!js::Value<JSEngine>::is_string(ctx->m_ctx, value)) {
+            throw TypeErrorException("Property", "string", js::Value<JSEngine>::to_string(ctx->m_ctx, value));
+        }
+        // Decode straight into the accessor's reused buffer; the conversion
+        // itself then allocates nothing once the buffer has grown to the
+        // longest string seen by this operation.
+        js::Value<JSEngine>::to_string_buffer(ctx->m_ctx, value, ctx->m_string_buffer);
         return ctx->m_string_buffer;
     }
 };
@@ -475,7 +691,7 @@ struct Unbox<JSEngine, BinaryData> {
             std::string str = js::Value<JSEngine>::to_string(ctx->m_ctx, value);
             size_t max_size = util::base64_decoded_size(str.size());
             std::unique_ptr<char[]> data(new char[max_size]);
-            if (auto size = util::base64_decode(str, data.get(), max_size)) {
+            if (auto size = js::base64::decode(str, data.get(), max_size)) {
                 ctx->m_owned_binary_data = OwnedBinaryData(std::move(data), *size);
                 return ctx->m_owned_binary_data.get();
             }
@@ -485,8 +701,16 @@ struct Unbox<JSEngine, BinaryData> {
         }
 #endif
 
-        ctx->m_owned_binary_data = js::Value<JSEngine>::validated_to_binary(ctx->m_ctx, value);
-        return ctx->m_owned_binary_data.get();
+        // Writes borrow the JS buffer for the duration of the set when the
+        // engine allows it (Node pins V8 buffers while the value is alive);
+        // core copies the bytes into the file itself, so an intermediate
+        // owned copy is skipped for large blobs. Engines that cannot borrow
+        // fall back to copying into m_owned_binary_data.
+        if (!js::Value<JSEngine>::is_binary(ctx->m_ctx, value)) {
+            throw TypeErrorException("Property", "binary",
+                                     js::Value<JSEngine>::to_string(ctx->m_ctx, value));
+        }
+        return js::Value<JSEngine>::to_binary_view(ctx->m_ctx, value, ctx->m_owned_binary_data);
     }
 };
 
@@ -495,8 +719,17 @@ struct Unbox<JSEngine, Mixed> {
     static Mixed call(NativeAccessor<JSEngine>* ctx, typename JSEngine::Value const& value, realm::CreatePolicy,
                       ObjKey)
     {
+        // no need to validate type for a mixed value
+        if (MixedConversion* hint = ctx->m_mixed_conversion_hint) {
+            ctx->m_mixed_conversion_hint = nullptr; // one hint per field
+            if (!js::Value<JSEngine>::matches_mixed_conversion(ctx->m_ctx, value, *hint)) {
+                *hint = js::Value<JSEngine>::classify_for_mixed(ctx->m_ctx, value);
+            }
+            return js::Value<JSEngine>::to_mixed_as(ctx->m_ctx, ctx->m_realm, value, ctx->m_string_buffer,
+                                                    ctx->m_owned_binary_data, *hint);
+        }
         return js::Value<JSEngine>::to_mixed(ctx->m_ctx, ctx->m_realm, value, ctx->m_string_buffer,
-                                             ctx->m_owned_binary_data); // no need to validate type for a mixed value
+                                             ctx->m_owned_binary_data);
     }
 };
 
@@ -613,6 +846,7 @@ struct Unbox<JSEngine, std::vector<realm::Mixed>> {
         auto js_array = Value::validated_to_array(ctx, value, "is JS array");
         std::vector<realm::Mixed> array;
         uint32_t length = Object::validated_get_length(ctx, js_array);
+        array.reserve(length);
         for (uint32_t i = 0; i < length; i++) {
             ValueType js_obj = Object::get_property(ctx, js_array, i);
             array.emplace_back(js::Value<JSEngine>::to_mixed(ctx, realm, js_obj, native_accessor->m_string_buffer,
@@ -639,6 +873,7 @@ template <typename T>
 template <typename U>
 U NativeAccessor<T>::unbox(ValueType value, realm::CreatePolicy policy, ObjKey current_row)
 {
+    metrics::increment(metrics::counters().values_unboxed);
     return _impl::Unbox<T, U>::call(this, std::move(value), policy, current_row);
 }
 
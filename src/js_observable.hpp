@@ -20,6 +20,9 @@
 
 #include "js_class.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace realm {
 namespace js {
 
@@ -31,5 +34,112 @@ struct ObservableClass : ClassDefinition<T, Observable> {
     std::string const name = "Observable";
 };
 
+/**
+ * @brief Native listener registry backing the observable surfaces.
+ *
+ * Stores listeners contiguously as Protected function handles and hands the
+ * emitter a reentrancy-safe loop, so an emit touches no JS machinery beyond
+ * the callback invocations themselves and — unlike the previous
+ * copy-the-list-per-event scheme — performs no reference-count churn per
+ * listener per event.
+ *
+ * Mutation during an emit is supported: listeners added while emitting are
+ * first invoked by the next event, and removed ones are skipped. Removal
+ * outside an emit is a swap-remove; listener order is not part of the
+ * contract.
+ */
+template <typename T>
+class ListenerList {
+public:
+    using GlobalContextType = typename T::GlobalContext;
+    using FunctionType = typename T::Function;
+
+    void add(const Protected<GlobalContextType>& ctx, FunctionType fn)
+    {
+        for (auto& listener : m_listeners) {
+            if (listener && listener == fn) {
+                return;
+            }
+        }
+        m_listeners.emplace_back(ctx, std::move(fn));
+    }
+
+    void remove(FunctionType fn)
+    {
+        for (auto& listener : m_listeners) {
+            if (listener && listener == fn) {
+                if (m_iteration_depth > 0) {
+                    // An emit is walking the vector; leave a hole instead of
+                    // moving entries under it. The outermost emit compacts.
+                    listener = Protected<FunctionType>();
+                    m_has_holes = true;
+                }
+                else {
+                    listener = std::move(m_listeners.back());
+                    m_listeners.pop_back();
+                }
+                return;
+            }
+        }
+    }
+
+    void clear()
+    {
+        if (m_iteration_depth > 0) {
+            for (auto& listener : m_listeners) {
+                listener = Protected<FunctionType>();
+            }
+            m_has_holes = true;
+        }
+        else {
+            m_listeners.clear();
+        }
+    }
+
+    bool empty() const
+    {
+        return m_listeners.empty();
+    }
+
+    /// Invokes `func` for every listener registered when the emit started.
+    template <typename F>
+    void for_each(F&& func)
+    {
+        ++m_iteration_depth;
+        size_t bound = m_listeners.size();
+        try {
+            for (size_t i = 0; i < bound; ++i) {
+                if (m_listeners[i]) {
+                    func(m_listeners[i]);
+                }
+            }
+        }
+        catch (...) {
+            finish_iteration();
+            throw;
+        }
+        finish_iteration();
+    }
+
+private:
+    void finish_iteration()
+    {
+        if (--m_iteration_depth == 0 && m_has_holes) {
+            m_listeners.erase(std::remove_if(m_listeners.begin(), m_listeners.end(),
+                                             [](auto& listener) {
+                                                 return !listener;
+                                             }),
+                              m_listeners.end());
+            m_has_holes = false;
+        }
+    }
+
+    std::vector<Protected<FunctionType>> m_listeners;
+    // Depth of in-flight emits; holes left by removals during an emit are
+    // compacted when the outermost emit finishes.
+    int m_iteration_depth = 0;
+    bool m_has_holes = false;
+};
+
 } // namespace js
 } // namespace realm
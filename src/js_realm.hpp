@@ -26,10 +26,19 @@
 #include "js_set.hpp"
 #include "js_dictionary.hpp"
 #include "js_results.hpp"
+#include "js_compiled_query.hpp"
 #include "js_schema.hpp"
+#include "js_metrics.hpp"
+#include "js_io_hints.hpp"
+#include "js_startup_trace.hpp"
+#include "js_dispatch_batcher.hpp"
 #include "js_observable.hpp"
 #include "platform.hpp"
 #include "realm/binary_data.hpp"
+#include "realm/version_id.hpp"
+#include <functional>
+#include <map>
+#include <optional>
 #include <stdexcept>
 
 #if REALM_ENABLE_SYNC
@@ -56,13 +65,21 @@
 
 #include <realm/disable_sync_to_disk.hpp>
 #include <realm/global_key.hpp>
+#include <realm/sort_descriptor.hpp>
 #include <realm/util/file.hpp>
 #include <realm/util/scope_exit.hpp>
 #include <realm/sync/config.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <chrono>
 #include <list>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
 #include <any>
 
 namespace realm {
@@ -88,28 +105,165 @@ class RealmClass;
 template <typename T>
 class AsyncOpenTaskClass;
 
+// Weak registry of every Realm the binding has opened, feeding
+// Realm.memoryStats(). Entries are weak so the registry never extends a
+// Realm's lifetime; dead entries are pruned on each access.
+class OpenRealmRegistry {
+public:
+    static OpenRealmRegistry& shared()
+    {
+        static OpenRealmRegistry registry;
+        return registry;
+    }
+
+    void add(SharedRealm const& realm)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_realms.begin(); it != m_realms.end();) {
+            auto existing = it->lock();
+            if (!existing) {
+                it = m_realms.erase(it);
+                continue;
+            }
+            if (existing == realm) {
+                return;
+            }
+            ++it;
+        }
+        m_realms.push_back(realm);
+    }
+
+    std::vector<SharedRealm> live()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<SharedRealm> result;
+        for (auto it = m_realms.begin(); it != m_realms.end();) {
+            if (auto realm = it->lock()) {
+                result.push_back(std::move(realm));
+                ++it;
+            }
+            else {
+                it = m_realms.erase(it);
+            }
+        }
+        return result;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<std::weak_ptr<Realm>> m_realms;
+};
+
+#if REALM_ENABLE_SYNC
+// Internal state of a JS AsyncOpenTask. The Protected JS values an in-flight
+// open keeps alive (the completion callback and any download-progress
+// callbacks) are owned here rather than by the dispatcher lambdas handed to
+// the sync client, which only hold weak references. cancel() clears the
+// vector on the JS thread, so the references are released immediately
+// instead of surviving until the sync thread has wound the task down.
+template <typename T>
+struct AsyncOpenTaskHolder {
+    std::shared_ptr<AsyncOpenTask> task;
+    std::vector<std::shared_ptr<void>> protected_state;
+};
+#endif
+
 template <typename T>
 class RealmDelegate : public BindingContext {
 private:
     void did_change(std::vector<ObserverState> const&, std::vector<void*> const&, bool) override
     {
         HANDLESCOPE(m_context)
+        // wrappers cached for the previous version must not outlive it
+        clear_object_caches();
+        // deliver any collection notifications coalesced during this version
+        // advance in one pass before the realm-level "change" event fires;
+        // the key scopes the flush to this Realm's queue
+        notifications::NotificationBatcher<T>::flush(m_batch_key);
         notify(m_notifications, "change");
     }
 
     void schema_did_change(realm::Schema const& schema) override
     {
         HANDLESCOPE(m_context)
+        m_schema_cache.reset();
+        m_results_cache.clear();
+        m_schema_by_name.clear();
+        m_schema_by_table.clear();
         ObjectType schema_object = Schema<T>::object_for_schema(m_context, schema);
         notify(m_schema_notifications, "schema", schema_object);
     }
 
     void before_notify() override
     {
+        // The read version is about to advance; detach any copy-on-write
+        // snapshots still reading through their live collection.
+        materialize_pending_snapshots();
+
         HANDLESCOPE(m_context)
         notify(m_before_notify_notifications, "beforenotify");
     }
 
+    // Only invoked when automatic refresh is disabled, i.e. when a
+    // `notificationPolicy` was supplied in the config — see
+    // RealmClass::apply_notification_policy. Decides whether an external
+    // commit is delivered to JS now, deferred past the coalescing window,
+    // or (in manual mode) left for an explicit realm.refresh().
+    void changes_available() override
+    {
+        if (m_pin_count > 0) {
+            // A version-pinned read is in progress; whether this version is
+            // picked up on unpin depends on the notification policy.
+            m_refresh_pending = true;
+            return;
+        }
+        if (m_notification_policy.manual_refresh) {
+            return;
+        }
+        auto realm = m_realm.lock();
+        if (!realm) {
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now - m_last_policy_refresh >= m_notification_policy.min_interval) {
+            m_last_policy_refresh = now;
+            m_refresh_pending = false;
+            realm->refresh();
+            return;
+        }
+        // Inside the window: remember that a newer version is waiting and
+        // arm at most one deferred check. Under a wake storm every commit
+        // still lands here, but JS only runs once per interval; the check
+        // below (or the next commit, or an explicit refresh()) delivers the
+        // final version once the window has passed.
+        m_refresh_pending = true;
+        if (m_refresh_scheduled) {
+            return;
+        }
+        m_refresh_scheduled = true;
+        realm->scheduler()->invoke([weak_realm = m_realm] {
+            auto realm = weak_realm.lock();
+            if (!realm || realm->is_closed()) {
+                return;
+            }
+            auto delegate = get_delegate<T>(realm.get());
+            if (!delegate) {
+                return;
+            }
+            delegate->m_refresh_scheduled = false;
+            if (!delegate->m_refresh_pending) {
+                return;
+            }
+            auto now = std::chrono::steady_clock::now();
+            if (now - delegate->m_last_policy_refresh < delegate->m_notification_policy.min_interval) {
+                return;
+            }
+            delegate->m_last_policy_refresh = now;
+            delegate->m_refresh_pending = false;
+            realm->refresh();
+        });
+    }
+
 public:
     using GlobalContextType = typename T::GlobalContext;
     using FunctionType = typename T::Function;
@@ -119,6 +273,8 @@ public:
 
     using ObjectDefaultsMap = typename Schema<T>::ObjectDefaultsMap;
     using ConstructorMap = typename Schema<T>::ConstructorMap;
+    using SharedObjectDefaultsMap = typename Schema<T>::SharedObjectDefaultsMap;
+    using SharedConstructorMap = typename Schema<T>::SharedConstructorMap;
 
     RealmDelegate(std::weak_ptr<realm::Realm> realm, GlobalContextType ctx)
         : m_context(ctx)
@@ -126,14 +282,22 @@ public:
     {
         SharedRealm sharedRealm = realm.lock();
         m_realm_path = sharedRealm->config().path;
+        // Raw pointer kept only as an opaque queue key; the weak_ptr cannot
+        // produce it anymore by the time the destructor needs it.
+        m_batch_key = sharedRealm.get();
     }
 
     ~RealmDelegate()
     {
+        notifications::NotificationBatcher<T>::drop(m_batch_key);
         on_context_destroy<RealmObjectClass<T>>(m_context, m_realm_path);
         // All protected values need to be unprotected while the context is retained.
-        m_defaults.clear();
-        m_constructors.clear();
+        m_object_cache.clear();
+        m_schema_cache.reset();
+        // Shared maps are released by refcount; entries are only unprotected
+        // once the last instance (or the schema parse cache) lets go.
+        m_defaults.reset();
+        m_constructors.reset();
         m_notifications.clear();
         m_schema_notifications.clear();
         m_before_notify_notifications.clear();
@@ -141,12 +305,12 @@ public:
 
     void add_notification(FunctionType notification)
     {
-        add(m_notifications, notification);
+        m_notifications.add(m_context, notification);
     }
 
     void remove_notification(FunctionType notification)
     {
-        remove(m_notifications, notification);
+        m_notifications.remove(notification);
     }
 
     void remove_all_notifications()
@@ -159,12 +323,12 @@ public:
         SharedRealm realm = m_realm.lock();
         // schema change notifications only happen if the Realm has a read transaction active
         realm->read_group();
-        add(m_schema_notifications, notification);
+        m_schema_notifications.add(m_context, notification);
     }
 
     void remove_schema_notification(FunctionType notification)
     {
-        remove(m_schema_notifications, notification);
+        m_schema_notifications.remove(notification);
     }
 
     void remove_all_schema_notifications()
@@ -174,12 +338,12 @@ public:
 
     void add_before_notify_notification(FunctionType notification)
     {
-        add(m_before_notify_notifications, notification);
+        m_before_notify_notifications.add(m_context, notification);
     }
 
     void remove_before_notify_notification(FunctionType notification)
     {
-        remove(m_before_notify_notifications, notification);
+        m_before_notify_notifications.remove(notification);
     }
 
     void remove_all_before_notify_notification()
@@ -187,40 +351,265 @@ public:
         m_before_notify_notifications.clear();
     }
 
-    ObjectDefaultsMap m_defaults;
-    ConstructorMap m_constructors;
+    // Immutable once published here; shared with other instances opened from
+    // the same schema parse and with frozen copies of this Realm.
+    SharedObjectDefaultsMap m_defaults = std::make_shared<const ObjectDefaultsMap>();
+    SharedConstructorMap m_constructors = std::make_shared<const ConstructorMap>();
+
+    // Parsed-query cache used by `Results.filtered` — see
+    // ResultsClass::create_filtered. Only argument-free predicates are
+    // cached, since the parser bakes bound argument values into the Query.
+    struct CachedQuery {
+        realm::Query query;
+        realm::DescriptorOrdering ordering;
+        bool has_ordering;
+    };
 
-private:
-    Protected<GlobalContextType> m_context;
-    std::list<Protected<FunctionType>> m_notifications;
-    std::list<Protected<FunctionType>> m_schema_notifications;
-    std::list<Protected<FunctionType>> m_before_notify_notifications;
-    std::weak_ptr<realm::Realm> m_realm;
-    std::string m_realm_path;
+    CachedQuery* find_cached_query(TableKey table_key, const std::string& query_string)
+    {
+        auto it = m_query_cache.find({table_key.value, query_string});
+        return it == m_query_cache.end() ? nullptr : &it->second;
+    }
+
+    void cache_query(TableKey table_key, const std::string& query_string, CachedQuery entry)
+    {
+        // Evict an arbitrary entry once full; applications use a small set
+        // of distinct predicates, so anything fancier isn't worth it.
+        if (m_query_cache.size() >= s_max_cached_queries) {
+            m_query_cache.erase(m_query_cache.begin());
+        }
+        m_query_cache.emplace(std::make_pair(table_key.value, query_string), std::move(entry));
+    }
+
+    // Resolved sort-column cache used by `sorted` — see
+    // ResultsClass::sort_collection. Keyed by (table, sort spec).
+    struct CachedSort {
+        std::vector<std::vector<realm::ExtendedColumnKey>> columns;
+        std::vector<bool> ascending;
+    };
+
+    CachedSort* find_cached_sort(TableKey table_key, const std::string& spec)
+    {
+        auto it = m_sort_cache.find({table_key.value, spec});
+        return it == m_sort_cache.end() ? nullptr : &it->second;
+    }
+
+    void cache_sort(TableKey table_key, const std::string& spec, CachedSort entry)
+    {
+        if (m_sort_cache.size() >= s_max_cached_queries) {
+            m_sort_cache.erase(m_sort_cache.begin());
+        }
+        m_sort_cache.emplace(std::make_pair(table_key.value, spec), std::move(entry));
+    }
+
+    // Boxed-object cache keyed by (table, object key) — see
+    // RealmObjectClass::create_instance. Entries are strong references, so
+    // the cache is dropped whenever the Realm version advances; within one
+    // version, re-reading the same row returns the identical JS wrapper.
+    Protected<ObjectType>* find_cached_object(TableKey table_key, ObjKey obj_key)
+    {
+        auto it = m_object_cache.find({table_key.value, obj_key.value});
+        return it == m_object_cache.end() ? nullptr : &it->second;
+    }
+
+    void cache_object(TableKey table_key, ObjKey obj_key, Protected<ObjectType> object)
+    {
+        // Bounded without eviction — once full, further rows are boxed
+        // fresh each read until the next version advance clears the cache.
+        if (m_object_cache.size() >= s_max_cached_objects) {
+            return;
+        }
+        m_object_cache.emplace(std::make_pair(table_key.value, obj_key.value), std::move(object));
+    }
+
+    // Primary-key lookup memo — see RealmClass::object_for_primary_key. Maps
+    // (table, stringified primary key) to the row's ObjKey so repeat lookups
+    // skip the primary-key search; cleared on version advance along with the
+    // object cache, so an entry can never outlive the row mapping it was
+    // derived from.
+    const int64_t* find_cached_primary_key(TableKey table_key, const std::string& pk)
+    {
+        auto it = m_primary_key_cache.find({table_key.value, pk});
+        return it == m_primary_key_cache.end() ? nullptr : &it->second;
+    }
 
-    void add(std::list<Protected<FunctionType>>& notifications, FunctionType fn)
+    void cache_primary_key(TableKey table_key, const std::string& pk, ObjKey obj_key)
     {
-        if (std::find(notifications.begin(), notifications.end(), fn) != notifications.end()) {
+        if (m_primary_key_cache.size() >= s_max_cached_objects) {
             return;
         }
-        notifications.emplace_back(m_context, std::move(fn));
+        m_primary_key_cache.emplace(std::make_pair(table_key.value, pk), obj_key.value);
+    }
+
+    // Drops every (table, key)-addressed entry. Called on each version
+    // advance, and after a rollback: cancelling a transaction rewinds ObjKey
+    // allocation without advancing the version, so a key cached this version
+    // could be recycled by a later create.
+    void clear_object_caches()
+    {
+        m_object_cache.clear();
+        m_primary_key_cache.clear();
+    }
+
+    // Boxed schema cache — see RealmClass::get_schema. The JS representation
+    // is rebuilt only when the schema version changes; reads of `realm.schema`
+    // in between return the same JS object.
+    Protected<ObjectType>* find_cached_schema(uint64_t schema_version)
+    {
+        if (m_schema_cache && m_schema_cache_version == schema_version) {
+            return &*m_schema_cache;
+        }
+        return nullptr;
+    }
+
+    void cache_schema(uint64_t schema_version, Protected<ObjectType> object)
+    {
+        m_schema_cache = std::move(object);
+        m_schema_cache_version = schema_version;
+    }
+
+    // Schema lookup tables — see validated_object_schema_for_value and
+    // RealmClass::object_for_object_key. Built lazily from the current
+    // schema; entries point into realm->schema(), which is stable until the
+    // schema changes and both tables are cleared (schema_did_change).
+    const ObjectSchema* find_object_schema(const std::string& name)
+    {
+        build_schema_tables();
+        auto it = m_schema_by_name.find(name);
+        return it == m_schema_by_name.end() ? nullptr : it->second;
+    }
+
+    const ObjectSchema* find_object_schema(TableKey table_key)
+    {
+        build_schema_tables();
+        auto it = m_schema_by_table.find(table_key.value);
+        return it == m_schema_by_table.end() ? nullptr : it->second;
+    }
+
+    // Per-type unfiltered Results cache — see RealmClass::objects. A live
+    // Results tracks its table automatically, so the same JS wrapper can be
+    // handed out for every `realm.objects('X')` call instead of allocating a
+    // fresh one per render. Reset when the schema changes, torn down with the
+    // delegate when the Realm closes.
+    Protected<ObjectType>* find_cached_results(const std::string& object_type)
+    {
+        auto it = m_results_cache.find(object_type);
+        return it == m_results_cache.end() ? nullptr : &it->second;
     }
 
-    void remove(std::list<Protected<FunctionType>>& notifications, FunctionType fn)
+    void cache_results(const std::string& object_type, Protected<ObjectType> object)
     {
-        // This doesn't just call remove() because that would create a new Protected<FunctionType>
-        notifications.remove_if([&](auto& notification) {
-            return notification == fn;
+        m_results_cache.emplace(object_type, std::move(object));
+    }
+
+    // Copy-on-write snapshot registry — see ResultsClass::create_snapshot.
+    // A snapshot starts out reading through the live collection and only pays
+    // for detaching its own row set when the live data is about to diverge:
+    // right before a local write transaction begins, or before the read
+    // version advances past the version the snapshot was taken at.
+    void register_pending_snapshot(void* key, std::function<void()> materialize)
+    {
+        m_pending_snapshots.emplace_back(key, std::move(materialize));
+    }
+
+    void unregister_pending_snapshot(void* key)
+    {
+        auto it = std::find_if(m_pending_snapshots.begin(), m_pending_snapshots.end(), [&](auto& entry) {
+            return entry.first == key;
         });
+        if (it != m_pending_snapshots.end()) {
+            m_pending_snapshots.erase(it);
+        }
+    }
+
+    void materialize_pending_snapshots()
+    {
+        // Drain before invoking: materializing clears the owner's pending
+        // flag, and fresh registrations made while draining (there should be
+        // none) must not be lost.
+        auto pending = std::move(m_pending_snapshots);
+        m_pending_snapshots.clear();
+        for (auto& [key, materialize] : pending) {
+            materialize();
+        }
+    }
+
+    // How external commits reach this instance — see changes_available()
+    // and RealmClass::apply_notification_policy. `min_interval` is derived
+    // from the config's coalescing window and maximum wake rate; manual
+    // mode suppresses automatic version advances entirely.
+    struct NotificationPolicy {
+        bool manual_refresh = false;
+        std::chrono::milliseconds min_interval{0};
+    };
+
+    // Version-pinned reads — see RealmClass::pin_version. While the count
+    // is non-zero the read transaction stays at the pinned version: external
+    // commits are noted but not delivered, and local writes are rejected
+    // since beginning one would advance the version underneath the reader.
+    void verify_not_pinned() const
+    {
+        if (m_pin_count > 0) {
+            throw std::runtime_error(
+                "Cannot begin a write transaction while the read version is pinned; call unpin() first.");
+        }
+    }
+
+private:
+    NotificationPolicy m_notification_policy;
+    std::chrono::steady_clock::time_point m_last_policy_refresh;
+    bool m_refresh_pending = false;
+    bool m_refresh_scheduled = false;
+    bool m_has_notification_policy = false;
+    size_t m_pin_count = 0;
+
+    static constexpr size_t s_max_cached_queries = 64;
+    static constexpr size_t s_max_cached_objects = 4096;
+    std::map<std::pair<uint32_t, std::string>, CachedQuery> m_query_cache;
+    std::map<std::pair<uint32_t, std::string>, CachedSort> m_sort_cache;
+    std::map<std::pair<uint32_t, int64_t>, Protected<ObjectType>> m_object_cache;
+    std::map<std::pair<uint32_t, std::string>, int64_t> m_primary_key_cache;
+    std::optional<Protected<ObjectType>> m_schema_cache;
+    uint64_t m_schema_cache_version = uint64_t(-1);
+
+    void build_schema_tables()
+    {
+        if (!m_schema_by_name.empty()) {
+            return;
+        }
+        SharedRealm realm = m_realm.lock();
+        if (!realm) {
+            return;
+        }
+        for (auto const& object_schema : realm->schema()) {
+            m_schema_by_name.emplace(object_schema.name, &object_schema);
+            if (object_schema.table_key) {
+                m_schema_by_table.emplace(object_schema.table_key.value, &object_schema);
+            }
+        }
     }
 
-    // Note that this intentionally copies the `notifications` argument as we
-    // want to iterate over a copy in case the user adds/removes notifications
-    // from inside the handler
+    std::unordered_map<std::string, const ObjectSchema*> m_schema_by_name;
+    std::unordered_map<uint32_t, const ObjectSchema*> m_schema_by_table;
+    std::map<std::string, Protected<ObjectType>> m_results_cache;
+
+    Protected<GlobalContextType> m_context;
+    ListenerList<T> m_notifications;
+    ListenerList<T> m_schema_notifications;
+    ListenerList<T> m_before_notify_notifications;
+    std::weak_ptr<realm::Realm> m_realm;
+    std::string m_realm_path;
+    // Opaque per-Realm key for the NotificationBatcher queue.
+    const void* m_batch_key = nullptr;
+    std::vector<std::pair<void*, std::function<void()>>> m_pending_snapshots;
+
+    // Arguments are boxed once per event and shared by every listener; the
+    // list itself handles add/remove from inside a handler, so there is no
+    // per-event copy of the listener registry.
     template <typename... Args>
-    void notify(std::list<Protected<FunctionType>> notifications, const char* name, Args&&... args)
+    void notify(ListenerList<T>& listeners, const char* name, Args&&... args)
     {
-        if (notifications.empty()) {
+        if (listeners.empty()) {
             return;
         }
 
@@ -233,14 +622,27 @@ private:
         ValueType arguments[] = {realm_object, Value::from_string(m_context, name), args...};
         auto argc = std::distance(std::begin(arguments), std::end(arguments));
 
-        for (auto& callback : notifications) {
+        listeners.for_each([&](auto& callback) {
             Function<T>::callback(m_context, callback, realm_object, argc, arguments);
-        }
+        });
     }
 
     friend class RealmClass<T>;
 };
 
+// Rollback wrapper used by every path that cancels a write transaction. The
+// version does not advance on rollback, so did_change never fires to clear
+// the delegate's (table, key)-addressed caches; they are dropped here before
+// the rewound ObjKeys can be recycled by later creates.
+template <typename T>
+inline void cancel_transaction_and_clear_caches(const SharedRealm& realm)
+{
+    realm->cancel_transaction();
+    if (auto delegate = get_delegate<T>(realm.get())) {
+        delegate->clear_object_caches();
+    }
+}
+
 
 template <typename T>
 class ShouldCompactOnLaunchFunctor {
@@ -283,8 +685,8 @@ public:
 private:
     const Protected<typename T::GlobalContext> m_ctx;
     const Protected<typename T::Function> m_func;
-    util::EventLoopDispatcher<void(ShouldCompactOnLaunchFunctor<T>* this_object, uint64_t total_bytes,
-                                   uint64_t used_bytes)>
+    BatchedEventLoopDispatcher<void(ShouldCompactOnLaunchFunctor<T>* this_object, uint64_t total_bytes,
+                                    uint64_t used_bytes)>
         m_event_loop_dispatcher;
     bool m_ready = false;
     bool m_should_compact_on_launch = false;
@@ -317,29 +719,47 @@ public:
     using ObjectDefaults = typename Schema<T>::ObjectDefaults;
     using ObjectDefaultsMap = typename Schema<T>::ObjectDefaultsMap;
     using ConstructorMap = typename Schema<T>::ConstructorMap;
+    using SharedObjectDefaultsMap = typename Schema<T>::SharedObjectDefaultsMap;
+    using SharedConstructorMap = typename Schema<T>::SharedConstructorMap;
 
     using WaitHandler = void(std::error_code);
     using ProgressHandler = void(uint64_t transferred_bytes, uint64_t transferrable_bytes);
 
     static FunctionType create_constructor(ContextType);
+#if REALM_ENABLE_SYNC
+    static ValueType create_sync_constructors(ContextType, ObjectType, StringData requested);
+#endif
 
     // methods
     static void objects(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void object_for_primary_key(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void compile_query(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void create(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void create_all(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void create_from_json(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void delete_one(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void delete_many(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void delete_all(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void write(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void write_async(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void begin_transaction(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void acquire_write(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void cancel_acquire_write(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void commit_transaction(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void cancel_transaction(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void refresh(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void pin_version(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void unpin_version(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void add_listener(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void wait_for_download_completion(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void remove_listener(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void remove_all_listeners(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void close(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void compact(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void compact_async(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void freeze(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void writeCopyTo(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void write_copy_to_async(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void delete_model(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void object_for_object_key(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void object_for_object_id(ContextType, ObjectType, Arguments&, ReturnValue&);
@@ -359,6 +779,8 @@ public:
     static void get_read_only(ContextType, ObjectType, ReturnValue&);
     static void get_is_in_transaction(ContextType, ObjectType, ReturnValue&);
     static void get_is_closed(ContextType, ObjectType, ReturnValue&);
+    static void get_is_frozen(ContextType, ObjectType, ReturnValue&);
+    static void get_version_id(ContextType, ObjectType, ReturnValue&);
 #if REALM_ENABLE_SYNC
     static void get_sync_session(ContextType, ObjectType, ReturnValue&);
     static void get_subscriptions(ContextType, ObjectType, ReturnValue&);
@@ -366,24 +788,51 @@ public:
 
     // static methods
     static void constructor(ContextType, ObjectType, Arguments&);
-    static SharedRealm create_shared_realm(ContextType, realm::Realm::Config, bool, ObjectDefaultsMap&&,
+    static SharedRealm create_shared_realm(ContextType, realm::Realm::Config, bool, SharedObjectDefaultsMap&&,
                                            ConstructorMap&&);
+    static std::optional<uint64_t> fingerprint_config(ContextType ctx, size_t argc, const ValueType arguments[],
+                                                      ConstructorMap& constructors);
     static bool get_realm_config(ContextType ctx, size_t argc, const ValueType arguments[], realm::Realm::Config&,
-                                 ObjectDefaultsMap&, ConstructorMap&);
+                                 SharedObjectDefaultsMap&, ConstructorMap&);
+    static void apply_notification_policy(ContextType ctx, size_t argc, const ValueType arguments[],
+                                          SharedRealm const& realm);
+    static void apply_config_access_pattern(ContextType ctx, size_t argc, const ValueType arguments[],
+                                            SharedRealm const& realm);
+    static void advise_access_pattern(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void apply_in_memory_pin(ContextType ctx, size_t argc, const ValueType arguments[],
+                                    SharedRealm const& realm);
+    static void unpin_in_memory(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void set_binding_context(ContextType ctx, std::shared_ptr<Realm> const& realm, bool schema_updated,
+                                    SharedObjectDefaultsMap&& defaults, ConstructorMap&& constructors);
     static void set_binding_context(ContextType ctx, std::shared_ptr<Realm> const& realm, bool schema_updated,
-                                    ObjectDefaultsMap&& defaults, ConstructorMap&& constructors);
+                                    SharedObjectDefaultsMap&& defaults, SharedConstructorMap&& constructors);
     static void handle_initial_subscriptions(ContextType ctx, size_t argc, const ValueType arguments[],
                                              SharedRealm realm_object, bool realm_exists);
+#if REALM_ENABLE_SYNC
+    static void warm_encrypted_pages(SharedRealm const& realm);
+#endif
 
     static void schema_version(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void open_frozen(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void import_results_handle(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void clear_test_state(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void set_batched_notifications(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void get_metrics(ContextType, ObjectType, ReturnValue&);
+    static void reset_metrics(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void memory_stats(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void get_startup_trace(ContextType, ObjectType, ReturnValue&);
+    static void schema_to_binary(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void copy_bundled_realm_files(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void copy_bundled_realm_files_async(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void delete_file(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void delete_file_async(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void realm_file_exists(ContextType, ObjectType, Arguments&, ReturnValue&);
 
     static void bson_parse_json(ContextType, ObjectType, Arguments&, ReturnValue&);
 
     // helper methods
+    static realm::CreatePolicy validated_create_policy(ContextType ctx, Arguments& args, size_t arg_index);
+    static SharedRealm freeze_realm(ContextType ctx, SharedRealm const& realm);
     static realm::Realm::Config write_copy_to_helper(ContextType ctx, ObjectType this_object, Arguments& args);
     static realm::Realm::Config write_copy_to_helper_deprecated(ContextType ctx, ObjectType this_object,
                                                                 Arguments& args);
@@ -399,9 +848,18 @@ public:
         {"schemaVersion", wrap<schema_version>},
         {"clearTestState", wrap<clear_test_state>},
         {"copyBundledRealmFiles", wrap<copy_bundled_realm_files>},
+        {"_copyBundledRealmFilesAsync", wrap<copy_bundled_realm_files_async>},
         {"deleteFile", wrap<delete_file>},
+        {"_deleteFileAsync", wrap<delete_file_async>},
         {"exists", wrap<realm_file_exists>},
         {"_bsonParseJsonForTest", wrap<bson_parse_json>},
+        {"_setBatchedNotifications", wrap<set_batched_notifications>},
+        {"_resetMetrics", wrap<reset_metrics>},
+        {"memoryStats", wrap<memory_stats>},
+        {"_schemaToBinary", wrap<schema_to_binary>},
+        {"_openFrozen", wrap<open_frozen>},
+        {"_unpinInMemory", wrap<unpin_in_memory>},
+        {"_importResultsHandle", wrap<import_results_handle>},
 #if REALM_ENABLE_SYNC
         {"_asyncOpen", wrap<async_open_realm>},
 #endif
@@ -409,24 +867,40 @@ public:
 
     PropertyMap<T> const static_properties = {
         {"defaultPath", {wrap<get_default_path>, wrap<set_default_path>}},
+        {"_metrics", {wrap<get_metrics>, nullptr}},
+        {"_startupTrace", {wrap<get_startup_trace>, nullptr}},
     };
 
     MethodMap<T> const methods = {
         {"objects", wrap<objects>},
         {"objectForPrimaryKey", wrap<object_for_primary_key>},
+        {"compileQuery", wrap<compile_query>},
         {"create", wrap<create>},
+        {"createAll", wrap<create_all>},
+        {"createFromJson", wrap<create_from_json>},
         {"delete", wrap<delete_one>},
+        {"deleteMany", wrap<delete_many>},
         {"deleteAll", wrap<delete_all>},
         {"write", wrap<write>},
+        {"writeAsync", wrap<write_async>},
         {"beginTransaction", wrap<begin_transaction>},
+        {"_acquireWrite", wrap<acquire_write>},
+        {"_cancelAcquireWrite", wrap<cancel_acquire_write>},
         {"commitTransaction", wrap<commit_transaction>},
         {"cancelTransaction", wrap<cancel_transaction>},
+        {"refresh", wrap<refresh>},
+        {"pin", wrap<pin_version>},
+        {"unpin", wrap<unpin_version>},
         {"addListener", wrap<add_listener>},
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
         {"close", wrap<close>},
+        {"_advise", wrap<advise_access_pattern>},
         {"compact", wrap<compact>},
+        {"freeze", wrap<freeze>},
         {"writeCopyTo", wrap<writeCopyTo>},
+        {"_compactAsync", wrap<compact_async>},
+        {"_writeCopyToAsync", wrap<write_copy_to_async>},
         {"deleteModel", wrap<delete_model>},
         {"_objectForObjectKey", wrap<object_for_object_key>},
         {"_updateSchema", wrap<update_schema>},
@@ -442,6 +916,8 @@ public:
         {"readOnly", {wrap<get_read_only>, nullptr}},
         {"isInTransaction", {wrap<get_is_in_transaction>, nullptr}},
         {"isClosed", {wrap<get_is_closed>, nullptr}},
+        {"isFrozen", {wrap<get_is_frozen>, nullptr}},
+        {"_versionId", {wrap<get_version_id>, nullptr}},
 #if REALM_ENABLE_SYNC
         {"syncSession",
          { wrap<get_sync_session>,
@@ -464,7 +940,7 @@ private:
             FunctionType constructor = Value::to_constructor(ctx, value);
 
             auto delegate = get_delegate<T>(realm.get());
-            for (auto& pair : delegate->m_constructors) {
+            for (auto& pair : *delegate->m_constructors) {
                 if (FunctionType(pair.second) == constructor) {
                     object_type = pair.first;
                     break;
@@ -489,6 +965,15 @@ private:
         // read transaction before we search the schema.
         realm->read_group();
 
+        // O(1) through the delegate's lookup table when one is bound; the
+        // schema's own search covers Realms without a delegate.
+        if (auto delegate = get_delegate<T>(realm.get())) {
+            if (auto object_schema = delegate->find_object_schema(object_type)) {
+                return *object_schema;
+            }
+            throw std::runtime_error("Object type '" + object_type + "' not found in schema.");
+        }
+
         auto& schema = realm->schema();
         auto object_schema = schema.find(object_type);
 
@@ -551,6 +1036,38 @@ inline typename T::Function RealmClass<T>::create_constructor(ContextType ctx)
     Object::set_property(ctx, realm_constructor, "Object", realm_object_constructor, attributes);
 
 #if REALM_ENABLE_SYNC
+    // The sync surface is a dozen class registrations that local-only
+    // consumers (most CLI tools) never touch, yet used to be paid in full at
+    // require time. Each top-level property starts out as a lazy accessor;
+    // the first touch of any of them materializes the whole surface at once,
+    // since the sync classes construct instances of one another internally
+    // and all need their constructors registered before that happens.
+    for (auto name : {"App", "Credentials", "User", "ResponseHandler", "Auth"}) {
+        Object::set_lazy_property(ctx, realm_constructor, name,
+                                  [](ContextType ctx, ObjectType object, StringData requested) {
+                                      return create_sync_constructors(ctx, object, requested);
+                                  });
+    }
+#endif
+
+    if (getenv("REALM_DISABLE_SYNC_TO_DISK")) {
+        realm::disable_sync_to_disk();
+    }
+
+    Object::set_global(ctx, "Realm", realm_constructor);
+    return realm_constructor;
+}
+
+#if REALM_ENABLE_SYNC
+// Registers the whole sync class surface and replaces the lazy accessors on
+// the Realm constructor with the real values. Returns the constructor that
+// `requested` names, for the property access that triggered registration.
+template <typename T>
+inline typename T::Value RealmClass<T>::create_sync_constructors(ContextType ctx, ObjectType realm_constructor,
+                                                                 StringData requested)
+{
+    PropertyAttributes attributes = ReadOnly | DontEnum | DontDelete;
+
     FunctionType app_constructor = AppClass<T>::create_constructor(ctx);
     Object::set_property(ctx, realm_constructor, "App", app_constructor, attributes);
 
@@ -577,19 +1094,29 @@ inline typename T::Function RealmClass<T>::create_constructor(ContextType ctx)
     Object::set_property(ctx, app_constructor, "Sync", sync_constructor, attributes);
 
     AsyncOpenTaskClass<T>::create_constructor(ctx);
-#endif
 
-    if (getenv("REALM_DISABLE_SYNC_TO_DISK")) {
-        realm::disable_sync_to_disk();
+    if (requested == "App") {
+        return app_constructor;
     }
-
-    Object::set_global(ctx, "Realm", realm_constructor);
-    return realm_constructor;
+    if (requested == "Credentials") {
+        return credentials_constructor;
+    }
+    if (requested == "User") {
+        return user_constructor;
+    }
+    if (requested == "ResponseHandler") {
+        return response_handler_constructor;
+    }
+    if (requested == "Auth") {
+        return auth_constructor;
+    }
+    throw std::logic_error(util::format("Unknown sync constructor: %1", requested));
 }
+#endif
 
 template <typename T>
 bool RealmClass<T>::get_realm_config(ContextType ctx, size_t argc, const ValueType arguments[],
-                                     realm::Realm::Config& config, ObjectDefaultsMap& defaults,
+                                     realm::Realm::Config& config, SharedObjectDefaultsMap& defaults,
                                      ConstructorMap& constructors)
 {
     bool schema_updated = false;
@@ -673,8 +1200,19 @@ bool RealmClass<T>::get_realm_config(ContextType ctx, size_t argc, const ValueTy
             static const String schema_string = "schema";
             ValueType schema_value = Object::get_property(ctx, object, schema_string);
             if (!Value::is_undefined(ctx, schema_value)) {
-                ObjectType schema_array = Value::validated_to_array(ctx, schema_value, "schema");
-                config.schema.emplace(Schema<T>::parse_schema(ctx, schema_array, defaults, constructors));
+                if (Value::is_binary(ctx, schema_value)) {
+                    // A precompiled blob from Realm._schemaToBinary: one
+                    // linear scan instead of walking JS schema objects.
+                    OwnedBinaryData storage;
+                    BinaryData blob = Value::to_binary_view(ctx, schema_value, storage);
+                    ObjectDefaultsMap binary_defaults;
+                    config.schema.emplace(Schema<T>::schema_from_binary(ctx, blob, binary_defaults));
+                    defaults = std::make_shared<const ObjectDefaultsMap>(std::move(binary_defaults));
+                }
+                else {
+                    ObjectType schema_array = Value::validated_to_array(ctx, schema_value, "schema");
+                    config.schema.emplace(Schema<T>::parse_schema(ctx, schema_array, defaults, constructors));
+                }
                 schema_updated = true;
             }
 
@@ -694,11 +1232,53 @@ bool RealmClass<T>::get_realm_config(ContextType ctx, size_t argc, const ValueTy
                     throw std::invalid_argument("Cannot set 'shouldCompactOnLaunch' when 'readOnly' is set.");
                 }
 
-                FunctionType should_compact_on_launch_function =
-                    Value::validated_to_function(ctx, compact_value, "shouldCompactOnLaunch");
-                ShouldCompactOnLaunchFunctor<T> should_compact_on_launch_functor{ctx,
-                                                                                 should_compact_on_launch_function};
-                config.should_compact_on_launch_function = std::move(should_compact_on_launch_functor);
+                if (Value::is_function(ctx, compact_value)) {
+                    FunctionType should_compact_on_launch_function =
+                        Value::validated_to_function(ctx, compact_value, "shouldCompactOnLaunch");
+                    ShouldCompactOnLaunchFunctor<T> should_compact_on_launch_functor{
+                        ctx, should_compact_on_launch_function};
+                    config.should_compact_on_launch_function = std::move(should_compact_on_launch_functor);
+                }
+                else {
+                    // Declarative form: {thresholdBytes, usedRatio}. The decision
+                    // runs entirely in C++ on the thread that opens the Realm, so
+                    // no round-trip through the JS event loop is needed. The
+                    // callback form above remains available for custom logic.
+                    static const String threshold_bytes_string = "thresholdBytes";
+                    static const String used_ratio_string = "usedRatio";
+                    ObjectType compact_object = Value::validated_to_object(ctx, compact_value, "shouldCompactOnLaunch");
+
+                    ValueType threshold_value = Object::get_property(ctx, compact_object, threshold_bytes_string);
+                    ValueType ratio_value = Object::get_property(ctx, compact_object, used_ratio_string);
+                    if (Value::is_undefined(ctx, threshold_value) && Value::is_undefined(ctx, ratio_value)) {
+                        throw std::invalid_argument("Expected 'shouldCompactOnLaunch' to be a function or an object "
+                                                    "with 'thresholdBytes' and/or 'usedRatio'.");
+                    }
+
+                    uint64_t threshold_bytes = 0;
+                    if (!Value::is_undefined(ctx, threshold_value)) {
+                        double threshold = Value::validated_to_number(ctx, threshold_value, "thresholdBytes");
+                        if (threshold < 0) {
+                            throw std::invalid_argument("'thresholdBytes' must not be negative.");
+                        }
+                        threshold_bytes = static_cast<uint64_t>(threshold);
+                    }
+
+                    double used_ratio = 1.0;
+                    if (!Value::is_undefined(ctx, ratio_value)) {
+                        used_ratio = Value::validated_to_number(ctx, ratio_value, "usedRatio");
+                        if (used_ratio < 0 || used_ratio > 1) {
+                            throw std::invalid_argument("'usedRatio' must be between 0 and 1.");
+                        }
+                    }
+
+                    config.should_compact_on_launch_function = [threshold_bytes,
+                                                                used_ratio](uint64_t total_bytes,
+                                                                            uint64_t used_bytes) {
+                        return total_bytes > threshold_bytes &&
+                               static_cast<double>(used_bytes) / static_cast<double>(total_bytes) < used_ratio;
+                    };
+                }
             }
 
             static const String data_initialization_string = "onFirstOpen";
@@ -867,76 +1447,356 @@ void RealmClass<T>::handle_initial_subscriptions(ContextType ctx, size_t argc, c
     }
 }
 
-template <typename T>
-void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, Arguments& args)
-{
-    set_internal<T, RealmClass<T>>(ctx, this_object, nullptr);
-    realm::Realm::Config config;
-    ObjectDefaultsMap defaults;
-    ConstructorMap constructors;
+// Process-wide anchors for named in-memory Realms opened with
+// `pinInMemory: true`. An in-memory Realm's storage lives only while some
+// instance holds its coordinator, so without a pin a hot cache evaporates as
+// soon as the last JS context closes it. The anchor is a frozen instance:
+// frozen Realms may be held and dropped from any thread, and holding one
+// keeps the coordinator — and with it the shared memory image — alive for
+// the next open of the same name.
+class InMemoryPins {
+public:
+    static InMemoryPins& shared()
+    {
+        static InMemoryPins s_pins;
+        return s_pins;
+    }
 
-    bool schema_updated = get_realm_config(ctx, args.count, args.value, config, defaults, constructors);
-    bool realm_exists = realm::util::File::exists(config.path);
+    void pin(SharedRealm const& realm)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pins.emplace(realm->config().path, realm->freeze());
+    }
 
-    auto realm = create_shared_realm(ctx, config, schema_updated, std::move(defaults), std::move(constructors));
+    void unpin(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pins.erase(path);
+    }
 
-    set_internal<T, RealmClass<T>>(ctx, this_object, new SharedRealm(realm));
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pins.clear();
+    }
 
-    handle_initial_subscriptions(ctx, args.count, args.value, realm, realm_exists);
-}
+private:
+    std::mutex m_mutex;
+    std::map<std::string, SharedRealm> m_pins;
+};
 
 template <typename T>
-SharedRealm RealmClass<T>::create_shared_realm(ContextType ctx, realm::Realm::Config config, bool schema_updated,
-                                               ObjectDefaultsMap&& defaults, ConstructorMap&& constructors)
+// Realms are thread-confined, so the fingerprint cache of open Realms is too.
+// Entries hold weak references; closed or collected Realms age out when their
+// slot is next touched.
+static inline std::map<uint64_t, std::weak_ptr<realm::Realm>>& open_fingerprint_cache()
 {
-    config.scheduler = realm::util::Scheduler::make_default();
-
-    SharedRealm realm;
-    realm = realm::Realm::get_shared_realm(config);
-    set_binding_context(ctx, realm, schema_updated, std::move(defaults), std::move(constructors));
-
-    return realm;
+    static thread_local std::map<uint64_t, std::weak_ptr<realm::Realm>> s_cache;
+    return s_cache;
 }
 
+// Fingerprints a plain config object so a repeat open of an already-open
+// Realm can skip config validation, schema parsing and file-existence checks
+// entirely. Configs whose effect on the open cannot be captured structurally
+// — sync configs, migration and compaction callbacks, binary schemas,
+// encryption keys — return nullopt and take the full path. Schema
+// constructors are bound as a side effect: a cache hit still re-binds them
+// on the delegate, since two structurally identical schemas may carry
+// different classes.
 template <typename T>
-void RealmClass<T>::set_binding_context(ContextType ctx, std::shared_ptr<Realm> const& realm, bool schema_updated,
-                                        ObjectDefaultsMap&& defaults, ConstructorMap&& constructors)
+std::optional<uint64_t> RealmClass<T>::fingerprint_config(ContextType ctx, size_t argc,
+                                                          const ValueType arguments[],
+                                                          ConstructorMap& constructors)
 {
-    GlobalContextType global_context = Context<T>::get_global_context(ctx);
-    if (!realm->m_binding_context) {
-        realm->m_binding_context.reset(new RealmDelegate<T>(realm, global_context));
+    if (argc != 1 || !Value::is_object(ctx, arguments[0])) {
+        return std::nullopt;
     }
 
-    RealmDelegate<T>* js_binding_context = dynamic_cast<RealmDelegate<T>*>(realm->m_binding_context.get());
-    REALM_ASSERT(js_binding_context);
-    REALM_ASSERT(js_binding_context->m_context == global_context);
-
-    // If a new schema was provided, then use its defaults and constructors.
-    if (schema_updated) {
-        js_binding_context->m_defaults = std::move(defaults);
-        js_binding_context->m_constructors = std::move(constructors);
+    ObjectType object = Value::validated_to_object(ctx, arguments[0]);
+    uint64_t hash = Schema<T>::s_hash_seed;
+    auto keys = Object::get_property_names(ctx, object);
+    for (auto& key : keys) {
+        std::string name(key);
+        if (name == "sync") {
+            // Sync configs hold user objects and callbacks that the hash
+            // cannot see, and opening them has side effects (subscriptions).
+            return std::nullopt;
+        }
+        Schema<T>::hash_string(hash, name);
+        ValueType value = Object::get_property(ctx, object, key);
+        if (name == "schema" && Value::is_object(ctx, value) && Value::is_array(ctx, value)) {
+            auto schema_hash = Schema<T>::hash_schema(ctx, Value::to_object(ctx, value), constructors);
+            if (!schema_hash) {
+                return std::nullopt;
+            }
+            Schema<T>::hash_combine(hash, &*schema_hash, sizeof(*schema_hash));
+            continue;
+        }
+        if (!Schema<T>::hash_schema_value(ctx, value, hash, 4)) {
+            return std::nullopt;
+        }
     }
+    return hash;
 }
 
+// Install the per-instance notification policy from the config's
+// `notificationPolicy` key, if present. The policy only shapes how external
+// commits wake this process — `coalesceWindowMs` and `maxWakesPerSecond`
+// both derive a minimum interval between JS-visible refreshes, and
+// `manualRefresh` disables automatic version advances entirely in favour of
+// explicit realm.refresh() calls. Local writes are unaffected. See
+// RealmDelegate::changes_available for the delivery logic.
 template <typename T>
-void RealmClass<T>::schema_version(ContextType ctx, ObjectType this_object, Arguments& args,
-                                   ReturnValue& return_value)
+void RealmClass<T>::apply_notification_policy(ContextType ctx, size_t argc, const ValueType arguments[],
+                                              SharedRealm const& realm)
 {
-    args.validate_maximum(2);
+    if (argc == 0 || !Value::is_object(ctx, arguments[0])) {
+        return;
+    }
+    ObjectType config_object = Value::validated_to_object(ctx, arguments[0]);
+    static const String policy_string = "notificationPolicy";
+    ValueType policy_value = Object::get_property(ctx, config_object, policy_string);
+    if (Value::is_undefined(ctx, policy_value)) {
+        return;
+    }
+    ObjectType policy_object = Value::validated_to_object(ctx, policy_value, "notificationPolicy");
 
-    realm::Realm::Config config;
-    config.path = normalize_realm_path(Value::validated_to_string(ctx, args[0]));
-    if (args.count == 2) {
-        auto encryption_key = Value::validated_to_binary(ctx, args[1], "encryptionKey");
-        config.encryption_key.assign(encryption_key.data(), encryption_key.data() + encryption_key.size());
+    typename RealmDelegate<T>::NotificationPolicy policy;
+
+    static const String manual_refresh_string = "manualRefresh";
+    ValueType manual_refresh_value = Object::get_property(ctx, policy_object, manual_refresh_string);
+    if (!Value::is_undefined(ctx, manual_refresh_value)) {
+        policy.manual_refresh = Value::validated_to_boolean(ctx, manual_refresh_value, "manualRefresh");
     }
 
-    auto version = realm::Realm::get_schema_version(config);
-    if (version == ObjectStore::NotVersioned) {
-        return_value.set(-1);
+    double min_interval_ms = 0;
+    static const String coalesce_window_string = "coalesceWindowMs";
+    ValueType coalesce_window_value = Object::get_property(ctx, policy_object, coalesce_window_string);
+    if (!Value::is_undefined(ctx, coalesce_window_value)) {
+        min_interval_ms = Value::validated_to_number(ctx, coalesce_window_value, "coalesceWindowMs");
     }
-    else {
-        return_value.set((double)version);
+    static const String max_wakes_string = "maxWakesPerSecond";
+    ValueType max_wakes_value = Object::get_property(ctx, policy_object, max_wakes_string);
+    if (!Value::is_undefined(ctx, max_wakes_value)) {
+        double max_wakes = Value::validated_to_number(ctx, max_wakes_value, "maxWakesPerSecond");
+        if (max_wakes <= 0) {
+            throw std::invalid_argument("maxWakesPerSecond must be greater than zero.");
+        }
+        min_interval_ms = std::max(min_interval_ms, 1000.0 / max_wakes);
+    }
+    if (min_interval_ms < 0) {
+        throw std::invalid_argument("coalesceWindowMs cannot be negative.");
+    }
+    policy.min_interval = std::chrono::milliseconds(static_cast<int64_t>(min_interval_ms));
+
+    if (auto delegate = get_delegate<T>(realm.get())) {
+        delegate->m_notification_policy = policy;
+        delegate->m_has_notification_policy = true;
+    }
+    // With the policy in charge, core stops refreshing on its own and calls
+    // RealmDelegate::changes_available instead when a commit lands.
+    realm->set_auto_refresh(false);
+}
+
+// Binding-level `accessPattern` config option — Realm::Config has no
+// equivalent field, so it is read straight off the config object and applied
+// to the file's mappings after open. See js_io_hints.hpp for what the hint
+// can and cannot do per platform.
+template <typename T>
+void RealmClass<T>::apply_config_access_pattern(ContextType ctx, size_t argc, const ValueType arguments[],
+                                                SharedRealm const& realm)
+{
+    if (argc == 0 || !Value::is_object(ctx, arguments[0])) {
+        return;
+    }
+    ObjectType config_object = Value::validated_to_object(ctx, arguments[0]);
+    static const String pattern_string = "accessPattern";
+    ValueType pattern_value = Object::get_property(ctx, config_object, pattern_string);
+    if (Value::is_undefined(ctx, pattern_value)) {
+        return;
+    }
+    std::string pattern_name = Value::validated_to_string(ctx, pattern_value, "accessPattern");
+    io_hints::apply_access_pattern(realm->config().path, io_hints::parse_access_pattern(pattern_name));
+}
+
+// Binding-level `pinInMemory` config option: anchors a named in-memory Realm
+// in the process-wide pin registry so its contents survive every JS instance
+// closing — the pattern behind using an in-memory Realm as a hot cache in
+// front of the synced store, without tmpfs paths or durability overhead.
+// Released through `Realm._unpinInMemory` or clearTestState.
+template <typename T>
+void RealmClass<T>::apply_in_memory_pin(ContextType ctx, size_t argc, const ValueType arguments[],
+                                        SharedRealm const& realm)
+{
+    if (argc == 0 || !Value::is_object(ctx, arguments[0])) {
+        return;
+    }
+    ObjectType config_object = Value::validated_to_object(ctx, arguments[0]);
+    static const String pin_string = "pinInMemory";
+    ValueType pin_value = Object::get_property(ctx, config_object, pin_string);
+    if (Value::is_undefined(ctx, pin_value) || !Value::validated_to_boolean(ctx, pin_value, "pinInMemory")) {
+        return;
+    }
+    if (!realm->config().in_memory) {
+        throw std::invalid_argument("Option 'pinInMemory' requires 'inMemory: true'.");
+    }
+    InMemoryPins::shared().pin(realm);
+}
+
+// `Realm._unpinInMemory(path?)` — drops the anchor for one named in-memory
+// Realm, or all of them when called without arguments. The storage is freed
+// once the last open instance goes away.
+template <typename T>
+void RealmClass<T>::unpin_in_memory(ContextType ctx, ObjectType this_object, Arguments& args,
+                                    ReturnValue& return_value)
+{
+    args.validate<Optional<StringArgument>>();
+
+    if (args.count == 0 || Value::is_undefined(ctx, args[0])) {
+        InMemoryPins::shared().clear();
+        return;
+    }
+    std::string path = Value::validated_to_string(ctx, args[0], "path");
+    InMemoryPins::shared().unpin(normalize_realm_path(std::move(path)));
+}
+
+// `realm._advise(pattern)` — re-applies an access-pattern hint on demand, so
+// a long-lived process can switch to 'sequential' around an export job and
+// back to 'random' for serving without reopening the Realm.
+template <typename T>
+void RealmClass<T>::advise_access_pattern(ContextType ctx, ObjectType this_object, Arguments& args,
+                                          ReturnValue& return_value)
+{
+    args.validate<StringArgument>();
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    std::string pattern_name = Value::validated_to_string(ctx, args[0], "accessPattern");
+    io_hints::apply_access_pattern(realm->config().path, io_hints::parse_access_pattern(pattern_name));
+}
+
+template <typename T>
+void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, Arguments& args)
+{
+    set_internal<T, RealmClass<T>>(ctx, this_object, nullptr);
+
+    ConstructorMap fingerprint_constructors;
+    auto fingerprint = fingerprint_config(ctx, args.count, args.value, fingerprint_constructors);
+    if (fingerprint) {
+        auto& cache = open_fingerprint_cache();
+        auto it = cache.find(*fingerprint);
+        if (it != cache.end()) {
+            SharedRealm realm = it->second.lock();
+            if (realm && !realm->is_closed()) {
+                if (auto delegate = get_delegate<T>(realm.get())) {
+                    // Same config, Realm still open: hand out the cached
+                    // instance and just re-bind the constructors, which may
+                    // be fresh function objects from a re-imported module.
+                    if (!fingerprint_constructors.empty()) {
+                        delegate->m_constructors =
+                            std::make_shared<const ConstructorMap>(std::move(fingerprint_constructors));
+                    }
+                    set_internal<T, RealmClass<T>>(ctx, this_object, new SharedRealm(std::move(realm)));
+                    return;
+                }
+            }
+            cache.erase(it);
+        }
+    }
+
+    realm::Realm::Config config;
+    SharedObjectDefaultsMap defaults;
+    ConstructorMap constructors;
+
+    bool schema_updated = get_realm_config(ctx, args.count, args.value, config, defaults, constructors);
+    bool realm_exists = realm::util::File::exists(config.path);
+
+    auto realm = create_shared_realm(ctx, config, schema_updated, std::move(defaults), std::move(constructors));
+    apply_notification_policy(ctx, args.count, args.value, realm);
+    apply_config_access_pattern(ctx, args.count, args.value, realm);
+    apply_in_memory_pin(ctx, args.count, args.value, realm);
+
+    set_internal<T, RealmClass<T>>(ctx, this_object, new SharedRealm(realm));
+
+    if (fingerprint) {
+        auto& cache = open_fingerprint_cache();
+        // Prune entries whose Realm has gone away while we're here.
+        for (auto it = cache.begin(); it != cache.end();) {
+            it = it->second.expired() ? cache.erase(it) : std::next(it);
+        }
+        cache[*fingerprint] = realm;
+    }
+
+    handle_initial_subscriptions(ctx, args.count, args.value, realm, realm_exists);
+}
+
+template <typename T>
+SharedRealm RealmClass<T>::create_shared_realm(ContextType ctx, realm::Realm::Config config, bool schema_updated,
+                                               SharedObjectDefaultsMap&& defaults, ConstructorMap&& constructors)
+{
+    config.scheduler = realm::util::Scheduler::make_default();
+
+    SharedRealm realm;
+    {
+        startup::PhaseTimer timer("fileOpen");
+        realm = realm::Realm::get_shared_realm(config);
+    }
+    set_binding_context(ctx, realm, schema_updated, std::move(defaults), std::move(constructors));
+
+    return realm;
+}
+
+template <typename T>
+void RealmClass<T>::set_binding_context(ContextType ctx, std::shared_ptr<Realm> const& realm, bool schema_updated,
+                                        SharedObjectDefaultsMap&& defaults, ConstructorMap&& constructors)
+{
+    set_binding_context(ctx, realm, schema_updated, std::move(defaults),
+                        std::make_shared<const ConstructorMap>(std::move(constructors)));
+}
+
+template <typename T>
+void RealmClass<T>::set_binding_context(ContextType ctx, std::shared_ptr<Realm> const& realm, bool schema_updated,
+                                        SharedObjectDefaultsMap&& defaults, SharedConstructorMap&& constructors)
+{
+    GlobalContextType global_context = Context<T>::get_global_context(ctx);
+    OpenRealmRegistry::shared().add(realm);
+    if (!realm->m_binding_context) {
+        realm->m_binding_context.reset(new RealmDelegate<T>(realm, global_context));
+    }
+
+    RealmDelegate<T>* js_binding_context = dynamic_cast<RealmDelegate<T>*>(realm->m_binding_context.get());
+    REALM_ASSERT(js_binding_context);
+    REALM_ASSERT(js_binding_context->m_context == global_context);
+
+    // If a new schema was provided, then use its defaults and constructors.
+    // The maps are adopted, not copied: further instances built from the same
+    // schema parse (or frozen from this one) share them.
+    if (schema_updated) {
+        js_binding_context->m_defaults =
+            defaults ? std::move(defaults) : std::make_shared<const ObjectDefaultsMap>();
+        js_binding_context->m_constructors =
+            constructors ? std::move(constructors) : std::make_shared<const ConstructorMap>();
+    }
+}
+
+template <typename T>
+void RealmClass<T>::schema_version(ContextType ctx, ObjectType this_object, Arguments& args,
+                                   ReturnValue& return_value)
+{
+    args.validate_maximum(2);
+
+    realm::Realm::Config config;
+    config.path = normalize_realm_path(Value::validated_to_string(ctx, args[0]));
+    if (args.count == 2) {
+        auto encryption_key = Value::validated_to_binary(ctx, args[1], "encryptionKey");
+        config.encryption_key.assign(encryption_key.data(), encryption_key.data() + encryption_key.size());
+    }
+
+    auto version = realm::Realm::get_schema_version(config);
+    if (version == ObjectStore::NotVersioned) {
+        return_value.set(-1);
+    }
+    else {
+        return_value.set((double)version);
     }
 }
 
@@ -946,12 +1806,152 @@ void RealmClass<T>::clear_test_state(ContextType ctx, ObjectType this_object, Ar
                                      ReturnValue& return_value)
 {
     args.validate_maximum(0);
+    Schema<T>::clear_parse_cache();
+    InMemoryPins::shared().clear();
     js::clear_test_state();
 #if REALM_ENABLE_SYNC
     realm::app::App::clear_cached_apps();
 #endif
 }
 
+template <typename T>
+void RealmClass<T>::set_batched_notifications(ContextType ctx, ObjectType this_object, Arguments& args,
+                                              ReturnValue& return_value)
+{
+    args.validate_maximum(1);
+    notifications::NotificationBatcher<T>::enabled() = Value::validated_to_boolean(ctx, args[0], "enabled");
+}
+
+template <typename T>
+void RealmClass<T>::get_metrics(ContextType ctx, ObjectType this_object, ReturnValue& return_value)
+{
+    auto& counters = metrics::counters();
+    auto load = [](std::atomic<uint64_t> const& counter) {
+        return static_cast<double>(counter.load(std::memory_order_relaxed));
+    };
+    return_value.set(Object::create_obj(
+        ctx, {{"valuesUnboxed", Value::from_number(ctx, load(counters.values_unboxed))},
+              {"writes", Value::from_number(ctx, load(counters.writes))},
+              {"writeNanos", Value::from_number(ctx, load(counters.write_nanos))},
+              {"commits", Value::from_number(ctx, load(counters.commits))},
+              {"notificationsDelivered", Value::from_number(ctx, load(counters.notifications_delivered))},
+              {"proxyGetTraps", Value::from_number(ctx, load(counters.proxy_get_traps))},
+              {"proxySetTraps", Value::from_number(ctx, load(counters.proxy_set_traps))},
+              {"schemaCacheHits", Value::from_number(ctx, load(counters.schema_cache_hits))},
+              {"schemaCacheMisses", Value::from_number(ctx, load(counters.schema_cache_misses))},
+              {"schemaCacheEvictions", Value::from_number(ctx, load(counters.schema_cache_evictions))},
+              {"networkRequestAttempts", Value::from_number(ctx, load(counters.network_request_attempts))},
+              {"networkRequestRetries", Value::from_number(ctx, load(counters.network_request_retries))},
+              {"networkRequestNanos", Value::from_number(ctx, load(counters.network_request_nanos))},
+              {"dispatchPosts", Value::from_number(ctx, load(counters.dispatch_posts))},
+              {"dispatchWakeups", Value::from_number(ctx, load(counters.dispatch_wakeups))},
+              {"dispatchQueueNanos", Value::from_number(ctx, load(counters.dispatch_queue_nanos))},
+              {"writeLockWaits", Value::from_number(ctx, load(counters.write_lock_waits))},
+              {"writeLockWaitNanos", Value::from_number(ctx, load(counters.write_lock_wait_nanos))},
+              {"writeLockMaxWaitNanos", Value::from_number(ctx, load(counters.write_lock_max_wait_nanos))},
+              {"writeLockQueueDepth", Value::from_number(ctx, load(counters.write_lock_queue_depth))}}));
+}
+
+template <typename T>
+void RealmClass<T>::reset_metrics(ContextType ctx, ObjectType this_object, Arguments& args,
+                                  ReturnValue& return_value)
+{
+    args.validate_maximum(0);
+    metrics::counters().reset();
+}
+
+template <typename T>
+void RealmClass<T>::get_startup_trace(ContextType ctx, ObjectType this_object, ReturnValue& return_value)
+{
+    auto origin = startup::Trace::shared().origin();
+    auto to_ms = [](std::chrono::steady_clock::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count();
+    };
+    std::vector<ValueType> entries;
+    for (auto const& phase : startup::Trace::shared().snapshot()) {
+        entries.push_back(
+            Object::create_obj(ctx, {{"phase", Value::from_string(ctx, phase.name)},
+                                     {"start", Value::from_number(ctx, to_ms(phase.start - origin))},
+                                     {"duration", Value::from_number(ctx, to_ms(phase.duration))}}));
+    }
+    return_value.set(Object::create_array(ctx, entries));
+}
+
+template <typename T>
+void RealmClass<T>::memory_stats(ContextType ctx, ObjectType this_object, Arguments& args,
+                                 ReturnValue& return_value)
+{
+    args.validate_maximum(0);
+
+    ObjectType wrapped_objects = Object::create_empty(ctx);
+    for (auto const& [class_name, count] : MemoryCensus::shared().wrapper_counts()) {
+        Object::set_property(ctx, wrapped_objects, class_name, Value::from_number(ctx, (double)count));
+    }
+
+    auto open_realms = OpenRealmRegistry::shared().live();
+    std::vector<ValueType> realm_entries;
+    realm_entries.reserve(open_realms.size());
+    for (auto const& realm : open_realms) {
+        auto const& config = realm->config();
+        double file_size = 0;
+        if (!config.in_memory) {
+            try {
+                file_size = (double)util::File::get_size_static(config.path);
+            }
+            catch (...) {
+                // file may be gone (deleteRealm with the Realm still open)
+            }
+        }
+        double live_versions = 0;
+        try {
+            live_versions = (double)realm->get_number_of_versions();
+        }
+        catch (...) {
+            // closed since the registry snapshot was taken
+        }
+        size_t pin_count = 0;
+        if (auto* delegate = get_delegate<T>(realm.get())) {
+            pin_count = delegate->m_pin_count;
+        }
+        realm_entries.push_back(Object::create_obj(
+            ctx, {{"path", Value::from_string(ctx, config.path)},
+                  {"fileSize", Value::from_number(ctx, file_size)},
+                  {"liveVersions", Value::from_number(ctx, live_versions)},
+                  {"pinnedVersions", Value::from_number(ctx, (double)pin_count)}}));
+    }
+
+    return_value.set(Object::create_obj(
+        ctx,
+        {{"wrappedObjects", wrapped_objects},
+         {"protectedReferences",
+          Value::from_number(ctx, (double)MemoryCensus::shared().protected_references.load())},
+         {"notificationTokens", Value::from_number(ctx, (double)notifications::total_token_count().load())},
+         {"openRealmCount", Value::from_number(ctx, (double)open_realms.size())},
+         {"openRealms", Object::create_array(ctx, realm_entries)}}));
+}
+
+// Build-time half of the precompiled schema flow: parses a JS schema array
+// and returns the compact blob that `Realm.open` accepts in place of the
+// array. Meant to run in a build step; the app ships the blob and skips
+// schema parsing at startup.
+template <typename T>
+void RealmClass<T>::schema_to_binary(ContextType ctx, ObjectType this_object, Arguments& args,
+                                     ReturnValue& return_value)
+{
+    args.validate_count(1);
+
+    ObjectType schema_array = Value::validated_to_array(ctx, args[0], "schema");
+    SharedObjectDefaultsMap defaults;
+    ConstructorMap constructors;
+    realm::Schema schema = Schema<T>::parse_schema(ctx, schema_array, defaults, constructors);
+    if (!constructors.empty()) {
+        throw std::invalid_argument(
+            "Cannot precompile a schema containing class constructors; pass plain object schemas.");
+    }
+    std::string blob = Schema<T>::schema_to_binary(ctx, schema, *defaults);
+    return_value.set(Value::from_binary(ctx, BinaryData(blob.data(), blob.size())));
+}
+
 template <typename T>
 void RealmClass<T>::copy_bundled_realm_files(ContextType ctx, ObjectType this_object, Arguments& args,
                                              ReturnValue& return_value)
@@ -960,6 +1960,47 @@ void RealmClass<T>::copy_bundled_realm_files(ContextType ctx, ObjectType this_ob
     realm::copy_bundled_realm_files();
 }
 
+// Asynchronous variant of `copyBundledRealmFiles`. Copying bundled Realms is
+// pure file I/O, so it runs on a worker thread and the completion callback
+// receives (error) back on the JS thread — lib/ wraps this in a promise. The
+// synchronous form stays for startup-ordering cases that must finish before
+// the first open.
+template <typename T>
+void RealmClass<T>::copy_bundled_realm_files_async(ContextType ctx, ObjectType this_object, Arguments& args,
+                                                   ReturnValue& return_value)
+{
+    args.validate_count(1);
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<FunctionType> protected_completion(ctx, Value::validated_to_function(ctx, args[0], "completion"));
+
+    realm::util::EventLoopDispatcher<void(std::exception_ptr)> completion_handler(
+        [protected_ctx, protected_completion](std::exception_ptr error) {
+            HANDLESCOPE(protected_ctx)
+            ValueType callback_arguments[1] = {Value::from_undefined(protected_ctx)};
+            if (error) {
+                try {
+                    std::rethrow_exception(error);
+                }
+                catch (const std::exception& e) {
+                    callback_arguments[0] = Object::create_error(protected_ctx, e.what());
+                }
+            }
+            Function<T>::callback(protected_ctx, protected_completion, 1, callback_arguments);
+        });
+
+    std::thread([completion_handler]() mutable {
+        std::exception_ptr error;
+        try {
+            realm::copy_bundled_realm_files();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        completion_handler(error);
+    }).detach();
+}
+
 template <typename T>
 void RealmClass<T>::delete_file(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
@@ -972,6 +2013,52 @@ void RealmClass<T>::delete_file(ContextType ctx, ObjectType this_object, Argumen
     realm::remove_directory(realm_file_path + ".management");
 }
 
+// Asynchronous variant of `deleteFile`. Removing a large Realm unlinks the
+// file, its lock and note siblings and the whole .management directory,
+// which can block the JS thread for tens of milliseconds; the config is
+// validated and the path resolved up front (both need the JS context), then
+// the removals run on a worker thread and the completion callback receives
+// (error) back on the JS thread — lib/ wraps this in a promise.
+template <typename T>
+void RealmClass<T>::delete_file_async(ContextType ctx, ObjectType this_object, Arguments& args,
+                                      ReturnValue& return_value)
+{
+    args.validate_count(2);
+    std::string realm_file_path = validate_and_normalize_config(ctx, args[0]).path;
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<FunctionType> protected_completion(ctx, Value::validated_to_function(ctx, args[1], "completion"));
+
+    realm::util::EventLoopDispatcher<void(std::exception_ptr)> completion_handler(
+        [protected_ctx, protected_completion](std::exception_ptr error) {
+            HANDLESCOPE(protected_ctx)
+            ValueType callback_arguments[1] = {Value::from_undefined(protected_ctx)};
+            if (error) {
+                try {
+                    std::rethrow_exception(error);
+                }
+                catch (const std::exception& e) {
+                    callback_arguments[0] = Object::create_error(protected_ctx, e.what());
+                }
+            }
+            Function<T>::callback(protected_ctx, protected_completion, 1, callback_arguments);
+        });
+
+    std::thread([realm_file_path = std::move(realm_file_path), completion_handler]() mutable {
+        std::exception_ptr error;
+        try {
+            realm::remove_file(realm_file_path);
+            realm::remove_file(realm_file_path + ".lock");
+            realm::remove_file(realm_file_path + ".note");
+            realm::remove_directory(realm_file_path + ".management");
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        completion_handler(error);
+    }).detach();
+}
+
 template <typename T>
 void RealmClass<T>::realm_file_exists(ContextType ctx, ObjectType this_object, Arguments& args,
                                       ReturnValue& return_value)
@@ -1029,6 +2116,19 @@ void RealmClass<T>::object_for_object_key(ContextType ctx, ObjectType object, Ar
 
     const SharedRealm& realm = *get_internal<T, RealmClass<T>>(ctx, object);
     auto& schema = validated_object_schema_for_value(ctx, realm, args[0]);
+
+    // Rehydrating a key seen earlier in this version hands back the cached
+    // wrapper without touching the table or boxing a new accessor. Skipped
+    // inside a write, where a row can go away without a version advance.
+    if (!realm->is_in_transaction()) {
+        if (auto delegate = get_delegate<T>(realm.get())) {
+            if (auto cached = delegate->find_cached_object(schema.table_key, ObjKey(object_key))) {
+                return_value.set(static_cast<ObjectType>(*cached));
+                return;
+            }
+        }
+    }
+
     auto table = realm->read_group().get_table(schema.table_key);
 
     auto obj = table->try_get_object(ObjKey(object_key));
@@ -1079,8 +2179,25 @@ void RealmClass<T>::get_schema_version(ContextType ctx, ObjectType object, Retur
 template <typename T>
 void RealmClass<T>::get_schema(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
-    auto& schema = get_internal<T, RealmClass<T>>(ctx, object)->get()->schema();
-    ObjectType schema_object = Schema<T>::object_for_schema(ctx, schema);
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, object);
+
+    // Rebuilding the JS schema representation walks every object schema and
+    // property descriptor, which adds up with large schemas and callers that
+    // read `realm.schema` per operation. The boxed object is cached per
+    // schema version and only rebuilt after update_schema.
+    auto delegate = get_delegate<T>(realm.get());
+    uint64_t schema_version = realm->schema_version();
+    if (delegate) {
+        if (auto cached = delegate->find_cached_schema(schema_version)) {
+            return_value.set(static_cast<ObjectType>(*cached));
+            return;
+        }
+    }
+
+    ObjectType schema_object = Schema<T>::object_for_schema(ctx, realm->schema());
+    if (delegate) {
+        delegate->cache_schema(schema_version, Protected<ObjectType>(ctx, schema_object));
+    }
     return_value.set(schema_object);
 }
 
@@ -1128,6 +2245,61 @@ void RealmClass<T>::get_sync_session(ContextType ctx, ObjectType object, ReturnV
 #endif
 
 #if REALM_ENABLE_SYNC
+// Touches every table of a freshly opened encrypted Realm so its pages are
+// decrypted up front instead of on first access, which otherwise makes the
+// first queries after an async open several times slower than on an
+// unencrypted file. The Realm is frozen first since frozen transactions may
+// be read from any thread, and the tables are split across a small pool.
+// Scalar columns are read per object; collection columns are only probed at
+// their root, which covers the column trees without walking every leaf.
+template <typename T>
+void RealmClass<T>::warm_encrypted_pages(SharedRealm const& realm)
+{
+    startup::PhaseTimer timer("encryptedWarmup");
+
+    SharedRealm frozen_realm = realm->freeze();
+    Group& group = frozen_realm->read_group();
+    auto table_keys = group.get_table_keys();
+    if (table_keys.empty()) {
+        return;
+    }
+
+    std::atomic<size_t> next_table{0};
+    auto scan_tables = [&] {
+        // A failed scan is just a cold page; the on-demand path will surface
+        // any real error.
+        try {
+            for (size_t index; (index = next_table.fetch_add(1)) < table_keys.size();) {
+                TableRef table = group.get_table(table_keys[index]);
+                auto columns = table->get_column_keys();
+                for (const Obj& obj : *table) {
+                    for (auto column : columns) {
+                        if (column.is_collection()) {
+                            static_cast<void>(obj.get_collection_ptr(column)->size());
+                        }
+                        else {
+                            static_cast<void>(obj.get_any(column));
+                        }
+                    }
+                }
+            }
+        }
+        catch (...) {
+        }
+    };
+
+    size_t worker_count = std::min({size_t(4), table_keys.size(),
+                                    std::max<size_t>(1, std::thread::hardware_concurrency())});
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < worker_count; ++i) {
+        workers.emplace_back(scan_tables);
+    }
+    scan_tables();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
 template <typename T>
 void RealmClass<T>::async_open_realm(ContextType ctx, ObjectType this_object, Arguments& args,
                                      ReturnValue& return_value)
@@ -1135,7 +2307,7 @@ void RealmClass<T>::async_open_realm(ContextType ctx, ObjectType this_object, Ar
     args.validate_maximum(2);
     auto callback_function = Value::validated_to_function(ctx, args[0 + (args.count == 2)]);
     Realm::Config config;
-    ObjectDefaultsMap defaults;
+    SharedObjectDefaultsMap defaults;
     ConstructorMap constructors;
 
     bool schema_updated = get_realm_config(ctx, args.count - 1, args.value, config, defaults, constructors);
@@ -1145,6 +2317,18 @@ void RealmClass<T>::async_open_realm(ContextType ctx, ObjectType this_object, Ar
         throw std::logic_error("_asyncOpen can only be used on a synchronized Realm.");
     }
 
+    // Binding-level option — Realm::Config has no equivalent field, so it is
+    // read straight off the config object rather than through
+    // get_realm_config. Only meaningful together with an encryption key.
+    bool warm_pages_requested = false;
+    if (args.count == 2 && Value::is_object(ctx, args[0])) {
+        ObjectType config_object = Value::validated_to_object(ctx, args[0]);
+        ValueType warm_value = Object::get_property(ctx, config_object, "warmEncryptedPages");
+        if (!Value::is_undefined(ctx, warm_value)) {
+            warm_pages_requested = Value::validated_to_boolean(ctx, warm_value, "warmEncryptedPages");
+        }
+    }
+
     Protected<FunctionType> protected_callback(ctx, callback_function);
     Protected<ObjectType> protected_this(ctx, this_object);
     Protected<ValueType> protected_args(ctx, *(args.value));
@@ -1168,54 +2352,79 @@ void RealmClass<T>::async_open_realm(ContextType ctx, ObjectType this_object, Ar
     std::shared_ptr<AsyncOpenTask> task;
     task = Realm::get_synchronized_realm(config);
 
-    realm::util::EventLoopDispatcher<RealmCallbackHandler> callback_handler([=, defaults = std::move(defaults),
-                                                                             constructors = std::move(constructors)](
-                                                                                ThreadSafeReference&& realm_ref,
-                                                                                std::exception_ptr error) {
-        HANDLESCOPE(protected_ctx)
-
-        if (error) {
-            try {
-                std::rethrow_exception(error);
+    // The dispatcher only holds a weak reference to the JS values; the strong
+    // reference lives in the AsyncOpenTaskHolder so cancel() can drop it.
+    struct CompletionState {
+        Protected<typename T::GlobalContext> ctx;
+        Protected<FunctionType> callback;
+        Protected<ObjectType> this_object;
+        Protected<ValueType> args_value;
+    };
+    auto completion_state = std::make_shared<CompletionState>(
+        CompletionState{protected_ctx, protected_callback, protected_this, protected_args});
+    std::weak_ptr<CompletionState> weak_completion = completion_state;
+
+    realm::util::EventLoopDispatcher<RealmCallbackHandler> callback_handler(
+        [weak_completion, schema_updated, realm_exists, warm_pages_requested, argc = args.count - 1,
+         defaults = std::move(defaults),
+         constructors = std::move(constructors)](ThreadSafeReference&& realm_ref, std::exception_ptr error) mutable {
+            auto state = weak_completion.lock();
+            if (!state) {
+                // The task was cancelled; its JS references are already gone.
+                return;
             }
-            catch (const std::exception& e) {
-                ObjectType object = Object::create_empty(protected_ctx);
-                Object::set_property(protected_ctx, object, "message", Value::from_string(protected_ctx, e.what()));
-                Object::set_property(protected_ctx, object, "errorCode", Value::from_number(protected_ctx, 1));
+            Protected<typename T::GlobalContext>& protected_ctx = state->ctx;
+            HANDLESCOPE(protected_ctx)
 
-                ValueType callback_arguments[2] = {
-                    Value::from_undefined(protected_ctx),
-                    object,
-                };
-                Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, callback_arguments);
-                return;
+            if (error) {
+                try {
+                    std::rethrow_exception(error);
+                }
+                catch (const std::exception& e) {
+                    ObjectType object = Object::create_empty(protected_ctx);
+                    Object::set_property(protected_ctx, object, "message",
+                                         Value::from_string(protected_ctx, e.what()));
+                    Object::set_property(protected_ctx, object, "errorCode", Value::from_number(protected_ctx, 1));
+
+                    ValueType callback_arguments[2] = {
+                        Value::from_undefined(protected_ctx),
+                        object,
+                    };
+                    Function<T>::callback(protected_ctx, state->callback, state->this_object, 2,
+                                          callback_arguments);
+                    return;
+                }
             }
-        }
 
-        auto def = std::move(defaults);
-        auto ctor = std::move(constructors);
-        const SharedRealm realm = Realm::get_shared_realm(std::move(realm_ref), util::Scheduler::make_default());
-        set_binding_context(protected_ctx, realm, schema_updated, std::move(def), std::move(ctor));
-        ObjectType object = create_object<T, RealmClass<T>>(protected_ctx, new SharedRealm(realm));
+            auto def = std::move(defaults);
+            auto ctor = std::move(constructors);
+            const SharedRealm realm = Realm::get_shared_realm(std::move(realm_ref), util::Scheduler::make_default());
+            if (warm_pages_requested && !realm->config().encryption_key.empty()) {
+                warm_encrypted_pages(realm);
+            }
+            set_binding_context(protected_ctx, realm, schema_updated, std::move(def), std::move(ctor));
+            ObjectType object = create_object<T, RealmClass<T>>(protected_ctx, new SharedRealm(realm));
 
-        try {
-            ValueType unprotected_args = protected_args;
-            handle_initial_subscriptions(protected_ctx, args.count - 1, &unprotected_args, realm, realm_exists);
-        }
-        catch (TypeErrorException e) {
-            auto error = Object::create_error(protected_ctx, e.what());
-            Function<T>::callback(protected_ctx, protected_callback, {Value::from_undefined(protected_ctx), error});
-        }
+            try {
+                ValueType unprotected_args = state->args_value;
+                handle_initial_subscriptions(protected_ctx, argc, &unprotected_args, realm, realm_exists);
+            }
+            catch (TypeErrorException e) {
+                auto error = Object::create_error(protected_ctx, e.what());
+                Function<T>::callback(protected_ctx, state->callback,
+                                      {Value::from_undefined(protected_ctx), error});
+            }
 
-        ValueType callback_arguments[2] = {
-            object,
-            Value::from_null(protected_ctx),
-        };
-        Function<T>::callback(protected_ctx, protected_callback, 2, callback_arguments);
-    });
+            ValueType callback_arguments[2] = {
+                object,
+                Value::from_null(protected_ctx),
+            };
+            Function<T>::callback(protected_ctx, state->callback, 2, callback_arguments);
+        });
 
     task->start(callback_handler);
-    return_value.set(create_object<T, AsyncOpenTaskClass<T>>(ctx, new std::shared_ptr<AsyncOpenTask>(task)));
+    return_value.set(
+        create_object<T, AsyncOpenTaskClass<T>>(ctx, new AsyncOpenTaskHolder<T>{task, {completion_state}}));
 }
 #endif
 
@@ -1234,7 +2443,38 @@ void RealmClass<T>::objects(ContextType ctx, ObjectType this_object, Arguments&
         throw std::runtime_error("You cannot query an asymmetric class.");
     }
 
-    return_value.set(ResultsClass<T>::create_instance(ctx, realm, object_schema.name));
+    auto delegate = get_delegate<T>(realm.get());
+    if (auto cached = delegate->find_cached_results(object_schema.name)) {
+        return_value.set(static_cast<ObjectType>(*cached));
+        return;
+    }
+
+    ObjectType results = ResultsClass<T>::create_instance(ctx, realm, object_schema.name);
+    delegate->cache_results(object_schema.name, Protected<ObjectType>(ctx, results));
+    return_value.set(results);
+}
+
+// Pre-resolves everything about a query that does not depend on argument
+// values — see CompiledQueryClass. Hot parameterized queries keep one
+// compiled handle and call run(...) per execution.
+template <typename T>
+void RealmClass<T>::compile_query(ContextType ctx, ObjectType this_object, Arguments& args,
+                                  ReturnValue& return_value)
+{
+    args.validate_maximum(2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    auto& object_schema = validated_object_schema_for_value(ctx, realm, args[0]);
+
+    if (object_schema.table_type == ObjectSchema::ObjectType::Embedded) {
+        throw std::runtime_error("You cannot query an embedded object.");
+    }
+    if (object_schema.table_type == ObjectSchema::ObjectType::TopLevelAsymmetric) {
+        throw std::runtime_error("You cannot query an asymmetric class.");
+    }
+
+    std::string query_string = Value::validated_to_string(ctx, args[1], "predicate");
+    return_value.set(CompiledQueryClass<T>::create_instance(ctx, realm, object_schema, std::move(query_string)));
 }
 
 template <typename T>
@@ -1246,10 +2486,39 @@ void RealmClass<T>::object_for_primary_key(ContextType ctx, ObjectType this_obje
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
     std::string object_type;
     auto& object_schema = validated_object_schema_for_value(ctx, realm, args[0]);
+
+    // Fast path: the row's ObjKey is memoized per (type, primary key) in the
+    // delegate, and the boxed wrapper usually sits in the per-version object
+    // cache, so repeat lookups of a hot object return the identical JS
+    // wrapper without re-running the primary-key search or
+    // create_instance_by_schema. Skipped inside write transactions, where
+    // rows can disappear without the version-advance hook clearing the memo.
+    auto delegate = get_delegate<T>(realm.get());
+    const bool can_cache = delegate && object_schema.table_key && !realm->is_in_transaction() &&
+                           (Value::is_string(ctx, args[1]) || Value::is_number(ctx, args[1]));
+    std::string pk_cache_key;
+    if (can_cache) {
+        // The tag keeps the string "5" and the number 5 from sharing an entry.
+        pk_cache_key = (Value::is_string(ctx, args[1]) ? "s:" : "n:") + Value::to_string(ctx, args[1]);
+        if (const int64_t* obj_key = delegate->find_cached_primary_key(object_schema.table_key, pk_cache_key)) {
+            if (auto cached = delegate->find_cached_object(object_schema.table_key, ObjKey(*obj_key))) {
+                return_value.set(static_cast<ObjectType>(*cached));
+                return;
+            }
+            auto table = realm->read_group().get_table(object_schema.table_key);
+            realm::Object realm_object(realm, object_schema, table->get_object(ObjKey(*obj_key)));
+            return_value.set(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
+            return;
+        }
+    }
+
     NativeAccessor accessor(ctx, realm, object_schema);
     auto realm_object = realm::Object::get_for_primary_key(accessor, realm, object_schema, args[1]);
 
     if (realm_object.is_valid()) {
+        if (can_cache) {
+            delegate->cache_primary_key(object_schema.table_key, pk_cache_key, realm_object.obj().get_key());
+        }
         return_value.set(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
     }
     else {
@@ -1258,41 +2527,40 @@ void RealmClass<T>::object_for_primary_key(ContextType ctx, ObjectType this_obje
 }
 
 template <typename T>
-void RealmClass<T>::create(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+realm::CreatePolicy RealmClass<T>::validated_create_policy(ContextType ctx, Arguments& args, size_t arg_index)
 {
-    args.validate_maximum(3);
-    realm::CreatePolicy policy = realm::CreatePolicy::ForceCreate;
-    if (args.count == 3) {
-        if (Value::is_boolean(ctx, args[2])) {
-            // Deprecated API
-            if (Value::validated_to_boolean(ctx, args[2])) {
-                policy = realm::CreatePolicy::UpdateAll;
-            }
-            else {
-                policy = realm::CreatePolicy::ForceCreate;
-            }
+    if (args.count <= arg_index) {
+        return realm::CreatePolicy::ForceCreate;
+    }
+    if (Value::is_boolean(ctx, args[arg_index])) {
+        // Deprecated API
+        if (Value::validated_to_boolean(ctx, args[arg_index])) {
+            return realm::CreatePolicy::UpdateAll;
         }
-        else if (Value::is_string(ctx, args[2])) {
-            // New API accepting an updateMode parameter
-            std::string mode = Value::validated_to_string(ctx, args[2]);
-            if (mode == "never") {
-                policy = realm::CreatePolicy::ForceCreate;
-            }
-            else if (mode == "modified") {
-                policy = realm::CreatePolicy::UpdateModified;
-            }
-            else if (mode == "all") {
-                policy = realm::CreatePolicy::UpdateAll;
-            }
-            else {
-                throw std::runtime_error("Unsupported 'updateMode'. Only 'never', 'modified' or 'all' is supported.");
-            }
+        return realm::CreatePolicy::ForceCreate;
+    }
+    if (Value::is_string(ctx, args[arg_index])) {
+        // New API accepting an updateMode parameter
+        std::string mode = Value::validated_to_string(ctx, args[arg_index]);
+        if (mode == "never") {
+            return realm::CreatePolicy::ForceCreate;
         }
-        else {
-            throw std::runtime_error(
-                "Unsupported 'updateMode'. Only the strings 'never', 'modified' or 'all' is supported.");
+        if (mode == "modified") {
+            return realm::CreatePolicy::UpdateModified;
         }
+        if (mode == "all") {
+            return realm::CreatePolicy::UpdateAll;
+        }
+        throw std::runtime_error("Unsupported 'updateMode'. Only 'never', 'modified' or 'all' is supported.");
     }
+    throw std::runtime_error("Unsupported 'updateMode'. Only the strings 'never', 'modified' or 'all' is supported.");
+}
+
+template <typename T>
+void RealmClass<T>::create(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(3);
+    realm::CreatePolicy policy = validated_create_policy(ctx, args, 2);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
     realm->verify_open();
@@ -1320,6 +2588,332 @@ void RealmClass<T>::create(ContextType ctx, ObjectType this_object, Arguments& a
     }
 }
 
+// Bulk creation: inserts a whole array of objects with one native call, one
+// schema lookup and one NativeAccessor, wrapping the inserts in a single
+// transaction when one isn't already active. Looping `realm.create` from JS
+// pays argument validation and constructor-map lookups per object; this pays
+// them once per batch.
+template <typename T>
+void RealmClass<T>::create_all(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(3);
+    realm::CreatePolicy policy = validated_create_policy(ctx, args, 2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    realm->verify_open();
+    auto& object_schema = validated_object_schema_for_value(ctx, realm, args[0]);
+
+    ObjectType array = Value::validated_to_array(ctx, args[1], "objects");
+    uint32_t length = Object::validated_get_length(ctx, array);
+
+    bool manage_transaction = !realm->is_in_transaction();
+    if (manage_transaction) {
+        auto delegate = get_delegate<T>(realm.get());
+        delegate->verify_not_pinned();
+        delegate->materialize_pending_snapshots();
+        realm->begin_transaction();
+    }
+
+    NativeAccessor accessor(ctx, realm, object_schema);
+    bool is_asymmetric = object_schema.table_type == ObjectSchema::ObjectType::TopLevelAsymmetric;
+    std::vector<ValueType> created;
+    if (!is_asymmetric) {
+        created.reserve(length);
+    }
+    try {
+        for (uint32_t i = 0; i < length; i++) {
+            ObjectType object = Object::validated_get_object(ctx, array, i);
+            if (Value::is_array(ctx, object)) {
+                object = Schema<T>::dict_for_property_array(ctx, object_schema, object);
+            }
+            auto realm_object = realm::Object::create<ValueType>(accessor, realm, object_schema, object, policy);
+            if (!is_asymmetric) {
+                created.push_back(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
+            }
+        }
+    }
+    catch (...) {
+        if (manage_transaction) {
+            cancel_transaction_and_clear_caches<T>(realm);
+        }
+        throw;
+    }
+    if (manage_transaction) {
+        realm->commit_transaction();
+    }
+
+    if (is_asymmetric) {
+        return_value.set_undefined();
+    }
+    else {
+        return_value.set(Object::create_array(ctx, created));
+    }
+}
+
+// Converts one parsed JSON (BSON) value into the Mixed expected by `prop`,
+// coercing JSON's number representations to the column type. Strings returned
+// in the Mixed reference the Bson value, which the caller keeps alive until
+// the value is written. Collections, links and embedded objects are outside
+// the scope of the streaming ingest path.
+static inline Mixed bson_value_for_property(const bson::Bson& value, const Property& prop,
+                                            std::vector<char>& binary_storage)
+{
+    using BsonType = bson::Bson::Type;
+    using realm::PropertyType;
+
+    if (value.type() == BsonType::Null) {
+        if (!is_nullable(prop.type)) {
+            throw std::invalid_argument(util::format("Property '%1' is not nullable", prop.name));
+        }
+        return Mixed();
+    }
+
+    if (is_array(prop.type) || is_set(prop.type) || is_dictionary(prop.type)) {
+        throw std::invalid_argument(
+            util::format("Collection property '%1' is not supported by createFromJson", prop.name));
+    }
+
+    switch (prop.type & ~PropertyType::Flags) {
+        case PropertyType::Int:
+            if (value.type() == BsonType::Int32) {
+                return Mixed(int64_t(value.operator int32_t()));
+            }
+            if (value.type() == BsonType::Int64) {
+                return Mixed(value.operator int64_t());
+            }
+            break;
+        case PropertyType::Bool:
+            if (value.type() == BsonType::Bool) {
+                return Mixed(value.operator bool());
+            }
+            break;
+        case PropertyType::Float:
+            if (value.type() == BsonType::Double) {
+                return Mixed(float(value.operator double()));
+            }
+            if (value.type() == BsonType::Int32) {
+                return Mixed(float(value.operator int32_t()));
+            }
+            if (value.type() == BsonType::Int64) {
+                return Mixed(float(value.operator int64_t()));
+            }
+            break;
+        case PropertyType::Double:
+            if (value.type() == BsonType::Double) {
+                return Mixed(value.operator double());
+            }
+            if (value.type() == BsonType::Int32) {
+                return Mixed(double(value.operator int32_t()));
+            }
+            if (value.type() == BsonType::Int64) {
+                return Mixed(double(value.operator int64_t()));
+            }
+            break;
+        case PropertyType::String:
+            if (value.type() == BsonType::String) {
+                return Mixed(StringData(value.operator const std::string&()));
+            }
+            break;
+        case PropertyType::Date:
+            if (value.type() == BsonType::Datetime) {
+                return Mixed(value.operator Timestamp());
+            }
+            break;
+        case PropertyType::Decimal:
+            if (value.type() == BsonType::Decimal128) {
+                return Mixed(value.operator Decimal128());
+            }
+            if (value.type() == BsonType::Double) {
+                return Mixed(Decimal128(value.operator double()));
+            }
+            if (value.type() == BsonType::Int32) {
+                return Mixed(Decimal128(int64_t(value.operator int32_t())));
+            }
+            if (value.type() == BsonType::Int64) {
+                return Mixed(Decimal128(value.operator int64_t()));
+            }
+            break;
+        case PropertyType::ObjectId:
+            if (value.type() == BsonType::ObjectId) {
+                return Mixed(value.operator ObjectId());
+            }
+            break;
+        case PropertyType::UUID:
+            if (value.type() == BsonType::Uuid) {
+                return Mixed(value.operator UUID());
+            }
+            break;
+        case PropertyType::Data:
+            if (value.type() == BsonType::Binary) {
+                const auto& vec = value.operator const std::vector<char>&();
+                auto decoded = js::base64::decode_to_vector(StringData(vec.data(), vec.size()));
+                if (!decoded) {
+                    throw std::invalid_argument(
+                        util::format("Invalid base64 in binary value for property '%1'", prop.name));
+                }
+                binary_storage = std::move(*decoded);
+                return Mixed(BinaryData(binary_storage.data(), binary_storage.size()));
+            }
+            break;
+        case PropertyType::Mixed:
+            switch (value.type()) {
+                case BsonType::Int32:
+                    return Mixed(int64_t(value.operator int32_t()));
+                case BsonType::Int64:
+                    return Mixed(value.operator int64_t());
+                case BsonType::Bool:
+                    return Mixed(value.operator bool());
+                case BsonType::Double:
+                    return Mixed(value.operator double());
+                case BsonType::String:
+                    return Mixed(StringData(value.operator const std::string&()));
+                case BsonType::Datetime:
+                    return Mixed(value.operator Timestamp());
+                case BsonType::Decimal128:
+                    return Mixed(value.operator Decimal128());
+                case BsonType::ObjectId:
+                    return Mixed(value.operator ObjectId());
+                case BsonType::Uuid:
+                    return Mixed(value.operator UUID());
+                default:
+                    break;
+            }
+            break;
+        default:
+            throw std::invalid_argument(
+                util::format("Property '%1' of type '%2' is not supported by createFromJson", prop.name,
+                             string_for_property_type(prop.type)));
+    }
+
+    throw std::invalid_argument(util::format("Invalid value for property '%1'", prop.name));
+}
+
+// Streaming ingest: parses newline-delimited JSON rows and writes them
+// straight into the table through core, never materializing JS values. Rows
+// go through the same EJSON parser backing `bson_parse_json`, so extended
+// type spellings ($oid, $date, $numberDecimal, ...) work. Each line must be
+// a flat document of scalar properties; properties absent from a row keep
+// their column defaults. Returns the number of objects created.
+template <typename T>
+void RealmClass<T>::create_from_json(ContextType ctx, ObjectType this_object, Arguments& args,
+                                     ReturnValue& return_value)
+{
+    args.validate_count(2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    realm->verify_open();
+    auto& object_schema = validated_object_schema_for_value(ctx, realm, args[0]);
+
+    OwnedBinaryData buffer_storage;
+    std::string string_storage;
+    StringData text;
+    if (Value::is_binary(ctx, args[1])) {
+        BinaryData data = Value::to_binary_view(ctx, args[1], buffer_storage);
+        text = StringData(data.data(), data.size());
+    }
+    else {
+        string_storage = Value::validated_to_string(ctx, args[1], "json");
+        text = string_storage;
+    }
+
+    // Resolve the schema once per batch; rows address properties by their
+    // public (JS-visible) name or by the internal one.
+    std::unordered_map<std::string, const Property*> properties;
+    for (auto& prop : object_schema.persisted_properties) {
+        properties.emplace(prop.name, &prop);
+        if (!prop.public_name.empty()) {
+            properties.emplace(prop.public_name, &prop);
+        }
+    }
+    const Property* primary_key = object_schema.primary_key_property();
+
+    TableRef table = realm->read_group().get_table(object_schema.table_key);
+
+    bool manage_transaction = !realm->is_in_transaction();
+    if (manage_transaction) {
+        auto delegate = get_delegate<T>(realm.get());
+        delegate->verify_not_pinned();
+        delegate->materialize_pending_snapshots();
+        realm->begin_transaction();
+    }
+
+    size_t created = 0;
+    try {
+        const char* pos = text.data();
+        const char* end = pos + text.size();
+        size_t line_number = 0;
+        std::vector<char> binary_storage;
+        while (pos != end) {
+            const char* line_end = std::find(pos, end, '\n');
+            size_t line_size = line_end - pos;
+            const char* line = pos;
+            pos = line_end == end ? end : line_end + 1;
+            line_number++;
+
+            while (line_size && (line[line_size - 1] == '\r' || line[line_size - 1] == ' ')) {
+                line_size--;
+            }
+            if (line_size == 0) {
+                continue;
+            }
+
+            bson::Bson parsed;
+            try {
+                parsed = bson::parse(std::string(line, line_size));
+            }
+            catch (const std::exception& e) {
+                throw std::invalid_argument(util::format("Invalid JSON on line %1: %2", line_number, e.what()));
+            }
+            if (parsed.type() != bson::Bson::Type::Document) {
+                throw std::invalid_argument(util::format("Expected a JSON object on line %1", line_number));
+            }
+            const auto& document = parsed.operator const bson::BsonDocument&();
+
+            Obj obj;
+            if (primary_key) {
+                const bson::Bson* pk_value = nullptr;
+                for (auto&& [key, bson_value] : document) {
+                    if (key == primary_key->name || key == primary_key->public_name) {
+                        pk_value = &bson_value;
+                        break;
+                    }
+                }
+                if (!pk_value) {
+                    throw std::invalid_argument(
+                        util::format("Missing primary key '%1' on line %2", primary_key->name, line_number));
+                }
+                obj = table->create_object_with_primary_key(
+                    bson_value_for_property(*pk_value, *primary_key, binary_storage));
+            }
+            else {
+                obj = table->create_object();
+            }
+
+            for (auto&& [key, bson_value] : document) {
+                auto it = properties.find(key);
+                // Unknown keys are ignored, matching create().
+                if (it == properties.end() || it->second->is_primary) {
+                    continue;
+                }
+                const Property& prop = *it->second;
+                obj.set_any(prop.column_key, bson_value_for_property(bson_value, prop, binary_storage));
+            }
+            created++;
+        }
+    }
+    catch (...) {
+        if (manage_transaction) {
+            cancel_transaction_and_clear_caches<T>(realm);
+        }
+        throw;
+    }
+    if (manage_transaction) {
+        realm->commit_transaction();
+    }
+
+    return_value.set(static_cast<uint32_t>(created));
+}
+
 template <typename T>
 void RealmClass<T>::delete_one(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
@@ -1381,6 +2975,75 @@ void RealmClass<T>::delete_one(ContextType ctx, ObjectType this_object, Argument
     }
 }
 
+// Batched deletion for one type: unboxes the argument list once, resolves
+// every entry — managed object or primary key — to an ObjKey up front, then
+// removes the rows in one pass. The retention-job pattern of looping
+// realm.delete() per row pays one boundary crossing and one full argument
+// validation per object; this pays them once per batch. Core computes the
+// change sets for listeners once at the end of the write, as with any other
+// sequence of removals. Primary keys with no matching row are skipped;
+// returns the number of objects actually deleted.
+template <typename T>
+void RealmClass<T>::delete_many(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    realm->verify_open();
+    if (!realm->is_in_transaction()) {
+        throw std::runtime_error("Can only delete objects within a transaction.");
+    }
+
+    auto& object_schema = validated_object_schema_for_value(ctx, realm, args[0]);
+    realm::TableRef table = ObjectStore::table_for_object_type(realm->read_group(), object_schema.name);
+
+    ObjectType array = Value::validated_to_array(ctx, args[1], "objects");
+    uint32_t length = Object::validated_get_length(ctx, array);
+
+    std::vector<ObjKey> keys;
+    keys.reserve(length);
+
+    NativeAccessor<T> accessor(ctx, realm, object_schema);
+    for (uint32_t i = 0; i < length; i++) {
+        ValueType value = Object::get_property(ctx, array, i);
+
+        if (Value::is_object(ctx, value)) {
+            ObjectType object = Value::to_object(ctx, value);
+            if (Object::template is_instance<RealmObjectClass<T>>(ctx, object)) {
+                auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, object);
+                if (!realm_object || !realm_object->is_valid()) {
+                    throw std::runtime_error(util::format("Invalid object at index %1", i));
+                }
+                if (realm_object->obj().get_table() != table) {
+                    throw std::runtime_error(
+                        util::format("Object at index %1 is not a '%2'", i, object_schema.name));
+                }
+                keys.push_back(realm_object->obj().get_key());
+                continue;
+            }
+        }
+
+        // Anything that is not a managed object is treated as a primary key.
+        if (!object_schema.primary_key_property()) {
+            throw std::runtime_error(util::format(
+                "'%1' does not have a primary key; pass the objects themselves instead.", object_schema.name));
+        }
+        auto realm_object = realm::Object::get_for_primary_key(accessor, realm, object_schema, value);
+        if (realm_object.is_valid()) {
+            keys.push_back(realm_object.obj().get_key());
+        }
+    }
+
+    // The same row may be named twice (object and its key, say); remove once.
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    for (auto key : keys) {
+        table->remove_object(key);
+    }
+    return_value.set(static_cast<uint32_t>(keys.size()));
+}
+
 template <typename T>
 void RealmClass<T>::delete_all(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
@@ -1399,6 +3062,20 @@ void RealmClass<T>::delete_all(ContextType ctx, ObjectType this_object, Argument
     }
 }
 
+// Write-lock wait instrumentation shared by the synchronous and async
+// acquisition paths — see `Realm._metrics` (writeLock*). The inter-process
+// write lock has no owner-identity API to surface, so contention shows up
+// here as wait time and queue depth rather than a holder PID.
+inline void record_write_lock_wait(std::chrono::steady_clock::time_point requested)
+{
+    auto waited = std::chrono::steady_clock::now() - requested;
+    auto nanos = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count());
+    auto& counters = metrics::counters();
+    metrics::increment(counters.write_lock_waits);
+    metrics::increment(counters.write_lock_wait_nanos, nanos);
+    metrics::update_max(counters.write_lock_max_wait_nanos, nanos);
+}
+
 template <typename T>
 void RealmClass<T>::write(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
@@ -1407,18 +3084,92 @@ void RealmClass<T>::write(ContextType ctx, ObjectType this_object, Arguments& ar
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
     FunctionType callback = Value::validated_to_function(ctx, args[0]);
 
+    metrics::increment(metrics::counters().writes);
+    metrics::TimedScope timer(metrics::counters().write_nanos);
+
+    auto delegate = get_delegate<T>(realm.get());
+    delegate->verify_not_pinned();
+    delegate->materialize_pending_snapshots();
+    auto lock_requested = std::chrono::steady_clock::now();
     realm->begin_transaction();
+    record_write_lock_wait(lock_requested);
 
     try {
         auto const& callback_return = Function<T>::call(ctx, callback, this_object, 0, nullptr);
         return_value.set(callback_return);
     }
     catch (...) {
-        realm->cancel_transaction();
+        cancel_transaction_and_clear_caches<T>(realm);
         throw;
     }
 
     realm->commit_transaction();
+    metrics::increment(metrics::counters().commits);
+}
+
+// Asynchronous variant of `write`. The write lock is acquired without blocking
+// the JS thread and the commit's durability work runs on the background writer
+// thread; consecutive queued async commits are allowed to group into a single
+// fsync. Callback style: writeAsync(writeBlock[, completion]) where completion
+// receives an Error argument on failure — lib/ wraps this in a promise.
+template <typename T>
+void RealmClass<T>::write_async(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    get_delegate<T>(realm.get())->verify_not_pinned();
+    Protected<FunctionType> protected_block(ctx, Value::validated_to_function(ctx, args[0], "writeBlock"));
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    std::shared_ptr<Protected<FunctionType>> protected_completion;
+    if (args.count == 2 && !Value::is_undefined(ctx, args[1])) {
+        protected_completion =
+            std::make_shared<Protected<FunctionType>>(ctx, Value::validated_to_function(ctx, args[1], "completion"));
+    }
+
+    metrics::increment(metrics::counters().write_lock_queue_depth);
+    auto lock_requested = std::chrono::steady_clock::now();
+    realm->async_begin_transaction([realm, protected_block, protected_this, protected_ctx, protected_completion,
+                                    lock_requested] {
+        metrics::decrement(metrics::counters().write_lock_queue_depth);
+        record_write_lock_wait(lock_requested);
+        HANDLESCOPE(protected_ctx)
+        get_delegate<T>(realm.get())->materialize_pending_snapshots();
+        try {
+            Function<T>::call(protected_ctx, protected_block, protected_this, 0, nullptr);
+        }
+        catch (const std::exception& e) {
+            if (realm->is_in_transaction()) {
+                cancel_transaction_and_clear_caches<T>(realm);
+            }
+            if (!protected_completion) {
+                throw;
+            }
+            ValueType callback_arguments[1] = {Object::create_error(protected_ctx, e.what())};
+            Function<T>::callback(protected_ctx, *protected_completion, 1, callback_arguments);
+            return;
+        }
+        realm->async_commit_transaction(
+            [protected_ctx, protected_completion](std::exception_ptr error) {
+                if (!protected_completion) {
+                    return;
+                }
+                HANDLESCOPE(protected_ctx)
+                ValueType callback_arguments[1] = {Value::from_undefined(protected_ctx)};
+                if (error) {
+                    try {
+                        std::rethrow_exception(error);
+                    }
+                    catch (const std::exception& e) {
+                        callback_arguments[0] = Object::create_error(protected_ctx, e.what());
+                    }
+                }
+                Function<T>::callback(protected_ctx, *protected_completion, 1, callback_arguments);
+            },
+            true /* allow_grouping */);
+    });
 }
 
 template <typename T>
@@ -1428,7 +3179,63 @@ void RealmClass<T>::begin_transaction(ContextType ctx, ObjectType this_object, A
     args.validate_maximum(0);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    auto delegate = get_delegate<T>(realm.get());
+    delegate->verify_not_pinned();
+    delegate->materialize_pending_snapshots();
+    auto lock_requested = std::chrono::steady_clock::now();
     realm->begin_transaction();
+    record_write_lock_wait(lock_requested);
+}
+
+// `realm._acquireWrite(callback)` — queues for the write lock without
+// blocking the event loop and invokes the callback once the transaction is
+// open; the caller then commits or cancels as with beginTransaction. Returns
+// a handle for _cancelAcquireWrite, which is how a fail-fast timeout is
+// built: arm a timer, cancel the pending acquisition when it fires. A timed
+// *synchronous* beginTransaction is not possible from the binding — the
+// grant is delivered through the same event loop the wait would block.
+template <typename T>
+void RealmClass<T>::acquire_write(ContextType ctx, ObjectType this_object, Arguments& args,
+                                  ReturnValue& return_value)
+{
+    args.validate<FunctionArgument>();
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    auto delegate = get_delegate<T>(realm.get());
+    delegate->verify_not_pinned();
+    Protected<FunctionType> protected_callback(ctx, Value::validated_to_function(ctx, args[0]));
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    metrics::increment(metrics::counters().write_lock_queue_depth);
+    auto lock_requested = std::chrono::steady_clock::now();
+    auto handle =
+        realm->async_begin_transaction([realm, protected_callback, protected_this, protected_ctx, lock_requested] {
+            metrics::decrement(metrics::counters().write_lock_queue_depth);
+            record_write_lock_wait(lock_requested);
+            HANDLESCOPE(protected_ctx)
+            get_delegate<T>(realm.get())->materialize_pending_snapshots();
+            Function<T>::callback(protected_ctx, protected_callback, protected_this, 0, nullptr);
+        });
+    return_value.set(static_cast<uint32_t>(handle));
+}
+
+// `realm._cancelAcquireWrite(handle)` — withdraws a pending _acquireWrite
+// request; returns whether anything was actually cancelled (false once the
+// callback has already been granted the lock).
+template <typename T>
+void RealmClass<T>::cancel_acquire_write(ContextType ctx, ObjectType this_object, Arguments& args,
+                                         ReturnValue& return_value)
+{
+    args.validate<NumberArgument>();
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    auto handle = static_cast<unsigned>(Value::validated_to_number(ctx, args[0], "handle"));
+    bool cancelled = realm->async_cancel_transaction(handle);
+    if (cancelled) {
+        metrics::decrement(metrics::counters().write_lock_queue_depth);
+    }
+    return_value.set(cancelled);
 }
 
 template <typename T>
@@ -1439,6 +3246,7 @@ void RealmClass<T>::commit_transaction(ContextType ctx, ObjectType this_object,
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
     realm->commit_transaction();
+    metrics::increment(metrics::counters().commits);
 }
 
 template <typename T>
@@ -1448,7 +3256,86 @@ void RealmClass<T>::cancel_transaction(ContextType ctx, ObjectType this_object,
     args.validate_maximum(0);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
-    realm->cancel_transaction();
+    cancel_transaction_and_clear_caches<T>(realm);
+}
+
+// Advance the read version on demand. This is how a Realm opened with a
+// manual-refresh notification policy picks up external commits, and it also
+// flushes a version held back by a coalescing window. Returns whether the
+// version actually advanced.
+template <typename T>
+void RealmClass<T>::refresh(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(0);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    if (auto delegate = get_delegate<T>(realm.get())) {
+        if (delegate->m_pin_count > 0) {
+            throw std::runtime_error("Cannot refresh while the read version is pinned; call unpin() first.");
+        }
+        delegate->m_refresh_pending = false;
+        delegate->m_last_policy_refresh = std::chrono::steady_clock::now();
+    }
+    return_value.set(realm->refresh());
+}
+
+// Pin the read transaction at its current version. Until the matching
+// unpin(), every query on this Realm instance sees the same version even
+// across async gaps: automatic refreshes are suspended (external commits are
+// still noticed, just not delivered) and local write transactions are
+// rejected, since beginning one would advance the version underneath the
+// reader. Pins nest; the version is released when the count drops to zero.
+// Returns the pinned {version, index} handle.
+template <typename T>
+void RealmClass<T>::pin_version(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(0);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    if (realm->is_in_transaction()) {
+        throw std::runtime_error("Cannot pin the read version inside a write transaction.");
+    }
+    auto delegate = get_delegate<T>(realm.get());
+
+    realm->read_group(); // make sure there is a read transaction to hold
+    if (delegate->m_pin_count++ == 0) {
+        realm->set_auto_refresh(false);
+    }
+
+    auto version = realm->read_transaction_version();
+    return_value.set(Object::create_obj(ctx, {
+                                                 {"version", Value::from_number(ctx, double(version.version))},
+                                                 {"index", Value::from_number(ctx, double(version.index))},
+                                             }));
+}
+
+// Release one level of pin_version. When the last pin is released the Realm
+// catches up to the latest version immediately — or, if a notification
+// policy is installed, on the policy's own schedule — so pinned versions are
+// returned to the file's version tracking deterministically rather than
+// whenever the wrapper happens to be collected.
+template <typename T>
+void RealmClass<T>::unpin_version(ContextType ctx, ObjectType this_object, Arguments& args,
+                                  ReturnValue& return_value)
+{
+    args.validate_maximum(0);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    auto delegate = get_delegate<T>(realm.get());
+    if (delegate->m_pin_count == 0) {
+        throw std::runtime_error("unpin() called on a Realm whose read version is not pinned.");
+    }
+    if (--delegate->m_pin_count > 0 || realm->is_frozen()) {
+        return;
+    }
+    if (delegate->m_has_notification_policy) {
+        // The policy owns refresh timing; a version noted while pinned is
+        // delivered by its next check, the next commit or an explicit
+        // refresh().
+        return;
+    }
+    realm->set_auto_refresh(true);
+    realm->refresh();
 }
 
 template <typename T>
@@ -1551,6 +3438,249 @@ void RealmClass<T>::compact(ContextType ctx, ObjectType this_object, Arguments&
     return_value.set(realm->compact());
 }
 
+// Asynchronous variant of `compact`. The live Realm's read lock is released
+// (via invalidate) and the compaction runs on a background thread against its
+// own Realm instance, so rewriting a large file never blocks the JS thread.
+// Core exposes no progress hook for compaction, so there is no progress
+// callback. Callback style: _compactAsync(completion) where completion
+// receives (error, didCompact) — lib/ wraps this in a promise. Like the
+// synchronous form, `didCompact` is false when other processes or pinned
+// versions currently prevent compaction.
+template <typename T>
+void RealmClass<T>::compact_async(ContextType ctx, ObjectType this_object, Arguments& args,
+                                  ReturnValue& return_value)
+{
+    args.validate_count(1);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    realm->verify_open();
+    if (realm->is_in_transaction()) {
+        throw std::runtime_error("Cannot compact a Realm within a transaction.");
+    }
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    Protected<FunctionType> protected_completion(ctx, Value::validated_to_function(ctx, args[0], "completion"));
+
+    // Drop our read lock so the version this instance has pinned doesn't stop
+    // the background instance from compacting; the next access on the JS
+    // thread re-acquires a read transaction at the latest version.
+    realm->invalidate();
+
+    realm::Realm::Config config = realm->config();
+    // The frozen scheduler accepts any thread, which lets the worker open its
+    // own instance without needing an event loop of its own.
+    config.scheduler = realm::util::Scheduler::make_frozen(VersionID());
+    config.cache = false;
+
+    realm::util::EventLoopDispatcher<void(std::exception_ptr, bool)> completion_handler(
+        [protected_ctx, protected_completion](std::exception_ptr error, bool did_compact) {
+            HANDLESCOPE(protected_ctx)
+            ValueType callback_arguments[2] = {Value::from_undefined(protected_ctx),
+                                               Value::from_boolean(protected_ctx, did_compact)};
+            if (error) {
+                try {
+                    std::rethrow_exception(error);
+                }
+                catch (const std::exception& e) {
+                    callback_arguments[0] = Object::create_error(protected_ctx, e.what());
+                }
+            }
+            Function<T>::callback(protected_ctx, protected_completion, 2, callback_arguments);
+        });
+
+    std::thread([config = std::move(config), completion_handler]() mutable {
+        std::exception_ptr error;
+        bool did_compact = false;
+        try {
+            SharedRealm worker_realm = realm::Realm::get_shared_realm(std::move(config));
+            did_compact = worker_realm->compact();
+            worker_realm->close();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        completion_handler(error, did_compact);
+    }).detach();
+}
+
+/**
+ * @brief Helper producing a frozen copy of the given Realm with the binding
+ * context set up. The live Realm's defaults and constructors are carried over
+ * so reads through the frozen instance construct the same JS classes.
+ *
+ * @param ctx JS context
+ * @param realm The live Realm to freeze
+ * @return SharedRealm An immutable Realm pinned to the live Realm's current version
+ */
+template <typename T>
+SharedRealm RealmClass<T>::freeze_realm(ContextType ctx, SharedRealm const& realm)
+{
+    SharedRealm frozen_realm = realm->freeze();
+
+    bool schema_updated = false;
+    SharedObjectDefaultsMap defaults;
+    SharedConstructorMap constructors;
+    if (auto delegate = get_delegate<T>(realm.get())) {
+        // Shared, not copied — the frozen instance holds a refcount on the
+        // live Realm's maps.
+        defaults = delegate->m_defaults;
+        constructors = delegate->m_constructors;
+        schema_updated = true;
+    }
+    set_binding_context(ctx, frozen_realm, schema_updated, std::move(defaults), std::move(constructors));
+
+    return frozen_realm;
+}
+
+/**
+ * @brief Return an immutable copy of this Realm, pinned to its current
+ * version. Frozen Realms never advance, never notify, and may be read from
+ * any thread, which makes them suitable for fanning reads out to workers.
+ *
+ * @param ctx JS context
+ * @param this_object JS's object holding the `RealmClass`
+ * @param args None
+ * @param return_value \ref ReturnValue wrapping the frozen Realm
+ */
+template <typename T>
+void RealmClass<T>::freeze(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(0);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    if (realm->is_frozen()) {
+        return_value.set(this_object);
+        return;
+    }
+
+    return_value.set(create_object<T, RealmClass<T>>(ctx, new SharedRealm(freeze_realm(ctx, realm))));
+}
+
+template <typename T>
+void RealmClass<T>::get_is_frozen(ContextType ctx, ObjectType object, ReturnValue& return_value)
+{
+    return_value.set(get_internal<T, RealmClass<T>>(ctx, object)->get()->is_frozen());
+}
+
+/**
+ * @brief Get the version this Realm's read transaction is pinned to, as a
+ * `{version, index}` handle. Together with the Realm's configuration it lets
+ * another thread open the same file at the same version via `Realm._openFrozen`
+ * without re-running schema initialization.
+ */
+template <typename T>
+void RealmClass<T>::get_version_id(ContextType ctx, ObjectType object, ReturnValue& return_value)
+{
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, object);
+    realm->read_group(); // ensure there is a read transaction whose version can be reported
+    auto version = realm->read_transaction_version();
+    return_value.set(Object::create_obj(ctx, {
+                                                 {"version", Value::from_number(ctx, double(version.version))},
+                                                 {"index", Value::from_number(ctx, double(version.index))},
+                                             }));
+}
+
+/**
+ * @brief Open a frozen Realm at a pinned version. This is the worker-side
+ * counterpart of `freeze()`: the owning thread shares its configuration and
+ * `_versionId` handle, and the worker gets an immutable Realm at that exact
+ * version as long as the version is still pinned (i.e. the frozen Realm on
+ * the owning thread is still open).
+ *
+ * @param ctx JS context
+ * @param this_object JS's object holding the `RealmClass`
+ * @param args \ref Arguments structure:
+ *   - Argument 1: A Realm configuration object or path string
+ *   - Argument 2: A `{version, index}` handle obtained from `_versionId`
+ * @param return_value \ref ReturnValue wrapping the frozen Realm
+ */
+template <typename T>
+void RealmClass<T>::open_frozen(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_count(2);
+
+    realm::Realm::Config config;
+    SharedObjectDefaultsMap defaults;
+    ConstructorMap constructors;
+    ValueType config_value = args[0];
+    bool schema_updated = get_realm_config(ctx, 1, &config_value, config, defaults, constructors);
+    config.scheduler = realm::util::Scheduler::make_default();
+
+    ObjectType version_object = Value::validated_to_object(ctx, args[1], "versionId");
+    VersionID version(
+        static_cast<uint_fast64_t>(Object::validated_get_number(ctx, version_object, "version", "versionId")),
+        static_cast<uint_fast32_t>(Object::validated_get_number(ctx, version_object, "index", "versionId")));
+
+    SharedRealm frozen_realm = realm::Realm::get_frozen_realm(std::move(config), version);
+    set_binding_context(ctx, frozen_realm, schema_updated, std::move(defaults), std::move(constructors));
+
+    return_value.set(create_object<T, RealmClass<T>>(ctx, new SharedRealm(std::move(frozen_realm))));
+}
+
+/**
+ * @brief Rehydrate a Results handle exported by `Results._exportHandle`.
+ * Opens the file at the handle's pinned version and re-runs the serialized
+ * query against it, yielding the identical row set the exporting thread saw.
+ * Workers sharding one query only transfer the handle; neither the schema
+ * parse nor the query construction happens per worker beyond this one call.
+ *
+ * @param ctx JS context
+ * @param this_object JS's object holding the `RealmClass`
+ * @param args \ref Arguments structure:
+ *   - Argument 1: A handle obtained from `Results._exportHandle`
+ *   - Argument 2 (optional): A Realm configuration object supplying anything
+ *     the path alone cannot (e.g. an encryption key)
+ * @param return_value \ref ReturnValue wrapping the frozen Results
+ */
+template <typename T>
+void RealmClass<T>::import_results_handle(ContextType ctx, ObjectType this_object, Arguments& args,
+                                          ReturnValue& return_value)
+{
+    args.validate_between(1, 2);
+
+    ObjectType handle = Value::validated_to_object(ctx, args[0], "handle");
+    std::string path = Object::validated_get_string(ctx, handle, "path", "handle");
+    std::string object_type = Object::validated_get_string(ctx, handle, "type", "handle");
+    std::string query_string = Object::validated_get_string(ctx, handle, "query", "handle");
+    ObjectType version_object = Object::validated_get_object(ctx, handle, "version", "handle");
+    VersionID version(
+        static_cast<uint_fast64_t>(Object::validated_get_number(ctx, version_object, "version", "handle")),
+        static_cast<uint_fast32_t>(Object::validated_get_number(ctx, version_object, "index", "handle")));
+
+    realm::Realm::Config config;
+    SharedObjectDefaultsMap defaults;
+    ConstructorMap constructors;
+    bool schema_updated = false;
+    if (args.count == 2 && !Value::is_undefined(ctx, args[1])) {
+        ValueType config_value = args[1];
+        schema_updated = get_realm_config(ctx, 1, &config_value, config, defaults, constructors);
+    }
+    config.path = path;
+    config.scheduler = realm::util::Scheduler::make_default();
+
+    SharedRealm frozen_realm = realm::Realm::get_frozen_realm(std::move(config), version);
+    set_binding_context(ctx, frozen_realm, schema_updated, std::move(defaults), std::move(constructors));
+
+    auto& object_schema = validated_object_schema_for_value(ctx, frozen_realm, Value::from_string(ctx, object_type));
+
+    query_parser::KeyPathMapping mapping;
+    realm::populate_keypath_mapping(mapping, *frozen_realm);
+    NativeAccessor<T> accessor(ctx, frozen_realm, object_schema);
+    query_parser::ArgumentConverter<ValueType, NativeAccessor<T>> converter(accessor, nullptr, 0);
+
+    auto table = frozen_realm->read_group().get_table(object_schema.table_key);
+    auto query = table->query(query_string, converter, mapping);
+    auto ordering = query.get_ordering();
+
+    if (ordering) {
+        return_value.set(ResultsClass<T>::create_instance(
+            ctx, realm::Results(frozen_realm, std::move(query)).apply_ordering(std::move(*ordering))));
+    }
+    else {
+        return_value.set(ResultsClass<T>::create_instance(ctx, realm::Results(frozen_realm, std::move(query))));
+    }
+}
+
 /**
  * @brief Helper function for `writeCopyTo()` -- parses and validates parameters in a config structure passed from JS
  *
@@ -1604,7 +3734,7 @@ realm::Realm::Config RealmClass<T>::write_copy_to_helper(ContextType ctx, Object
 
 
     realm::Realm::Config config;
-    ObjectDefaultsMap defaults;
+    SharedObjectDefaultsMap defaults;
     ConstructorMap constructors;
     bool schema_updated = get_realm_config(ctx, args.count, args.value, config, defaults, constructors);
     return config;
@@ -1714,6 +3844,115 @@ void RealmClass<T>::writeCopyTo(ContextType ctx, ObjectType this_object, Argumen
     realm->convert(config);
 }
 
+// Asynchronous variant of `writeCopyTo`. The copy reads from a frozen Realm
+// pinned at the current version, so it runs on a background thread while the
+// live Realm stays fully usable on the JS thread. Only the `<config>` form is
+// supported — the deprecated `<path, [encryption key]>` form predates this
+// method. Callback style: _writeCopyToAsync(config, progressCallback|null,
+// completion) where completion receives an Error argument on failure — lib/
+// wraps this in a promise. Progress is reported by polling the output file's
+// size, coalesced to one (bytesWritten, estimatedTotalBytes) callback per
+// interval like sync progress notifications.
+template <typename T>
+void RealmClass<T>::write_copy_to_async(ContextType ctx, ObjectType this_object, Arguments& args,
+                                        ReturnValue& return_value)
+{
+    args.validate_count(3);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(ctx, this_object);
+    realm->verify_open();
+    if (realm->is_in_transaction()) {
+        throw std::runtime_error("Can only convert Realms outside a transaction.");
+    }
+
+    Arguments config_args{ctx, 1, args.value};
+    realm::Realm::Config config = write_copy_to_helper(ctx, this_object, config_args);
+
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    std::shared_ptr<Protected<FunctionType>> protected_progress;
+    if (!Value::is_null(ctx, args[1]) && !Value::is_undefined(ctx, args[1])) {
+        protected_progress = std::make_shared<Protected<FunctionType>>(
+            ctx, Value::validated_to_function(ctx, args[1], "progressCallback"));
+    }
+    Protected<FunctionType> protected_completion(ctx, Value::validated_to_function(ctx, args[2], "completion"));
+
+    // Pin the source at the current version; the copy reads from this frozen
+    // instance, so later writes on the JS thread neither block on nor tear
+    // the copy.
+    SharedRealm frozen_realm = realm->freeze();
+
+    uint64_t estimated_total = 0;
+    try {
+        estimated_total = util::File::get_size_static(realm->config().path);
+    }
+    catch (...) {
+        // The source size is only used for progress estimation.
+    }
+
+    realm::util::EventLoopDispatcher<void(uint64_t, uint64_t)> progress_handler(
+        [protected_ctx, protected_progress](uint64_t transferred, uint64_t transferable) {
+            if (!protected_progress) {
+                return;
+            }
+            HANDLESCOPE(protected_ctx)
+            ValueType callback_arguments[2] = {Value::from_number(protected_ctx, transferred),
+                                               Value::from_number(protected_ctx, transferable)};
+            Function<T>::callback(protected_ctx, *protected_progress, 2, callback_arguments);
+        });
+
+    realm::util::EventLoopDispatcher<void(std::exception_ptr)> completion_handler(
+        [protected_ctx, protected_completion](std::exception_ptr error) {
+            HANDLESCOPE(protected_ctx)
+            ValueType callback_arguments[1] = {Value::from_undefined(protected_ctx)};
+            if (error) {
+                try {
+                    std::rethrow_exception(error);
+                }
+                catch (const std::exception& e) {
+                    callback_arguments[0] = Object::create_error(protected_ctx, e.what());
+                }
+            }
+            Function<T>::callback(protected_ctx, protected_completion, 1, callback_arguments);
+        });
+
+    auto done = std::make_shared<std::atomic<bool>>(false);
+    std::string output_path = config.path;
+
+    if (protected_progress) {
+        std::thread([done, output_path, estimated_total, progress_handler] {
+            while (!done->load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                uint64_t written = 0;
+                try {
+                    written = util::File::get_size_static(output_path);
+                }
+                catch (...) {
+                    // The output file hasn't been created yet.
+                }
+                progress_handler(std::min(written, estimated_total), estimated_total);
+            }
+        }).detach();
+    }
+
+    std::thread([frozen_realm, config = std::move(config), done, estimated_total, progress_handler,
+                 completion_handler, has_progress = bool(protected_progress)]() mutable {
+        std::exception_ptr error;
+        try {
+            frozen_realm->convert(config);
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        done->store(true);
+        frozen_realm->close();
+        if (!error && has_progress) {
+            progress_handler(estimated_total, estimated_total);
+        }
+        completion_handler(error);
+    }).detach();
+}
+
 template <typename T>
 void RealmClass<T>::get_schema_name_from_object(ContextType ctx, ObjectType this_object, Arguments& args,
                                                 ReturnValue& return_value)
@@ -1740,7 +3979,7 @@ void RealmClass<T>::update_schema(ContextType ctx, ObjectType this_object, Argum
     ObjectType schema = Value::validated_to_array(ctx, args[0], "schema");
 
     // Parse the schema object provided by the user
-    ObjectDefaultsMap defaults;
+    SharedObjectDefaultsMap defaults;
     ConstructorMap constructors;
     realm::Schema parsed_schema = Schema<T>::parse_schema(ctx, schema, defaults, constructors);
 
@@ -1795,7 +4034,7 @@ void RealmClass<T>::bson_parse_json(ContextType ctx, ObjectType, Arguments& args
 
 #if REALM_ENABLE_SYNC
 template <typename T>
-class AsyncOpenTaskClass : public ClassDefinition<T, std::shared_ptr<AsyncOpenTask>> {
+class AsyncOpenTaskClass : public ClassDefinition<T, AsyncOpenTaskHolder<T>> {
     using GlobalContextType = typename T::GlobalContext;
     using ContextType = typename T::Context;
     using FunctionType = typename T::Function;
@@ -1835,33 +4074,101 @@ template <typename T>
 void AsyncOpenTaskClass<T>::cancel(ContextType ctx, ObjectType this_object, Arguments& args,
                                    ReturnValue& return_value)
 {
-    std::shared_ptr<AsyncOpenTask> task = *get_internal<T, AsyncOpenTaskClass<T>>(ctx, this_object);
-    task->cancel();
+    AsyncOpenTaskHolder<T>* holder = get_internal<T, AsyncOpenTaskClass<T>>(ctx, this_object);
+    // Release the JS callbacks first — we're on the JS thread, so unprotecting
+    // here is safe and immediate — then ask the sync client to stop. Any
+    // progress or completion dispatch already in flight finds its weak
+    // reference expired and becomes a no-op.
+    holder->protected_state.clear();
+    if (holder->task) {
+        holder->task->cancel();
+        holder->task.reset();
+    }
 }
 
 template <typename T>
 void AsyncOpenTaskClass<T>::add_download_notification(ContextType ctx, ObjectType this_object, Arguments& args,
                                                       ReturnValue& return_value)
 {
-    args.validate_maximum(1);
+    args.validate_maximum(2);
     auto callback_function = Value::validated_to_function(ctx, args[0]);
 
-    Protected<FunctionType> protected_callback(ctx, callback_function);
-    Protected<ObjectType> protected_this(ctx, this_object);
-    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    AsyncOpenTaskHolder<T>* holder = get_internal<T, AsyncOpenTaskClass<T>>(ctx, this_object);
+    if (!holder->task) {
+        // Already cancelled — nothing will ever be downloaded.
+        return;
+    }
+
+    // Optional throttling, same shape as Session.addProgressNotification: a
+    // number is the minimum number of milliseconds between deliveries, an
+    // object may set `minIntervalMs`. The filter runs on the sync client's
+    // thread, so a large download doesn't wake the JS thread for every
+    // protocol message. The first and the terminal update are always
+    // delivered; in between only the latest value per interval gets through.
+    double min_interval_ms = 100;
+    if (args.count == 2 && !Value::is_undefined(ctx, args[1])) {
+        if (Value::is_number(ctx, args[1])) {
+            min_interval_ms = Value::validated_to_number(ctx, args[1], "options");
+        }
+        else {
+            ObjectType options = Value::validated_to_object(ctx, args[1], "options");
+            ValueType interval_value = Object::get_property(ctx, options, "minIntervalMs");
+            if (!Value::is_undefined(ctx, interval_value)) {
+                min_interval_ms = Value::validated_to_number(ctx, interval_value, "minIntervalMs");
+            }
+        }
+    }
+
+    struct DownloadCallbackState {
+        Protected<typename T::GlobalContext> ctx;
+        Protected<FunctionType> callback;
+    };
+    auto state = std::make_shared<DownloadCallbackState>(
+        DownloadCallbackState{Protected<typename T::GlobalContext>(Context<T>::get_global_context(ctx)),
+                              Protected<FunctionType>(ctx, callback_function)});
+    std::weak_ptr<DownloadCallbackState> weak_state = state;
+    // The holder owns the JS references; cancel() releases them immediately.
+    holder->protected_state.push_back(state);
 
     realm::util::EventLoopDispatcher<SyncProgressHandler> callback_handler(
-        [=](uint64_t transferred_bytes, uint64_t transferrable_bytes) mutable {
-            HANDLESCOPE(protected_ctx)
+        [weak_state](uint64_t transferred_bytes, uint64_t transferrable_bytes) {
+            auto state = weak_state.lock();
+            if (!state) {
+                return;
+            }
+            HANDLESCOPE(state->ctx)
             ValueType callback_arguments[2] = {
-                Value::from_number(protected_ctx, transferred_bytes),
-                Value::from_number(protected_ctx, transferrable_bytes),
+                Value::from_number(state->ctx, transferred_bytes),
+                Value::from_number(state->ctx, transferrable_bytes),
             };
-            Function::callback(protected_ctx, protected_callback, 2, callback_arguments);
+            Function::callback(state->ctx, state->callback, 2, callback_arguments);
         });
 
-    std::shared_ptr<AsyncOpenTask> task = *get_internal<T, AsyncOpenTaskClass<T>>(ctx, this_object);
-    task->register_download_progress_notifier(callback_handler); // Ignore token as we don't want to unregister.
+    std::function<SyncProgressHandler> progress_func = std::move(callback_handler);
+    if (min_interval_ms > 0) {
+        struct ThrottleState {
+            std::chrono::steady_clock::time_point last_delivery;
+            bool delivered_any = false;
+        };
+        auto throttle = std::make_shared<ThrottleState>();
+        auto min_interval = std::chrono::milliseconds(static_cast<int64_t>(min_interval_ms));
+        progress_func = [throttle, min_interval, handler = std::move(progress_func)](
+                            uint64_t transferred_bytes, uint64_t transferrable_bytes) {
+            // Runs on the sync client's event loop thread; updates arrive
+            // serially so the state needs no locking.
+            bool complete = transferred_bytes >= transferrable_bytes;
+            if (throttle->delivered_any && !complete &&
+                std::chrono::steady_clock::now() - throttle->last_delivery < min_interval) {
+                return;
+            }
+            throttle->last_delivery = std::chrono::steady_clock::now();
+            throttle->delivered_any = true;
+            handler(transferred_bytes, transferrable_bytes);
+        };
+    }
+
+    holder->task->register_download_progress_notifier(
+        std::move(progress_func)); // Ignore token as we don't want to unregister.
 }
 #endif
 
@@ -44,6 +44,10 @@ namespace js {
 template <typename>
 class NativeAccessor;
 
+// Forward declaration to avoid circular dependency
+template <typename T>
+class RealmClass;
+
 template <typename T>
 class RealmObject : public realm::Object {
 public:
@@ -79,6 +83,8 @@ struct RealmObjectClass : ClassDefinition<T, realm::js::RealmObject<T>> {
     static std::vector<String> get_property_names(ContextType, ObjectType);
 
     static void is_valid(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void is_frozen(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void freeze(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void get_object_schema(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void linking_objects(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void linking_objects_count(ContextType, ObjectType, Arguments&, ReturnValue&);
@@ -93,6 +99,11 @@ struct RealmObjectClass : ClassDefinition<T, realm::js::RealmObject<T>> {
 
     static void get_realm(ContextType, ObjectType, ReturnValue&);
 
+    // Validates an (objectType, property) pair naming a relationship to this
+    // object's type and resolves it to the origin table and link property.
+    static std::pair<realm::TableRef, const Property*> resolve_backlink_property(
+        realm::js::RealmObject<T>* realm_object, const std::string& object_type, const std::string& property_name);
+
     const std::string name = "RealmObject";
 
     const StringPropertyType<T> string_accessor = {
@@ -103,6 +114,8 @@ struct RealmObjectClass : ClassDefinition<T, realm::js::RealmObject<T>> {
 
     MethodMap<T> const methods = {
         {"isValid", wrap<is_valid>},
+        {"isFrozen", wrap<is_frozen>},
+        {"freeze", wrap<freeze>},
         {"objectSchema", wrap<get_object_schema>},
         {"linkingObjects", wrap<linking_objects>},
         {"linkingObjectsCount", wrap<linking_objects_count>},
@@ -131,6 +144,49 @@ void RealmObjectClass<T>::is_valid(ContextType ctx, ObjectType this_object, Argu
     return_value.set(realm_object->is_valid());
 }
 
+template <typename T>
+void RealmObjectClass<T>::is_frozen(ContextType ctx, ObjectType this_object, Arguments&, ReturnValue& return_value)
+{
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, this_object);
+    if (!realm_object) {
+        throw std::runtime_error("Invalid 'this' object");
+    }
+    return_value.set(realm_object->is_frozen());
+}
+
+// Return an immutable copy of this object, pinned to the version it is at.
+// An already-frozen Realm may be passed so that many objects can share one
+// frozen Realm instance instead of pinning a new version each.
+template <typename T>
+void RealmObjectClass<T>::freeze(ContextType ctx, ObjectType this_object, Arguments& args,
+                                 ReturnValue& return_value)
+{
+    args.validate_maximum(1);
+
+    auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, this_object);
+    if (!realm_object) {
+        throw std::runtime_error("Invalid 'this' object");
+    }
+
+    SharedRealm frozen_realm;
+    if (args.count == 1 && !Value::is_undefined(ctx, args[0])) {
+        auto realm_arg = Value::validated_to_object(ctx, args[0], "realm");
+        if (!Object::template is_instance<RealmClass<T>>(ctx, realm_arg)) {
+            throw std::runtime_error("Argument to 'freeze' must be a frozen Realm.");
+        }
+        frozen_realm = *get_internal<T, RealmClass<T>>(ctx, realm_arg);
+        if (!frozen_realm->is_frozen()) {
+            throw std::runtime_error("Argument to 'freeze' must be a frozen Realm.");
+        }
+    }
+    else {
+        frozen_realm = RealmClass<T>::freeze_realm(ctx, realm_object->realm());
+    }
+
+    return_value.set(
+        create_instance(ctx, realm::js::RealmObject<T>(realm_object->realm::Object::freeze(frozen_realm))));
+}
+
 template <typename T>
 void RealmObjectClass<T>::get_object_schema(ContextType ctx, ObjectType this_object, Arguments&,
                                             ReturnValue& return_value)
@@ -151,16 +207,36 @@ typename T::Object RealmObjectClass<T>::create_instance(ContextType ctx, realm::
     auto& schema = realm_object.get_object_schema();
     auto& name = schema.name;
 
+    // Boxing the same row twice within one Realm version returns the
+    // identical wrapper. Besides skipping create_instance_by_schema, this
+    // gives re-reads referential equality until the next version advance.
+    // Skipped inside a write: core derives ObjKeys from the primary key, so
+    // deleting a row and re-creating it with the same key mid-transaction
+    // would otherwise hand back the deleted row's wrapper.
+    const auto table_key = schema.table_key;
+    const auto obj_key = realm_object.is_valid() ? realm_object.obj().get_key() : ObjKey();
+    const bool can_cache = delegate && obj_key && !realm_object.realm()->is_in_transaction();
+    if (can_cache) {
+        if (auto cached = delegate->find_cached_object(table_key, obj_key)) {
+            return *cached;
+        }
+    }
+
     auto internal = new realm::js::RealmObject<T>(std::move(realm_object));
 
     try {
-        if (!delegate || !delegate->m_constructors.count(name)) {
-            return create_instance_by_schema<T, RealmObjectClass<T>>(ctx, schema, internal);
+        ObjectType object;
+        if (!delegate || !delegate->m_constructors->count(name)) {
+            object = create_instance_by_schema<T, RealmObjectClass<T>>(ctx, schema, internal);
         }
         else {
-            FunctionType constructor = delegate->m_constructors.at(name);
-            return create_instance_by_schema<T, RealmObjectClass<T>>(ctx, constructor, schema, internal);
+            FunctionType constructor = delegate->m_constructors->at(name);
+            object = create_instance_by_schema<T, RealmObjectClass<T>>(ctx, constructor, schema, internal);
+        }
+        if (can_cache) {
+            delegate->cache_object(table_key, obj_key, Protected<ObjectType>(ctx, object));
         }
+        return object;
     }
     catch (const std::exception& e) {
         delete internal;
@@ -179,11 +255,74 @@ void RealmObjectClass<T>::get_property(ContextType ctx, ObjectType object, const
     }
 
     const Property* prop = realm_object->get_object_schema().property_for_public_name(prop_name);
-    if (prop) {
-        NativeAccessor<T> accessor(ctx, realm_object->realm(), realm_object->get_object_schema());
-        auto result = realm_object->template get_property_value<ValueType>(accessor, *prop);
-        return_value.set(result);
+    if (!prop) {
+        return;
+    }
+
+    // Fast path: plain scalar columns go straight from storage to the return
+    // value — no NativeAccessor construction, no Mixed boxing, no variant
+    // dispatch. These are the bulk of all property reads. Links, collections,
+    // mixed, dates, binary and computed properties keep the generic path.
+    if (!is_collection(prop->type) && prop->column_key && realm_object->is_valid()) {
+        auto type = prop->type & ~realm::PropertyType::Flags;
+        if (type == realm::PropertyType::Int || type == realm::PropertyType::Bool ||
+            type == realm::PropertyType::Float || type == realm::PropertyType::Double ||
+            type == realm::PropertyType::String) {
+            realm_object->realm()->verify_thread();
+            const Obj& obj = realm_object->obj();
+            const ColKey col = prop->column_key;
+            const bool nullable = is_nullable(prop->type);
+            switch (type) {
+                case realm::PropertyType::Int:
+                    if (nullable) {
+                        auto value = obj.get<util::Optional<int64_t>>(col);
+                        value ? return_value.set(static_cast<double>(*value)) : return_value.set_null();
+                    }
+                    else {
+                        return_value.set(static_cast<double>(obj.get<int64_t>(col)));
+                    }
+                    return;
+                case realm::PropertyType::Bool:
+                    if (nullable) {
+                        auto value = obj.get<util::Optional<bool>>(col);
+                        value ? return_value.set(*value) : return_value.set_null();
+                    }
+                    else {
+                        return_value.set(obj.get<bool>(col));
+                    }
+                    return;
+                case realm::PropertyType::Float:
+                    if (nullable) {
+                        auto value = obj.get<util::Optional<float>>(col);
+                        value ? return_value.set(static_cast<double>(*value)) : return_value.set_null();
+                    }
+                    else {
+                        return_value.set(static_cast<double>(obj.get<float>(col)));
+                    }
+                    return;
+                case realm::PropertyType::Double:
+                    if (nullable) {
+                        auto value = obj.get<util::Optional<double>>(col);
+                        value ? return_value.set(*value) : return_value.set_null();
+                    }
+                    else {
+                        return_value.set(obj.get<double>(col));
+                    }
+                    return;
+                case realm::PropertyType::String: {
+                    StringData value = obj.get<StringData>(col);
+                    value.is_null() ? return_value.set_null() : return_value.set(std::string(value));
+                    return;
+                }
+                default:
+                    break;
+            }
+        }
     }
+
+    NativeAccessor<T> accessor(ctx, realm_object->realm(), realm_object->get_object_schema());
+    auto result = realm_object->template get_property_value<ValueType>(accessor, *prop);
+    return_value.set(result);
 }
 
 template <typename T>
@@ -367,16 +506,61 @@ void RealmObjectClass<T>::is_same_object(ContextType ctx, ObjectType object, Arg
 }
 
 template <typename T>
-void RealmObjectClass<T>::linking_objects_count(ContextType ctx, ObjectType object, Arguments&,
+std::pair<realm::TableRef, const Property*>
+RealmObjectClass<T>::resolve_backlink_property(realm::js::RealmObject<T>* realm_object,
+                                               const std::string& object_type, const std::string& property_name)
+{
+    auto target_object_schema = realm_object->realm()->schema().find(object_type);
+    if (target_object_schema == realm_object->realm()->schema().end()) {
+        throw std::logic_error(util::format("Could not find schema for type '%1'", object_type));
+    }
+
+    auto link_property = target_object_schema->property_for_name(property_name);
+    if (!link_property) {
+        throw std::logic_error(util::format("Type '%1' does not contain property '%2'", object_type, property_name));
+    }
+
+    if (link_property->object_type != realm_object->get_object_schema().name) {
+        throw std::logic_error(util::format("'%1.%2' is not a relationship to '%3'", object_type, property_name,
+                                            realm_object->get_object_schema().name));
+    }
+
+    realm::TableRef table =
+        ObjectStore::table_for_object_type(realm_object->realm()->read_group(), target_object_schema->name);
+    return {table, link_property};
+}
+
+template <typename T>
+void RealmObjectClass<T>::linking_objects_count(ContextType ctx, ObjectType object, Arguments& args,
                                                 ReturnValue& return_value)
 {
+    args.validate_maximum(2);
+
     auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, object);
     if (!realm_object) {
         throw std::runtime_error("Invalid 'this' object");
     }
 
     const Obj& obj = realm_object->obj();
-    return_value.set(static_cast<uint32_t>(obj.get_backlink_count()));
+
+    // With no arguments this is the historical total across every incoming
+    // relationship. Naming a relationship counts straight off the backlink
+    // column — no backlink view, no Results, no JS wrapper — which is what
+    // count-only callers (badges and the like) want.
+    if (args.count == 0) {
+        return_value.set(static_cast<uint32_t>(obj.get_backlink_count()));
+        return;
+    }
+
+    if (args.count != 2) {
+        throw std::invalid_argument("Expected either no arguments or (objectType, property).");
+    }
+
+    std::string object_type = Value::validated_to_string(ctx, args[0], "objectType");
+    std::string property_name = Value::validated_to_string(ctx, args[1], "property");
+    auto [table, link_property] = resolve_backlink_property(realm_object, object_type, property_name);
+
+    return_value.set(static_cast<uint32_t>(obj.get_backlink_count(*table, link_property->column_key)));
 }
 
 
@@ -384,7 +568,7 @@ template <typename T>
 void RealmObjectClass<T>::add_listener(ContextType ctx, ObjectType this_object, Arguments& args,
                                        ReturnValue& return_value)
 {
-    args.validate_maximum(1);
+    args.validate_maximum(2);
 
     auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, this_object);
     if (!realm_object) {
@@ -392,11 +576,28 @@ void RealmObjectClass<T>::add_listener(ContextType ctx, ObjectType this_object,
     }
 
     auto callback = Value::validated_to_function(ctx, args[0]);
+
+    // An optional array of key paths restricts which property changes fire
+    // this listener, mirroring the collection-listener filtering. Core drops
+    // non-matching change sets before they ever reach the JS thread.
+    std::optional<KeyPathArray> key_path_array;
+    if (args.count == 2 && !Value::is_undefined(ctx, args[1]) && !Value::is_null(ctx, args[1])) {
+        ObjectType js_key_paths = Value::validated_to_array(ctx, args[1], "keyPaths");
+        size_t key_path_count = Object::validated_get_length(ctx, js_key_paths);
+        std::vector<std::string> key_paths;
+        key_paths.reserve(key_path_count);
+        for (unsigned int i = 0; i < key_path_count; i++) {
+            key_paths.push_back(Object::validated_get_string(ctx, js_key_paths, i, "keyPaths"));
+        }
+        key_path_array =
+            realm_object->realm()->create_key_path_array(realm_object->get_object_schema().name, key_paths);
+    }
+
     Protected<FunctionType> protected_callback(ctx, callback);
     Protected<ObjectType> protected_this(ctx, this_object);
     Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
 
-    auto token = realm_object->add_notification_callback([=](CollectionChangeSet const& change_set) {
+    auto handler = [=](CollectionChangeSet const& change_set) {
         HANDLESCOPE(protected_ctx)
 
         bool deleted = false;
@@ -423,7 +624,9 @@ void RealmObjectClass<T>::add_listener(ContextType ctx, ObjectType this_object,
 
         ValueType arguments[]{static_cast<ObjectType>(protected_this), object};
         Function::callback(protected_ctx, protected_callback, protected_this, 2, arguments);
-    });
+    };
+    auto token = key_path_array ? realm_object->add_notification_callback(handler, std::move(*key_path_array))
+                                : realm_object->add_notification_callback(handler);
     NotificationBucket::emplace(realm_object->m_notification_handle, std::move(protected_callback), std::move(token));
 }
 
@@ -509,23 +712,7 @@ void realm::js::RealmObjectClass<T>::linking_objects(ContextType ctx, ObjectType
         throw std::runtime_error("Invalid 'this' object");
     }
 
-    auto target_object_schema = realm_object->realm()->schema().find(object_type);
-    if (target_object_schema == realm_object->realm()->schema().end()) {
-        throw std::logic_error(util::format("Could not find schema for type '%1'", object_type));
-    }
-
-    auto link_property = target_object_schema->property_for_name(property_name);
-    if (!link_property) {
-        throw std::logic_error(util::format("Type '%1' does not contain property '%2'", object_type, property_name));
-    }
-
-    if (link_property->object_type != realm_object->get_object_schema().name) {
-        throw std::logic_error(util::format("'%1.%2' is not a relationship to '%3'", object_type, property_name,
-                                            realm_object->get_object_schema().name));
-    }
-
-    realm::TableRef table =
-        ObjectStore::table_for_object_type(realm_object->realm()->read_group(), target_object_schema->name);
+    auto [table, link_property] = resolve_backlink_property(realm_object, object_type, property_name);
     auto obj = realm_object->obj();
     auto tv = obj.get_backlink_view(table, link_property->column_key);
 
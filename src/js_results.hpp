@@ -20,6 +20,7 @@
 
 #include "js_collection.hpp"
 #include "js_realm_object.hpp"
+#include "js_metrics.hpp"
 #include "js_util.hpp"
 #include "js_notifications.hpp"
 
@@ -30,7 +31,10 @@
 #include <realm/object-store/collection_notifications.hpp>
 
 #include <realm/parser/query_parser.hpp>
+#include <realm/sort_descriptor.hpp>
 #include <realm/util/optional.hpp>
+
+#include <sstream>
 #ifdef REALM_ENABLE_SYNC
 #include "js_sync.hpp"
 #endif
@@ -48,6 +52,10 @@ struct NonRealmObjectException : public std::logic_error {
     }
 };
 
+// Forward declaration to avoid circular dependency
+template <typename T>
+class RealmClass;
+
 template <typename T>
 class Results : public realm::Results {
 public:
@@ -62,6 +70,63 @@ public:
     using realm::Results::Results;
 
     notifications::NotificationHandle<T, NotificationToken> m_notification_handle;
+    CollectionSizeCache m_size_cache;
+    CollectionVersionTracker m_version_tracker;
+
+    // window() page cache — see ResultsClass::window. Holds the most recently
+    // boxed page plus, once the deferred prefetch has run, the page after it,
+    // both stamped with the read version they were boxed at. Stale entries
+    // simply stop matching and age out of the two-slot cache.
+    struct WindowPage {
+        size_t start;
+        size_t end;
+        uint64_t version;
+        Protected<typename T::Object> page;
+    };
+
+    Protected<typename T::Object>* find_window_page(size_t start, size_t end, uint64_t version)
+    {
+        for (auto& entry : m_window_pages) {
+            if (entry.version == version && entry.start == start && entry.end == end) {
+                return &entry.page;
+            }
+        }
+        return nullptr;
+    }
+
+    void cache_window_page(size_t start, size_t end, uint64_t version, Protected<typename T::Object> page)
+    {
+        if (m_window_pages.size() >= 2) {
+            m_window_pages.erase(m_window_pages.begin());
+        }
+        m_window_pages.push_back({start, end, version, std::move(page)});
+    }
+
+    // Copy-on-write snapshot state — see ResultsClass::create_snapshot. While
+    // pending, this instance still reads through the live query; the Realm's
+    // delegate detaches it right before the first write transaction or read
+    // version advance that could make the live data diverge.
+    void make_pending_snapshot()
+    {
+        m_pending_snapshot = true;
+        get_delegate<T>(get_realm().get())->register_pending_snapshot(this, [this] {
+            m_pending_snapshot = false;
+            realm::Results::operator=(realm::Results::snapshot());
+        });
+    }
+
+    ~Results()
+    {
+        if (m_pending_snapshot) {
+            if (auto delegate = get_delegate<T>(get_realm().get())) {
+                delegate->unregister_pending_snapshot(this);
+            }
+        }
+    }
+
+private:
+    bool m_pending_snapshot = false;
+    std::vector<WindowPage> m_window_pages;
 };
 
 template <typename T>
@@ -79,30 +144,45 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
 
     static ObjectType create_instance(ContextType, realm::Results);
     static ObjectType create_instance(ContextType, SharedRealm, const std::string& object_type);
+    static ObjectType create_snapshot(ContextType, realm::Results);
 
     template <typename U>
     static ObjectType create_filtered(ContextType, const U&, Arguments&);
 
     static std::vector<std::pair<std::string, bool>> get_keypaths(ContextType, Arguments&);
 
+    template <typename U>
+    static realm::Results sort_collection(ContextType, const U&, Arguments&);
+
     static void get_length(ContextType, ObjectType, ReturnValue&);
+    static void get_version(ContextType, ObjectType, ReturnValue&);
     static void get_type(ContextType, ObjectType, ReturnValue&);
     static void get_optional(ContextType, ObjectType, ReturnValue&);
     static void get_index(ContextType, ObjectType, uint32_t, ReturnValue&);
 
     static void description(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void stream_json(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void snapshot(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void to_values(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void window(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static ObjectType export_range(ContextType, realm::js::Results<T>&, size_t start, size_t end);
+    static void schedule_window_prefetch(ContextType, ObjectType, size_t start, size_t count, uint64_t version);
     static void filtered(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void sorted(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void is_valid(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void is_empty(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void is_frozen(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void freeze(ContextType, ObjectType, Arguments&, ReturnValue&);
 
     static void index_of(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void index_of_object_key(ContextType, ObjectType, Arguments&, ReturnValue&);
 
     template <typename Fn>
     static void index_of(ContextType, Fn&, Arguments&, ReturnValue&);
 
     static void update(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void count(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void export_handle(ContextType, ObjectType, Arguments&, ReturnValue&);
 
     // observable
     static void add_listener(ContextType, ObjectType, Arguments&, ReturnValue&);
@@ -118,11 +198,16 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
 
     MethodMap<T> const methods = {
         {"description", wrap<description>},
+        {"_streamJson", wrap<stream_json>},
         {"snapshot", wrap<snapshot>},
+        {"toValues", wrap<to_values>},
+        {"window", wrap<window>},
         {"filtered", wrap<filtered>},
         {"sorted", wrap<sorted>},
         {"isValid", wrap<is_valid>},
         {"isEmpty", wrap<is_empty>},
+        {"isFrozen", wrap<is_frozen>},
+        {"freeze", wrap<freeze>},
         {"min", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Min>>},
         {"max", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Max>>},
         {"sum", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Sum>>},
@@ -131,11 +216,15 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
         {"indexOf", wrap<index_of>},
+        {"_indexOfObjectKey", wrap<index_of_object_key>},
         {"update", wrap<update>},
+        {"count", wrap<count>},
+        {"_exportHandle", wrap<export_handle>},
     };
 
     PropertyMap<T> const properties = {
         {"length", {wrap<get_length>, nullptr}},
+        {"version", {wrap<get_version>, nullptr}},
         {"type", {wrap<get_type>, nullptr}},
         {"optional", {wrap<get_optional>, nullptr}},
     };
@@ -149,6 +238,24 @@ typename T::Object ResultsClass<T>::create_instance(ContextType ctx, realm::Resu
     return create_object<T, ResultsClass<T>>(ctx, new realm::js::Results<T>(std::move(results)));
 }
 
+// Wraps `results` as a copy-on-write snapshot: the wrapper keeps reading
+// through the live collection and only detaches its own row set once a write
+// transaction or a read-version advance is about to make the data diverge.
+// The common snapshot-then-enumerate-without-mutating pattern never pays for
+// the detach. Inside a write transaction there is no begin-transaction
+// boundary left to hook, so the snapshot detaches immediately.
+template <typename T>
+typename T::Object ResultsClass<T>::create_snapshot(ContextType ctx, realm::Results results)
+{
+    if (results.get_realm()->is_in_transaction()) {
+        return create_instance(ctx, results.snapshot());
+    }
+    auto snapshot = new realm::js::Results<T>(std::move(results));
+    auto object = create_object<T, ResultsClass<T>>(ctx, snapshot);
+    snapshot->make_pending_snapshot();
+    return object;
+}
+
 template <typename T>
 typename T::Object ResultsClass<T>::create_instance(ContextType ctx, SharedRealm realm,
                                                     const std::string& object_type)
@@ -173,6 +280,21 @@ typename T::Object ResultsClass<T>::create_filtered(ContextType ctx, const U& co
     auto const& realm = collection.get_realm();
     auto const& object_schema = collection.get_object_schema();
 
+    // Argument-free predicates are parsed once per Realm and reused on later
+    // calls. Bound argument values get baked into the parsed Query, so
+    // parameterized predicates always go through the parser.
+    auto delegate = args.count == 1 ? get_delegate<T>(realm.get()) : nullptr;
+    if (delegate) {
+        if (auto cached = delegate->find_cached_query(object_schema.table_key, query_string)) {
+            realm::Query query(cached->query);
+            if (cached->has_ordering) {
+                return create_instance(ctx, collection.filter(std::move(query))
+                                                .apply_ordering(realm::DescriptorOrdering(cached->ordering)));
+            }
+            return create_instance(ctx, collection.filter(std::move(query)));
+        }
+    }
+
     query_parser::KeyPathMapping mapping;
     realm::populate_keypath_mapping(mapping, *realm);
     NativeAccessor<T> accessor(ctx, realm, object_schema);
@@ -181,6 +303,10 @@ typename T::Object ResultsClass<T>::create_filtered(ContextType ctx, const U& co
     auto table = realm->read_group().get_table(object_schema.table_key);
     auto query = table->query(query_string, converter, mapping);
     auto ordering = query.get_ordering();
+    if (delegate) {
+        delegate->cache_query(object_schema.table_key, query_string,
+                              {query, ordering ? *ordering : realm::DescriptorOrdering(), bool(ordering)});
+    }
     if (ordering)
         return create_instance(ctx, collection.filter(std::move(query)).apply_ordering(std::move(*ordering)));
     else
@@ -190,7 +316,7 @@ typename T::Object ResultsClass<T>::create_filtered(ContextType ctx, const U& co
 template <typename T>
 std::vector<std::pair<std::string, bool>> ResultsClass<T>::get_keypaths(ContextType ctx, Arguments& args)
 {
-    args.validate_maximum(2);
+    args.validate<Optional<AnyArgument>, Optional<AnyArgument>>();
 
     std::vector<std::pair<std::string, bool>> sort_order;
     if (args.count == 0) {
@@ -230,25 +356,83 @@ std::vector<std::pair<std::string, bool>> ResultsClass<T>::get_keypaths(ContextT
     return sort_order;
 }
 
+template <typename T>
+template <typename U>
+realm::Results ResultsClass<T>::sort_collection(ContextType ctx, const U& collection, Arguments& args)
+{
+    auto sort_order = get_keypaths(ctx, args);
+
+    // Keypath-to-column resolution is memoized per (table, sort spec) so
+    // repeated re-sorts skip the string lookups. Only plain property names
+    // are resolved here; link keypaths and primitive collections take the
+    // generic path through core.
+    if (collection.get_type() == realm::PropertyType::Object) {
+        auto const& realm = collection.get_realm();
+        auto const& object_schema = collection.get_object_schema();
+        auto delegate = get_delegate<T>(realm.get());
+
+        std::string spec;
+        for (auto const& [keypath, ascending] : sort_order) {
+            spec += keypath;
+            spec += ascending ? ";1" : ";0";
+        }
+
+        if (auto cached = delegate->find_cached_sort(object_schema.table_key, spec)) {
+            return collection.sort(realm::SortDescriptor(cached->columns, cached->ascending));
+        }
+
+        std::vector<std::vector<realm::ExtendedColumnKey>> columns;
+        std::vector<bool> ascending;
+        columns.reserve(sort_order.size());
+        ascending.reserve(sort_order.size());
+        bool resolvable = true;
+        for (auto const& [keypath, is_ascending] : sort_order) {
+            const Property* prop = keypath.find('.') == std::string::npos
+                                       ? object_schema.property_for_public_name(keypath)
+                                       : nullptr;
+            if (!prop || !prop->column_key) {
+                resolvable = false;
+                break;
+            }
+            columns.push_back({realm::ExtendedColumnKey(prop->column_key)});
+            ascending.push_back(is_ascending);
+        }
+        if (resolvable) {
+            delegate->cache_sort(object_schema.table_key, spec, {columns, ascending});
+            return collection.sort(realm::SortDescriptor(std::move(columns), std::move(ascending)));
+        }
+    }
+    return collection.sort(std::move(sort_order));
+}
+
 template <typename T>
 void ResultsClass<T>::get_length(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
     auto results = get_internal<T, ResultsClass<T>>(ctx, object);
-    return_value.set((uint32_t)results->size());
+    return_value.set((uint32_t)results->m_size_cache.get(results->get_realm(), [&] {
+        return results->size();
+    }));
+}
+
+template <typename T>
+void ResultsClass<T>::get_version(ContextType ctx, ObjectType object, ReturnValue& return_value)
+{
+    auto results = get_internal<T, ResultsClass<T>>(ctx, object);
+    return_value.set(results->m_version_tracker.get(results->get_realm()));
 }
 
 template <typename T>
 void ResultsClass<T>::get_type(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
     auto results = get_internal<T, ResultsClass<T>>(ctx, object);
-    return_value.set(local_string_for_property_type(results->get_type() & ~realm::PropertyType::Flags));
+    return_value.set_string_view(local_string_for_property_type(results->get_type() & ~realm::PropertyType::Flags));
 }
 
 template <typename T>
 void ResultsClass<T>::get_optional(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
     auto results = get_internal<T, ResultsClass<T>>(ctx, object);
-    return_value.set(is_nullable(results->get_type()));
+    return_value.set_bool(is_nullable(results->get_type()));
 }
 
 template <typename T>
@@ -256,13 +440,13 @@ void ResultsClass<T>::get_index(ContextType ctx, ObjectType object, uint32_t ind
 {
     auto results = get_internal<T, ResultsClass<T>>(ctx, object);
     NativeAccessor<T> accessor(ctx, *results);
-    return_value.set(results->get(accessor, index));
+    return_value.set_prewrapped(results->get(accessor, index));
 }
 
 template <typename T>
 void ResultsClass<T>::description(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
-    args.validate_maximum(0);
+    args.validate<>();
     auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
     auto query = results->get_query();
     auto descriptor = results->get_descriptor_ordering();
@@ -270,12 +454,201 @@ void ResultsClass<T>::description(ContextType ctx, ObjectType this_object, Argum
     return_value.set(Value::from_string(ctx, serialized_query));
 }
 
+/**
+ * @brief Stream the rows of this Results as JSON-lines chunks.
+ *
+ *  Serializing a large result set through `toJSON` materializes the whole
+ *  object graph in JS before anything can be written out, doubling process
+ *  RSS for dumps in the hundreds of MB. This native path serializes row by
+ *  row into a reused buffer and hands the callback a string chunk whenever
+ *  the buffer passes the chunk size (default 64 KiB), so peak memory is
+ *  bounded by one chunk plus one row regardless of result-set size. Rows are
+ *  emitted one JSON object per line, in Results order.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the Results itself
+ * @param args callback receiving each chunk, optionally followed by the
+ *   chunk size in bytes
+ * @param return_value number of rows written
+ * @exception std::invalid_argument Thrown if the Results does not contain
+ *   objects or the chunk size is not positive
+ */
+template <typename T>
+void ResultsClass<T>::stream_json(ContextType ctx, ObjectType this_object, Arguments& args,
+                                  ReturnValue& return_value)
+{
+    args.validate<FunctionArgument, Optional<NumberArgument>>();
+
+    auto callback = Value::validated_to_function(ctx, args[0]);
+    size_t chunk_size = 64 * 1024;
+    if (args.count == 2 && !Value::is_undefined(ctx, args[1])) {
+        double requested = Value::validated_to_number(ctx, args[1], "chunkSize");
+        if (requested < 1) {
+            throw std::invalid_argument("chunkSize must be at least 1.");
+        }
+        chunk_size = static_cast<size_t>(requested);
+    }
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    if (results->get_type() != realm::PropertyType::Object) {
+        throw std::invalid_argument("Streaming JSON is only supported for collections of objects.");
+    }
+
+    std::ostringstream buffer;
+    auto flush = [&] {
+        std::string chunk = buffer.str();
+        if (chunk.empty()) {
+            return;
+        }
+        ValueType callback_arguments[] = {Value::from_string(ctx, chunk)};
+        Function<T>::callback(ctx, callback, this_object, 1, callback_arguments);
+        buffer.str(std::string());
+    };
+
+    size_t count = results->size();
+    for (size_t index = 0; index < count; index++) {
+        auto obj = results->template get<realm::Obj>(index);
+        obj.to_json(buffer);
+        buffer << '\n';
+        if (static_cast<size_t>(buffer.tellp()) >= chunk_size) {
+            flush();
+        }
+    }
+    flush();
+    return_value.set(static_cast<uint32_t>(count));
+}
+
 template <typename T>
 void ResultsClass<T>::snapshot(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
-    args.validate_maximum(0);
+    args.validate<>();
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    return_value.set(ResultsClass<T>::create_snapshot(ctx, *results));
+}
+
+// Bulk export: boxes a whole result set (or a [start, end) range of it) into
+// one preallocated JS array with a single native call, reusing one
+// NativeAccessor for every row. Exporting large result sets through the
+// indexed accessor costs one boundary crossing per row; this costs one per
+// call.
+template <typename T>
+void ResultsClass<T>::to_values(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate<Optional<NumberArgument>, Optional<NumberArgument>>();
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    size_t size = results->size();
+    size_t start = 0, end = size;
+    if (args.count > 0 && !Value::is_undefined(ctx, args[0])) {
+        start = std::min<size_t>(Value::validated_to_number(ctx, args[0], "start"), size);
+    }
+    if (args.count > 1 && !Value::is_undefined(ctx, args[1])) {
+        end = std::min<size_t>(Value::validated_to_number(ctx, args[1], "end"), size);
+    }
+    if (end < start) {
+        end = start;
+    }
+
+    return_value.set(export_range(ctx, *results, start, end));
+}
+
+template <typename T>
+typename T::Object ResultsClass<T>::export_range(ContextType ctx, realm::js::Results<T>& results, size_t start,
+                                                 size_t end)
+{
+    NativeAccessor<T> accessor(ctx, results);
+    std::vector<ValueType> values;
+    values.reserve(end - start);
+    for (size_t i = start; i < end; ++i) {
+        values.push_back(results.get(accessor, i));
+    }
+    return Object::create_array(ctx, values);
+}
+
+// Native pagination: boxes one [start, start + count) page through the bulk
+// export path, remembers it, and schedules a task on the event loop that
+// boxes the following page during idle time — so scroll-driven requests
+// walking forward usually find their page already boxed. JS values can only
+// be created on the JS thread, so the prefetch runs there, off the critical
+// path rather than on another thread. Pages are stamped with the read
+// version and never served across a version change.
+template <typename T>
+void ResultsClass<T>::window(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate<NumberArgument, NumberArgument>();
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    size_t size = results->size();
+    size_t start = std::min<size_t>(Value::validated_to_number(ctx, args[0], "start"), size);
+    size_t count = Value::validated_to_number(ctx, args[1], "count");
+    size_t end = std::min(start + count, size);
+
+    auto realm = results->get_realm();
+    bool cacheable = !realm->is_in_transaction() && realm->is_in_read_transaction();
+    uint64_t version = cacheable ? realm->read_transaction_version().version : 0;
+
+    if (cacheable) {
+        if (auto page = results->find_window_page(start, end, version)) {
+            return_value.set(static_cast<ObjectType>(*page));
+            if (end < size && count > 0) {
+                schedule_window_prefetch(ctx, this_object, end, count, version);
+            }
+            return;
+        }
+    }
+
+    ObjectType page = export_range(ctx, *results, start, end);
+    return_value.set(page);
+    if (cacheable) {
+        results->cache_window_page(start, end, version, Protected<ObjectType>(ctx, page));
+        if (end < size && count > 0) {
+            schedule_window_prefetch(ctx, this_object, end, count, version);
+        }
+    }
+}
+
+template <typename T>
+void ResultsClass<T>::schedule_window_prefetch(ContextType ctx, ObjectType this_object, size_t start, size_t count,
+                                               uint64_t version)
+{
     auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
-    return_value.set(ResultsClass<T>::create_instance(ctx, results->snapshot()));
+    if (results->find_window_page(start, std::min(start + count, results->size()), version)) {
+        return;
+    }
+
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+    results->get_realm()->scheduler()->invoke([protected_ctx, protected_this, start, count, version] {
+        HANDLESCOPE(protected_ctx)
+        auto results = get_internal<T, ResultsClass<T>>(protected_ctx, protected_this);
+        if (!results) {
+            return;
+        }
+        auto realm = results->get_realm();
+        if (realm->is_closed() || realm->is_in_transaction() || !realm->is_in_read_transaction()) {
+            return;
+        }
+        if (realm->read_transaction_version().version != version) {
+            // The data moved on before we got idle time; the next window()
+            // call will prefetch against the new version.
+            return;
+        }
+        try {
+            size_t size = results->size();
+            size_t clamped_start = std::min(start, size);
+            size_t end = std::min(start + count, size);
+            if (clamped_start >= end || results->find_window_page(clamped_start, end, version)) {
+                return;
+            }
+            ObjectType page = export_range(protected_ctx, *results, clamped_start, end);
+            results->cache_window_page(clamped_start, end, version,
+                                       Protected<ObjectType>(protected_ctx, page));
+        }
+        catch (...) {
+            // A failed prefetch is just a cache miss; the on-demand path will
+            // surface any real error.
+        }
+    });
 }
 
 template <typename T>
@@ -289,7 +662,7 @@ template <typename T>
 void ResultsClass<T>::sorted(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
     auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
-    return_value.set(ResultsClass<T>::create_instance(ctx, results->sort(ResultsClass<T>::get_keypaths(ctx, args))));
+    return_value.set(ResultsClass<T>::create_instance(ctx, sort_collection(ctx, *results, args)));
 }
 
 template <typename T>
@@ -304,11 +677,46 @@ void ResultsClass<T>::is_empty(ContextType ctx, ObjectType this_object, Argument
     return_value.set(get_internal<T, ResultsClass<T>>(ctx, this_object)->size() == 0);
 }
 
+template <typename T>
+void ResultsClass<T>::is_frozen(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    return_value.set(get_internal<T, ResultsClass<T>>(ctx, this_object)->is_frozen());
+}
+
+// Return an immutable copy of these Results, pinned to the version the
+// collection is at. An already-frozen Realm may be passed so that many
+// collections can share one frozen Realm instance instead of pinning a new
+// version each.
+template <typename T>
+void ResultsClass<T>::freeze(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate<Optional<ObjectArgument>>();
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+
+    SharedRealm frozen_realm;
+    if (args.count == 1 && !Value::is_undefined(ctx, args[0])) {
+        auto realm_object = Value::validated_to_object(ctx, args[0], "realm");
+        if (!Object::template is_instance<RealmClass<T>>(ctx, realm_object)) {
+            throw std::runtime_error("Argument to 'freeze' must be a frozen Realm.");
+        }
+        frozen_realm = *get_internal<T, RealmClass<T>>(ctx, realm_object);
+        if (!frozen_realm->is_frozen()) {
+            throw std::runtime_error("Argument to 'freeze' must be a frozen Realm.");
+        }
+    }
+    else {
+        frozen_realm = RealmClass<T>::freeze_realm(ctx, results->get_realm());
+    }
+
+    return_value.set(create_instance(ctx, results->freeze(frozen_realm)));
+}
+
 template <typename T>
 template <typename Fn>
 void ResultsClass<T>::index_of(ContextType ctx, Fn& fn, Arguments& args, ReturnValue& return_value)
 {
-    args.validate_maximum(1);
+    args.validate<Optional<AnyArgument>>();
 
     size_t ndx;
     try {
@@ -332,7 +740,7 @@ void ResultsClass<T>::index_of(ContextType ctx, Fn& fn, Arguments& args, ReturnV
 template <typename T>
 void ResultsClass<T>::update(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
-    args.validate_maximum(2);
+    args.validate<StringArgument, Optional<AnyArgument>>();
 
     std::string property = Value::validated_to_string(ctx, args[0], "property");
     auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
@@ -347,8 +755,56 @@ void ResultsClass<T>::update(ContextType ctx, ObjectType this_object, Arguments&
         throw std::runtime_error("Can only 'update' objects within a transaction.");
     }
 
-    // TODO: This approach just moves the for-loop from JS to C++
-    // Ideally, we'd implement this in OS or Core in an optimized fashion
+    // Bulk path for plain scalar columns: unbox the value once through the
+    // same accessor the per-row path would use (so a type mismatch throws
+    // the identical error), then fill the column in a tight Obj loop instead
+    // of boxing a JS wrapper per row. Nulls on non-nullable columns and
+    // everything with conversion or relationship semantics — links,
+    // collections, mixed, primary keys — stay on the generic path.
+    const Property& target = *schema.property_for_name(StringData(property));
+    auto base_type = target.type & ~realm::PropertyType::Flags;
+    bool bulk_eligible = !realm::is_collection(target.type) && !target.is_primary &&
+                         (base_type == realm::PropertyType::Int || base_type == realm::PropertyType::Bool ||
+                          base_type == realm::PropertyType::Float || base_type == realm::PropertyType::Double ||
+                          base_type == realm::PropertyType::Date);
+    if (bulk_eligible) {
+        realm::Mixed value;
+        bool have_value = true;
+        if (Value::is_null(ctx, args[1]) || Value::is_undefined(ctx, args[1])) {
+            have_value = is_nullable(target.type);
+        }
+        else {
+            NativeAccessor<T> accessor(ctx, realm, schema);
+            switch (base_type) {
+                case realm::PropertyType::Int:
+                    value = realm::Mixed(accessor.template unbox<int64_t>(args[1]));
+                    break;
+                case realm::PropertyType::Bool:
+                    value = realm::Mixed(accessor.template unbox<bool>(args[1]));
+                    break;
+                case realm::PropertyType::Float:
+                    value = realm::Mixed(accessor.template unbox<float>(args[1]));
+                    break;
+                case realm::PropertyType::Double:
+                    value = realm::Mixed(accessor.template unbox<double>(args[1]));
+                    break;
+                case realm::PropertyType::Date:
+                    value = realm::Mixed(accessor.template unbox<realm::Timestamp>(args[1]));
+                    break;
+                default:
+                    have_value = false;
+                    break;
+            }
+        }
+        if (have_value) {
+            realm::ColKey column = target.column_key;
+            for (auto i = results->size(); i > 0; i--) {
+                results->get(i - 1).set_any(column, value);
+            }
+            return;
+        }
+    }
+
     for (auto i = results->size(); i > 0; i--) {
         auto realm_object = realm::Object(realm, schema, results->get(i - 1));
         auto obj = RealmObjectClass<T>::create_instance(ctx, realm_object);
@@ -356,33 +812,210 @@ void ResultsClass<T>::update(ContextType ctx, ObjectType this_object, Arguments&
     }
 }
 
+// Completes the native aggregate set alongside min/max/sum/avg. With no
+// argument this is the row count; with a property name it counts the rows
+// where that property is non-null, running the null-exclusion condition as a
+// core query instead of boxing rows. Non-nullable properties short-circuit
+// to the row count.
+template <typename T>
+void ResultsClass<T>::count(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate<Optional<AnyArgument>>();
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+
+    if (args.count == 0 || Value::is_undefined(ctx, args[0])) {
+        return_value.set(static_cast<uint32_t>(results->size()));
+        return;
+    }
+
+    if (results->get_type() != realm::PropertyType::Object) {
+        throw std::invalid_argument("Filtering by property is only supported for collections of objects.");
+    }
+
+    const ObjectSchema& object_schema = results->get_object_schema();
+    std::string property_name = Value::validated_to_string(ctx, args[0], "property");
+    const Property* property = object_schema.property_for_public_name(property_name);
+    if (!property) {
+        throw std::invalid_argument(
+            util::format("Property '%1' does not exist on object '%2'", property_name, object_schema.name));
+    }
+
+    // Collection-valued properties are never null themselves (the Nullable
+    // flag there describes the elements), so they count like non-nullable
+    // properties: every row has one.
+    if (is_collection(property->type) || !is_nullable(property->type)) {
+        return_value.set(static_cast<uint32_t>(results->size()));
+        return;
+    }
+
+    auto table = ObjectStore::table_for_object_type(results->get_realm()->read_group(), object_schema.name);
+    auto query = table->where().not_equal(property->column_key, realm::null());
+    return_value.set(static_cast<uint32_t>(results->filter(std::move(query)).size()));
+}
+
+/**
+ * @brief Pack this Results into a plain, structured-cloneable handle.
+ *
+ *  The handle — file path, pinned `{version, index}`, object type and the
+ *  query (with its ordering) serialized back to its textual form — can cross
+ *  a `worker_threads` boundary and be rehydrated on the other side with
+ *  `Realm._importResultsHandle`, yielding the identical row set at the
+ *  pinned version without re-running schema initialization or guessing at
+ *  versions. Requires a frozen Realm: freezing is what keeps the version
+ *  pinned while the handle is in flight.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the Results itself
+ * @param args \ref Arguments structure (none expected)
+ * @param return_value \ref ReturnValue wrapping the handle object
+ * @exception std::runtime_error Thrown if the Realm is not frozen or the
+ *   Results does not contain objects
+ */
+template <typename T>
+void ResultsClass<T>::export_handle(ContextType ctx, ObjectType this_object, Arguments& args,
+                                    ReturnValue& return_value)
+{
+    args.validate<>();
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    auto realm = results->get_realm();
+    if (!realm->is_frozen()) {
+        throw std::runtime_error(
+            "Only Results from a frozen Realm can be exported as a handle; call freeze() first.");
+    }
+    if (results->get_type() != realm::PropertyType::Object) {
+        throw std::runtime_error("Only Results of objects can be exported as a handle.");
+    }
+
+    auto const& object_schema = results->get_object_schema();
+    std::string query_description = results->get_query().get_description();
+    auto const& ordering = results->get_descriptor_ordering();
+    if (!ordering.is_empty()) {
+        auto table = ObjectStore::table_for_object_type(realm->read_group(), object_schema.name);
+        query_description += " " + ordering.get_description(table);
+    }
+
+    auto version = realm->read_transaction_version();
+    return_value.set(Object::create_obj(
+        ctx, {
+                 {"path", Value::from_string(ctx, realm->config().path)},
+                 {"type", Value::from_string(ctx, object_schema.name)},
+                 {"query", Value::from_string(ctx, query_description)},
+                 {"version", Object::create_obj(ctx,
+                                                {
+                                                    {"version", Value::from_number(ctx, double(version.version))},
+                                                    {"index", Value::from_number(ctx, double(version.index))},
+                                                })},
+             }));
+}
+
 template <typename T>
 void ResultsClass<T>::index_of(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
     auto fn = [&](auto&& row) {
         auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+        // Managed objects carry their row directly; hand it to core without
+        // going through the accessor's unboxing machinery. Table-backed
+        // results can then resolve the position from the object's key instead
+        // of scanning.
+        if (Value::is_object(ctx, row)) {
+            ObjectType js_object = Value::to_object(ctx, row);
+            if (Object::template is_instance<RealmObjectClass<T>>(ctx, js_object)) {
+                auto realm_object = get_internal<T, RealmObjectClass<T>>(ctx, js_object);
+                if (realm_object && realm_object->is_valid()) {
+                    return results->index_of(realm_object->obj());
+                }
+            }
+        }
         NativeAccessor<T> accessor(ctx, *results);
         return results->index_of(accessor, row);
     };
     index_of(ctx, fn, args, return_value);
 }
 
+// Position lookup for callers that already hold an object key (see
+// RealmObject._objectKey) — resolves the key through the table and asks core
+// for its position, with no JS object or accessor involved. Returns -1 for
+// keys not present in the table or not contained in these results.
+template <typename T>
+void ResultsClass<T>::index_of_object_key(ContextType ctx, ObjectType this_object, Arguments& args,
+                                          ReturnValue& return_value)
+{
+    args.validate<Optional<AnyArgument>>();
+
+    auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
+    if (results->get_type() != realm::PropertyType::Object) {
+        throw std::runtime_error("Object type does not match the type contained in result");
+    }
+
+    auto object_key_string = Value::validated_to_string(ctx, args[0], "objectKey");
+    int64_t object_key;
+    try {
+        object_key = std::stoll(object_key_string);
+    }
+    catch (...) {
+        return_value.set(-1);
+        return;
+    }
+
+    auto table =
+        ObjectStore::table_for_object_type(results->get_realm()->read_group(), results->get_object_schema().name);
+    auto obj = table->try_get_object(ObjKey(object_key));
+    if (!obj) {
+        return_value.set(-1);
+        return;
+    }
+
+    size_t ndx = results->index_of(obj);
+    if (ndx == realm::not_found) {
+        return_value.set(-1);
+    }
+    else {
+        return_value.set((uint32_t)ndx);
+    }
+}
+
 template <typename T>
 template <typename U>
 void ResultsClass<T>::add_listener(ContextType ctx, U& collection, ObjectType this_object, Arguments& args)
 {
-    args.validate_maximum(1);
+    args.validate<FunctionArgument>();
 
     auto callback = Value::validated_to_function(ctx, args[0]);
     Protected<FunctionType> protected_callback(ctx, callback);
     Protected<ObjectType> protected_this(ctx, this_object);
     Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
 
+    // The initial notification arrives when the notifier first runs, not on
+    // a version advance, so batching it would strand it until some unrelated
+    // later write flushes the queue; it is always delivered directly.
+    auto is_initial = std::make_shared<bool>(true);
+    const void* batch_key = collection.get_realm().get();
     auto token = collection.add_notification_callback([=](CollectionChangeSet const& change_set) {
-        HANDLESCOPE(protected_ctx)
-        ValueType arguments[]{static_cast<ObjectType>(protected_this),
-                              CollectionClass<T>::create_collection_change_set(protected_ctx, change_set)};
-        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, arguments);
+        // Core has already computed the change set on its background notifier
+        // thread; flatten its IndexSets into ready-to-box buffers now, before
+        // queueing delivery, so the (possibly deferred) delivery does nothing
+        // but wrap contiguous memory in Uint32Arrays and call back.
+        auto precomputed =
+            std::make_shared<typename CollectionClass<T>::PrecomputedChangeSet const>(change_set);
+        auto deliver = [=] {
+            HANDLESCOPE(protected_ctx)
+            metrics::increment(metrics::counters().notifications_delivered);
+            ValueType arguments[]{static_cast<ObjectType>(protected_this),
+                                  CollectionClass<T>::create_collection_change_set(protected_ctx, *precomputed)};
+            Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, arguments);
+        };
+        bool initial = *is_initial;
+        *is_initial = false;
+        if (!initial && notifications::NotificationBatcher<T>::enabled()) {
+            // deferred until RealmDelegate::did_change flushes this Realm's
+            // batch for the version advance
+            notifications::NotificationBatcher<T>::enqueue(batch_key, std::move(deliver));
+        }
+        else {
+            deliver();
+        }
     });
     NotificationBucket::emplace(collection.m_notification_handle, std::move(protected_callback), std::move(token));
 }
@@ -399,7 +1032,7 @@ template <typename T>
 template <typename U>
 void ResultsClass<T>::remove_listener(ContextType ctx, U& collection, ObjectType this_object, Arguments& args)
 {
-    args.validate_maximum(1);
+    args.validate<FunctionArgument>();
 
     auto callback = Value::validated_to_function(ctx, args[0]);
     auto protected_callback = Protected<FunctionType>(ctx, callback);
@@ -418,7 +1051,7 @@ template <typename T>
 void ResultsClass<T>::remove_all_listeners(ContextType ctx, ObjectType this_object, Arguments& args,
                                            ReturnValue& return_value)
 {
-    args.validate_maximum(0);
+    args.validate<>();
 
     auto results = get_internal<T, ResultsClass<T>>(ctx, this_object);
     NotificationBucket::erase(results->m_notification_handle);
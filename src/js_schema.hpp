@@ -18,7 +18,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include "js_startup_trace.hpp"
 #include "js_types.hpp"
 #include "dictionary_schema.hpp"
 #include <realm/object-store/schema.hpp>
@@ -40,15 +47,155 @@ struct Schema {
     using ObjectDefaults = std::map<std::string, Protected<ValueType>>;
     using ObjectDefaultsMap = std::map<std::string, ObjectDefaults>;
     using ConstructorMap = std::map<std::string, Protected<FunctionType>>;
+    // Immutable after construction, so instances opened from the same parse
+    // share one map and tearing an instance down is a refcount drop.
+    using SharedObjectDefaultsMap = std::shared_ptr<const ObjectDefaultsMap>;
+    using SharedConstructorMap = std::shared_ptr<const ConstructorMap>;
 
     static ObjectType dict_for_property_array(ContextType, const ObjectSchema&, ObjectType);
     static Property parse_property(ContextType, ValueType, StringData, std::string, ObjectDefaults&);
     static ObjectSchema parse_object_schema(ContextType, ObjectType, ObjectDefaultsMap&, ConstructorMap&);
-    static realm::Schema parse_schema(ContextType, ObjectType, ObjectDefaultsMap&, ConstructorMap&);
+    static realm::Schema parse_schema(ContextType, ObjectType, SharedObjectDefaultsMap&, ConstructorMap&);
+
+    /// Drops all memoized parse results; called from `Realm.clearTestState`
+    /// so cached `Protected` default values don't outlive the test runtime.
+    static void clear_parse_cache();
+
+    // Precompiled schema support: the result of a parse — object and property
+    // metadata plus scalar defaults — serialized into a compact
+    // version-tagged blob. A build step produces the blob once (via
+    // `Realm._schemaToBinary`) and `Realm.open` accepts it in place of the JS
+    // schema array, replacing hundreds of JS property reads on the cold-start
+    // path with one linear scan of flat bytes.
+    static std::string schema_to_binary(ContextType, const realm::Schema&, const ObjectDefaultsMap&);
+    static realm::Schema schema_from_binary(ContextType, BinaryData, ObjectDefaultsMap&);
 
     static ObjectType object_for_schema(ContextType, const realm::Schema&);
     static ObjectType object_for_object_schema(ContextType, const ObjectSchema&);
     static ObjectType object_for_property(ContextType, const Property&);
+
+private:
+    // Parsing the same schema array on every open is pure overhead for apps
+    // that open one Realm per shard: the parsed realm::Schema and the default
+    // values are memoized keyed by a structural hash of the JS input, so a
+    // repeat open only re-binds the constructors. Schemas whose structure
+    // cannot be hashed faithfully (e.g. object- or function-valued property
+    // defaults) simply bypass the cache.
+    struct ParseCacheEntry {
+        realm::Schema schema;
+        SharedObjectDefaultsMap defaults;
+    };
+    struct ParseCache {
+        std::mutex mutex;
+        std::unordered_map<uint64_t, ParseCacheEntry> entries;
+    };
+    static ParseCache& parse_cache()
+    {
+        static ParseCache s_cache;
+        return s_cache;
+    }
+
+public:
+    // The structural-hash helpers below also back the Realm-open fingerprint
+    // cache (see RealmClass::fingerprint_config), which hashes whole config
+    // objects with the same rules the parse cache uses for schemas.
+    static constexpr uint64_t s_hash_seed = 14695981039346656037ull; // FNV-1a offset basis
+
+    static void hash_combine(uint64_t& hash, const void* data, size_t size)
+    {
+        auto bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    }
+
+    static void hash_string(uint64_t& hash, const std::string& string)
+    {
+        size_t size = string.size();
+        hash_combine(hash, &size, sizeof(size));
+        hash_combine(hash, string.data(), size);
+    }
+
+    // Structural hash of a schema-shaped JS value. Returns false when the
+    // value's contribution to the parse result can't be captured by a hash,
+    // which makes the whole schema uncacheable.
+    static bool hash_schema_value(ContextType ctx, ValueType const& value, uint64_t& hash, int depth)
+    {
+        if (Value::is_undefined(ctx, value) || Value::is_null(ctx, value)) {
+            hash_combine(hash, "\0", 1);
+            return true;
+        }
+        if (Value::is_string(ctx, value)) {
+            hash_string(hash, Value::to_string(ctx, value));
+            return true;
+        }
+        if (Value::is_boolean(ctx, value)) {
+            bool b = Value::to_boolean(ctx, value);
+            hash_combine(hash, &b, sizeof(b));
+            return true;
+        }
+        if (Value::is_number(ctx, value)) {
+            double number = Value::to_number(ctx, value);
+            hash_combine(hash, &number, sizeof(number));
+            return true;
+        }
+        if (depth > 0 && Value::is_object(ctx, value) && !Value::is_function(ctx, value)) {
+            ObjectType object = Value::to_object(ctx, value);
+            if (Value::is_array(ctx, object)) {
+                uint32_t length = Object::validated_get_length(ctx, object);
+                hash_combine(hash, &length, sizeof(length));
+                for (uint32_t i = 0; i < length; ++i) {
+                    if (!hash_schema_value(ctx, Object::get_property(ctx, object, i), hash, depth - 1)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            auto keys = Object::get_property_names(ctx, object);
+            if (keys.empty()) {
+                // Exotic objects (Date, ArrayBuffer, …) used as defaults have
+                // no enumerable keys and would collide with each other.
+                return false;
+            }
+            for (auto& key : keys) {
+                hash_string(hash, key);
+                if (!hash_schema_value(ctx, Object::get_property(ctx, object, key), hash, depth - 1)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // Hashes the whole schema array and binds constructors to their object
+    // names along the way (constructors must be re-bound per call — only the
+    // parse result is shared). Returns nullopt for uncacheable schemas.
+    static std::optional<uint64_t> hash_schema(ContextType ctx, ObjectType schema_object,
+                                               ConstructorMap& constructors)
+    {
+        static const String name_string = "name";
+        static const String schema_string = "schema";
+
+        uint64_t hash = s_hash_seed;
+        uint32_t length = Object::validated_get_length(ctx, schema_object);
+        for (uint32_t i = 0; i < length; ++i) {
+            ObjectType entry = Object::validated_get_object(ctx, schema_object, i, "ObjectSchema");
+            if (Value::is_constructor(ctx, entry)) {
+                FunctionType constructor = Value::to_constructor(ctx, entry);
+                entry = Object::validated_get_object(ctx, constructor, schema_string,
+                                                     "Realm object constructor must have a 'schema' property.");
+                std::string name = Object::validated_get_string(ctx, entry, name_string, "ObjectSchema");
+                constructors.emplace(name, Protected<FunctionType>(ctx, constructor));
+            }
+            // Depth covers: object schema -> properties -> property spec ->
+            // scalar default. Anything deeper or non-scalar bails.
+            if (!hash_schema_value(ctx, entry, hash, 4)) {
+                return std::nullopt;
+            }
+        }
+        return hash;
+    }
 };
 
 template <typename T>
@@ -72,6 +219,58 @@ typename T::Object Schema<T>::dict_for_property_array(ContextType ctx, const Obj
     return dict;
 }
 
+/// Returns the scalar PropertyType named by `type`, or none when `type` is
+/// not one of the fixed scalar names and must refer to an object type in the
+/// schema. Classification is a packed-key switch (see type_name_key) with one
+/// confirming compare per call.
+static inline std::optional<realm::PropertyType> scalar_property_type(StringData type)
+{
+    using realm::PropertyType;
+    switch (type_name_key(type)) {
+        case type_name_key("bool"):
+            if (type == "bool")
+                return PropertyType::Bool;
+            break;
+        case type_name_key("int"):
+            if (type == "int")
+                return PropertyType::Int;
+            break;
+        case type_name_key("float"):
+            if (type == "float")
+                return PropertyType::Float;
+            break;
+        case type_name_key("double"):
+            if (type == "double")
+                return PropertyType::Double;
+            break;
+        case type_name_key("string"):
+            if (type == "string")
+                return PropertyType::String;
+            break;
+        case type_name_key("date"):
+            if (type == "date")
+                return PropertyType::Date;
+            break;
+        case type_name_key("data"):
+            if (type == "data")
+                return PropertyType::Data;
+            break;
+        case type_name_key("decimal128"):
+            if (type == "decimal128")
+                return PropertyType::Decimal;
+            break;
+        case type_name_key("objectId"):
+            if (type == "objectId")
+                return PropertyType::ObjectId;
+            break;
+        case type_name_key("uuid"):
+            if (type == "uuid")
+                return PropertyType::UUID;
+            break;
+    }
+    return std::nullopt;
+}
+
 static inline void parse_property_type(StringData object_name, Property& prop, StringData type)
 {
     using realm::PropertyType;
@@ -104,81 +303,17 @@ static inline void parse_property_type(StringData object_name, Property& prop, S
         }
     }
 
-    if (type == "bool") {
-        prop.type |= PropertyType::Bool;
+    if (auto scalar = scalar_property_type(type)) {
+        prop.type |= *scalar;
     }
     else if (type == "mixed") {
         prop.type |= PropertyType::Nullable | PropertyType::Mixed;
     }
-    else if (type == "int") {
-        prop.type |= PropertyType::Int;
-    }
-    else if (type == "float") {
-        prop.type |= PropertyType::Float;
-    }
-    else if (type == "double") {
-        prop.type |= PropertyType::Double;
-    }
-    else if (type == "string") {
-        prop.type |= PropertyType::String;
-    }
-    else if (type == "date") {
-        prop.type |= PropertyType::Date;
-    }
-    else if (type == "data") {
-        prop.type |= PropertyType::Data;
-    }
-    else if (type == "decimal128") {
-        prop.type |= PropertyType::Decimal;
-    }
-    else if (type == "objectId") {
-        prop.type |= PropertyType::ObjectId;
-    }
-    else if (type == "uuid") {
-        prop.type |= PropertyType::UUID;
-    }
     else if (type == "list") {
-        if (prop.object_type == "bool") {
-            prop.type |= PropertyType::Bool | PropertyType::Array;
-            prop.object_type = "";
-        }
-        else if (prop.object_type == "int") {
-            prop.type |= PropertyType::Int | PropertyType::Array;
-            prop.object_type = "";
-        }
-        else if (prop.object_type == "float") {
-            prop.type |= PropertyType::Float | PropertyType::Array;
-            prop.object_type = "";
-        }
-        else if (prop.object_type == "double") {
-            prop.type |= PropertyType::Double | PropertyType::Array;
-            prop.object_type = "";
-        }
-        else if (prop.object_type == "string") {
-            prop.type |= PropertyType::String | PropertyType::Array;
-            prop.object_type = "";
-        }
-        else if (prop.object_type == "date") {
-            prop.type |= PropertyType::Date | PropertyType::Array;
-            prop.object_type = "";
-        }
-        else if (prop.object_type == "data") {
-            prop.type |= PropertyType::Data | PropertyType::Array;
-            prop.object_type = "";
-        }
-        else if (prop.object_type == "decimal128") {
-            prop.type |= PropertyType::Decimal | PropertyType::Array;
-            prop.object_type = "";
-        }
-        else if (prop.object_type == "objectId") {
-            prop.type |= PropertyType::ObjectId | PropertyType::Array;
+        if (auto element = scalar_property_type(prop.object_type)) {
+            prop.type |= *element | PropertyType::Array;
             prop.object_type = "";
         }
-        else if (prop.object_type == "uuid") {
-            prop.type |= PropertyType::UUID | PropertyType::Array;
-            prop.object_type = "";
-        }
-
         else {
             if (is_nullable(prop.type)) {
                 throw std::logic_error(
@@ -418,18 +553,265 @@ ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_s
 }
 
 template <typename T>
-realm::Schema Schema<T>::parse_schema(ContextType ctx, ObjectType schema_object, ObjectDefaultsMap& defaults,
+realm::Schema Schema<T>::parse_schema(ContextType ctx, ObjectType schema_object, SharedObjectDefaultsMap& defaults,
                                       ConstructorMap& constructors)
 {
+    startup::PhaseTimer timer("schemaParse");
+    auto hash = hash_schema(ctx, schema_object, constructors);
+    if (hash) {
+        std::lock_guard<std::mutex> lock(parse_cache().mutex);
+        auto it = parse_cache().entries.find(*hash);
+        if (it != parse_cache().entries.end()) {
+            // Cache hit hands out the shared map itself — no per-entry copy.
+            defaults = it->second.defaults;
+            return it->second.schema;
+        }
+    }
+
     std::vector<ObjectSchema> schema;
     uint32_t length = Object::validated_get_length(ctx, schema_object);
 
+    ObjectDefaultsMap parsed_defaults;
     for (uint32_t i = 0; i < length; i++) {
         ObjectType object_schema_object = Object::validated_get_object(ctx, schema_object, i, "ObjectSchema");
-        ObjectSchema object_schema = parse_object_schema(ctx, object_schema_object, defaults, constructors);
+        ObjectSchema object_schema = parse_object_schema(ctx, object_schema_object, parsed_defaults, constructors);
         schema.emplace_back(std::move(object_schema));
     }
+    defaults = std::make_shared<const ObjectDefaultsMap>(std::move(parsed_defaults));
+
+    realm::Schema parsed(schema);
+    if (hash) {
+        std::lock_guard<std::mutex> lock(parse_cache().mutex);
+        parse_cache().entries.emplace(*hash, ParseCacheEntry{parsed, defaults});
+    }
+    return parsed;
+}
+
+template <typename T>
+void Schema<T>::clear_parse_cache()
+{
+    std::lock_guard<std::mutex> lock(parse_cache().mutex);
+    parse_cache().entries.clear();
+}
+
+namespace _schema_binary {
+// Blob layout, all integers little-endian:
+//   "RJSS" magic, u8 format version, u32 object count, then per object:
+//   name, u8 table type, primary key, persisted and computed property lists
+//   (name, public name, u32 raw PropertyType, object type, link origin,
+//   u8 primary, u8 indexed), and a tagged scalar default list.
+static constexpr char s_magic[4] = {'R', 'J', 'S', 'S'};
+static constexpr uint8_t s_format_version = 1;
+
+enum class DefaultTag : uint8_t { Null = 0, Boolean = 1, Number = 2, String = 3 };
+
+inline void append_uint32(std::string& out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+inline void append_string(std::string& out, const std::string& string)
+{
+    append_uint32(out, static_cast<uint32_t>(string.size()));
+    out.append(string);
+}
+
+struct Reader {
+    const char* pos;
+    const char* end;
+
+    void require(size_t bytes) const
+    {
+        if (static_cast<size_t>(end - pos) < bytes) {
+            throw std::runtime_error("Invalid binary schema: truncated data.");
+        }
+    }
+
+    uint8_t read_byte()
+    {
+        require(1);
+        return static_cast<uint8_t>(*pos++);
+    }
+
+    uint32_t read_uint32()
+    {
+        require(4);
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) {
+            value |= static_cast<uint32_t>(static_cast<uint8_t>(*pos++)) << (8 * i);
+        }
+        return value;
+    }
+
+    double read_double()
+    {
+        require(sizeof(double));
+        double value;
+        std::memcpy(&value, pos, sizeof(double));
+        pos += sizeof(double);
+        return value;
+    }
+
+    std::string read_string()
+    {
+        uint32_t size = read_uint32();
+        require(size);
+        std::string string(pos, size);
+        pos += size;
+        return string;
+    }
+};
+} // namespace _schema_binary
+
+template <typename T>
+std::string Schema<T>::schema_to_binary(ContextType ctx, const realm::Schema& schema,
+                                        const ObjectDefaultsMap& defaults)
+{
+    using namespace _schema_binary;
+
+    std::string out;
+    out.append(s_magic, sizeof(s_magic));
+    out.push_back(static_cast<char>(s_format_version));
+
+    auto append_property = [&](const Property& property) {
+        append_string(out, property.name);
+        append_string(out, property.public_name);
+        append_uint32(out, static_cast<uint32_t>(property.type));
+        append_string(out, property.object_type);
+        append_string(out, property.link_origin_property_name);
+        out.push_back(property.is_primary ? 1 : 0);
+        out.push_back(property.is_indexed ? 1 : 0);
+    };
+
+    append_uint32(out, static_cast<uint32_t>(schema.size()));
+    for (auto& object_schema : schema) {
+        append_string(out, object_schema.name);
+        out.push_back(static_cast<char>(object_schema.table_type));
+        append_string(out, object_schema.primary_key);
+
+        append_uint32(out, static_cast<uint32_t>(object_schema.persisted_properties.size()));
+        for (auto& property : object_schema.persisted_properties) {
+            append_property(property);
+        }
+        append_uint32(out, static_cast<uint32_t>(object_schema.computed_properties.size()));
+        for (auto& property : object_schema.computed_properties) {
+            append_property(property);
+        }
+
+        auto defaults_it = defaults.find(object_schema.name);
+        uint32_t default_count =
+            defaults_it == defaults.end() ? 0 : static_cast<uint32_t>(defaults_it->second.size());
+        append_uint32(out, default_count);
+        if (defaults_it != defaults.end()) {
+            for (auto& [property_name, value] : defaults_it->second) {
+                append_string(out, property_name);
+                if (Value::is_null(ctx, value) || Value::is_undefined(ctx, value)) {
+                    out.push_back(static_cast<char>(DefaultTag::Null));
+                }
+                else if (Value::is_boolean(ctx, value)) {
+                    out.push_back(static_cast<char>(DefaultTag::Boolean));
+                    out.push_back(Value::to_boolean(ctx, value) ? 1 : 0);
+                }
+                else if (Value::is_number(ctx, value)) {
+                    out.push_back(static_cast<char>(DefaultTag::Number));
+                    double number = Value::to_number(ctx, value);
+                    char bytes[sizeof(double)];
+                    std::memcpy(bytes, &number, sizeof(double));
+                    out.append(bytes, sizeof(double));
+                }
+                else if (Value::is_string(ctx, value)) {
+                    out.push_back(static_cast<char>(DefaultTag::String));
+                    append_string(out, Value::to_string(ctx, value));
+                }
+                else {
+                    throw std::invalid_argument(
+                        util::format("Cannot precompile schema: default value for property '%1.%2' is not a "
+                                     "null, boolean, number or string.",
+                                     object_schema.name, property_name));
+                }
+            }
+        }
+    }
+    return out;
+}
+
+template <typename T>
+realm::Schema Schema<T>::schema_from_binary(ContextType ctx, BinaryData blob, ObjectDefaultsMap& defaults)
+{
+    using namespace _schema_binary;
+
+    Reader reader{blob.data(), blob.data() + blob.size()};
+    reader.require(sizeof(s_magic) + 1);
+    if (std::memcmp(reader.pos, s_magic, sizeof(s_magic)) != 0) {
+        throw std::invalid_argument("Invalid binary schema: bad magic bytes.");
+    }
+    reader.pos += sizeof(s_magic);
+    if (uint8_t version = reader.read_byte(); version != s_format_version) {
+        throw std::invalid_argument(util::format("Invalid binary schema: unsupported format version %1.",
+                                                 static_cast<unsigned>(version)));
+    }
+
+    auto read_property = [&reader] {
+        Property property;
+        property.name = reader.read_string();
+        property.public_name = reader.read_string();
+        property.type = static_cast<realm::PropertyType>(reader.read_uint32());
+        property.object_type = reader.read_string();
+        property.link_origin_property_name = reader.read_string();
+        property.is_primary = reader.read_byte() != 0;
+        property.is_indexed = reader.read_byte() != 0;
+        return property;
+    };
 
+    std::vector<ObjectSchema> schema;
+    uint32_t object_count = reader.read_uint32();
+    schema.reserve(object_count);
+    for (uint32_t i = 0; i < object_count; ++i) {
+        ObjectSchema object_schema;
+        object_schema.name = reader.read_string();
+        object_schema.table_type = static_cast<typename ObjectSchema::ObjectType>(reader.read_byte());
+        object_schema.primary_key = reader.read_string();
+
+        uint32_t persisted_count = reader.read_uint32();
+        object_schema.persisted_properties.reserve(persisted_count);
+        for (uint32_t j = 0; j < persisted_count; ++j) {
+            object_schema.persisted_properties.push_back(read_property());
+        }
+        uint32_t computed_count = reader.read_uint32();
+        object_schema.computed_properties.reserve(computed_count);
+        for (uint32_t j = 0; j < computed_count; ++j) {
+            object_schema.computed_properties.push_back(read_property());
+        }
+
+        ObjectDefaults object_defaults;
+        uint32_t default_count = reader.read_uint32();
+        for (uint32_t j = 0; j < default_count; ++j) {
+            std::string property_name = reader.read_string();
+            ValueType value;
+            switch (static_cast<DefaultTag>(reader.read_byte())) {
+                case DefaultTag::Null:
+                    value = Value::from_null(ctx);
+                    break;
+                case DefaultTag::Boolean:
+                    value = Value::from_boolean(ctx, reader.read_byte() != 0);
+                    break;
+                case DefaultTag::Number:
+                    value = Value::from_number(ctx, reader.read_double());
+                    break;
+                case DefaultTag::String:
+                    value = Value::from_string(ctx, reader.read_string());
+                    break;
+                default:
+                    throw std::invalid_argument("Invalid binary schema: unknown default value tag.");
+            }
+            object_defaults.emplace(std::move(property_name), Protected<ValueType>(ctx, value));
+        }
+        defaults.emplace(object_schema.name, std::move(object_defaults));
+
+        schema.emplace_back(std::move(object_schema));
+    }
     return realm::Schema(schema);
 }
 
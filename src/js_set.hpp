@@ -30,6 +30,8 @@
 #include <realm/object-store/set.hpp>
 #include <realm/object-store/collection_notifications.hpp>
 
+#include <set>
+
 namespace realm {
 namespace js {
 
@@ -121,6 +123,8 @@ public:
     void derive_property_type(StringData const& object_name, Property& prop) const;
 
     notifications::NotificationHandle<T, NotificationToken> m_notification_handle;
+    CollectionSizeCache m_size_cache;
+    CollectionVersionTracker m_version_tracker;
 };
 
 
@@ -147,6 +151,7 @@ struct SetClass : ClassDefinition<T, realm::js::Set<T>, CollectionClass<T>> {
 
     // properties
     static void get_size(ContextType, ObjectType, ReturnValue&);
+    static void get_version(ContextType, ObjectType, ReturnValue&);
     static void get_optional(ContextType, ObjectType, ReturnValue&);
     static void get_indexed(ContextType, ObjectType, uint32_t, ReturnValue&);
     static void get_type(ContextType, ObjectType, ReturnValue&);
@@ -157,6 +162,13 @@ struct SetClass : ClassDefinition<T, realm::js::Set<T>, CollectionClass<T>> {
     static void clear(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void delete_element(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void has(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void add_all(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void has_all(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void delete_all(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void set_union(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void set_intersection(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void set_difference(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void is_subset_of(ContextType, ObjectType, Arguments&, ReturnValue&);
 
 
     static void filtered(ContextType, ObjectType, Arguments&, ReturnValue&);
@@ -174,6 +186,13 @@ struct SetClass : ClassDefinition<T, realm::js::Set<T>, CollectionClass<T>> {
         {"clear", wrap<clear>},
         {"delete", wrap<delete_element>},
         {"has", wrap<has>},
+        {"addAll", wrap<add_all>},
+        {"hasAll", wrap<has_all>},
+        {"deleteAll", wrap<delete_all>},
+        {"union", wrap<set_union>},
+        {"intersection", wrap<set_intersection>},
+        {"difference", wrap<set_difference>},
+        {"isSubsetOf", wrap<is_subset_of>},
         {"filtered", wrap<filtered>},
 
         {"min", wrap<compute_aggregate_on_collection<SetClass<T>, AggregateFunc::Min>>},
@@ -190,6 +209,7 @@ struct SetClass : ClassDefinition<T, realm::js::Set<T>, CollectionClass<T>> {
 
     PropertyMap<T> const properties = {
         {"size", {wrap<get_size>, nullptr}},
+        {"version", {wrap<get_version>, nullptr}},
         {"type", {wrap<get_type>, nullptr}},
         {"optional", {wrap<get_optional>, nullptr}},
     };
@@ -198,6 +218,9 @@ struct SetClass : ClassDefinition<T, realm::js::Set<T>, CollectionClass<T>> {
 
 private:
     static void validate_value(ContextType, realm::object_store::Set&, ValueType);
+    static std::vector<ValueType> validated_value_batch(ContextType, realm::object_store::Set&,
+                                                        ValueType array_value);
+    static std::vector<ValueType> operand_values(ContextType, realm::object_store::Set&, ValueType other_value);
 };
 
 template <typename T>
@@ -223,7 +246,29 @@ template <typename T>
 void SetClass<T>::get_size(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
     auto set = get_internal<T, SetClass<T>>(ctx, object);
-    return_value.set(static_cast<uint32_t>(set->size()));
+    return_value.set(static_cast<uint32_t>(set->m_size_cache.get(set->get_realm(), [&] {
+        return set->size();
+    })));
+}
+
+
+/**
+ * @brief Implements the `.version` property
+ *
+ *  Returns a monotonically increasing integer that advances whenever the
+ *  set's contents may have changed, so callers can detect change with an
+ *  integer compare instead of a listener. See \ref CollectionVersionTracker
+ *  for the exact semantics.
+ *
+ * @param ctx JS context
+ * @param object \ref ObjectType wrapping the SetClass itself
+ * @param return_value \ref ReturnValue wrapping the version counter to return to the JS context
+ */
+template <typename T>
+void SetClass<T>::get_version(ContextType ctx, ObjectType object, ReturnValue& return_value)
+{
+    auto set = get_internal<T, SetClass<T>>(ctx, object);
+    return_value.set(set->m_version_tracker.get(set->get_realm()));
 }
 
 
@@ -243,7 +288,7 @@ void SetClass<T>::get_indexed(ContextType ctx, ObjectType object, uint32_t index
 {
     auto set = get_internal<T, SetClass<T>>(ctx, object);
     NativeAccessor<T> accessor(ctx, *set);
-    return_value.set(set->get(accessor, index));
+    return_value.set_prewrapped(set->get(accessor, index));
 }
 
 
@@ -259,7 +304,7 @@ template <typename T>
 void SetClass<T>::get_optional(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
     auto set = get_internal<T, SetClass<T>>(ctx, object);
-    return_value.set(is_nullable(set->get_type()));
+    return_value.set_bool(is_nullable(set->get_type()));
 }
 
 
@@ -414,6 +459,293 @@ void SetClass<T>::has(ContextType ctx, ObjectType this_object, Arguments& args,
     return_value.set(index != npos);
 }
 
+/**
+ * @brief Adds every element of an array to the Set in one native call.
+ *
+ *  The element type is validated once for the whole batch and all inserts
+ *  share a single NativeAccessor, instead of paying one boundary crossing
+ *  and one validation per element as \ref add does.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the Set itself
+ * @param args \ref Arguments structure containing one array of values
+ * @param return_value \ref ReturnValue wrapping the Set itself
+ */
+template <typename T>
+void SetClass<T>::add_all(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(1);
+
+    auto set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto values = validated_value_batch(ctx, *set, args[0]);
+
+    NativeAccessor<T> accessor(ctx, *set);
+    for (auto const& value : values) {
+        set->insert(accessor, value);
+    }
+
+    return_value.set(this_object);
+}
+
+/**
+ * @brief Checks whether every element of an array is present in the Set.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the Set itself
+ * @param args \ref Arguments structure containing one array of values
+ * @param return_value \ref ReturnValue set to true if all elements are found
+ */
+template <typename T>
+void SetClass<T>::has_all(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(1);
+
+    auto set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto values = validated_value_batch(ctx, *set, args[0]);
+
+    NativeAccessor<T> accessor(ctx, *set);
+    for (auto const& value : values) {
+        if (set->find(accessor, value) == npos) {
+            return_value.set(false);
+            return;
+        }
+    }
+    return_value.set(true);
+}
+
+/**
+ * @brief Removes every element of an array from the Set in one native call.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the Set itself
+ * @param args \ref Arguments structure containing one array of values
+ * @param return_value \ref ReturnValue set to the number of elements removed
+ */
+template <typename T>
+void SetClass<T>::delete_all(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(1);
+
+    auto set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto values = validated_value_batch(ctx, *set, args[0]);
+
+    NativeAccessor<T> accessor(ctx, *set);
+    uint32_t removed = 0;
+    for (auto const& value : values) {
+        if (set->remove(accessor, value).second) {
+            removed++;
+        }
+    }
+    return_value.set(removed);
+}
+
+/**
+ * @brief Computes the union of the Set and another collection in one native call.
+ *
+ *  The result is returned as a plain array rather than a Set: the binding has
+ *  no wrapper for an unmanaged set, and a materialized array crosses the
+ *  JS/native boundary exactly once.  Membership tests run against the core
+ *  set's sorted storage, so no per-element comparison happens in JavaScript.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the Set itself
+ * @param args \ref Arguments structure containing another Set or an array of values
+ * @param return_value \ref ReturnValue wrapping an array holding the union
+ */
+template <typename T>
+void SetClass<T>::set_union(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(1);
+
+    auto set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto other_values = operand_values(ctx, *set, args[0]);
+
+    NativeAccessor<T> accessor(ctx, *set);
+    std::vector<ValueType> values;
+    values.reserve(set->size() + other_values.size());
+    for (size_t i = 0; i < set->size(); i++) {
+        values.push_back(set->get(accessor, i));
+    }
+    for (auto const& value : other_values) {
+        if (set->find(accessor, value) == npos) {
+            values.push_back(value);
+        }
+    }
+    return_value.set(Object::create_array(ctx, values));
+}
+
+/**
+ * @brief Computes the intersection of the Set and another collection in one native call.
+ *
+ *  Elements of the operand are resolved to positions in the Set natively, so
+ *  the result contains each common element exactly once even if the operand
+ *  array holds duplicates.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the Set itself
+ * @param args \ref Arguments structure containing another Set or an array of values
+ * @param return_value \ref ReturnValue wrapping an array holding the intersection
+ */
+template <typename T>
+void SetClass<T>::set_intersection(ContextType ctx, ObjectType this_object, Arguments& args,
+                                   ReturnValue& return_value)
+{
+    args.validate_maximum(1);
+
+    auto set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto other_values = operand_values(ctx, *set, args[0]);
+
+    NativeAccessor<T> accessor(ctx, *set);
+    std::set<size_t> matched;
+    for (auto const& value : other_values) {
+        size_t index = set->find(accessor, value);
+        if (index != npos) {
+            matched.insert(index);
+        }
+    }
+
+    std::vector<ValueType> values;
+    values.reserve(matched.size());
+    for (size_t index : matched) {
+        values.push_back(set->get(accessor, index));
+    }
+    return_value.set(Object::create_array(ctx, values));
+}
+
+/**
+ * @brief Computes the difference of the Set and another collection in one native call.
+ *
+ *  Returns the elements of the Set that are not present in the operand, as a
+ *  plain array.  Like \ref set_intersection, operand elements are resolved to
+ *  Set positions natively instead of comparing values in JavaScript.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the Set itself
+ * @param args \ref Arguments structure containing another Set or an array of values
+ * @param return_value \ref ReturnValue wrapping an array holding the difference
+ */
+template <typename T>
+void SetClass<T>::set_difference(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(1);
+
+    auto set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto other_values = operand_values(ctx, *set, args[0]);
+
+    NativeAccessor<T> accessor(ctx, *set);
+    std::set<size_t> matched;
+    for (auto const& value : other_values) {
+        size_t index = set->find(accessor, value);
+        if (index != npos) {
+            matched.insert(index);
+        }
+    }
+
+    std::vector<ValueType> values;
+    values.reserve(set->size() - matched.size());
+    for (size_t i = 0; i < set->size(); i++) {
+        if (matched.count(i) == 0) {
+            values.push_back(set->get(accessor, i));
+        }
+    }
+    return_value.set(Object::create_array(ctx, values));
+}
+
+/**
+ * @brief Checks whether every element of the Set is present in another collection.
+ *
+ *  The Set is a subset of the operand exactly when the operand's elements
+ *  cover every position of the Set, which is established with one native
+ *  lookup per operand element.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the Set itself
+ * @param args \ref Arguments structure containing another Set or an array of values
+ * @param return_value \ref ReturnValue set to true if the Set is a subset of the operand
+ */
+template <typename T>
+void SetClass<T>::is_subset_of(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
+{
+    args.validate_maximum(1);
+
+    auto set = get_internal<T, SetClass<T>>(ctx, this_object);
+    auto other_values = operand_values(ctx, *set, args[0]);
+
+    if (set->size() > other_values.size()) {
+        return_value.set(false);
+        return;
+    }
+
+    NativeAccessor<T> accessor(ctx, *set);
+    std::set<size_t> matched;
+    for (auto const& value : other_values) {
+        size_t index = set->find(accessor, value);
+        if (index != npos) {
+            matched.insert(index);
+        }
+    }
+    return_value.set(matched.size() == set->size());
+}
+
+template <typename T>
+std::vector<typename T::Value> SetClass<T>::operand_values(ContextType ctx, realm::object_store::Set& set,
+                                                           ValueType other_value)
+{
+    if (Value::is_object(ctx, other_value)) {
+        ObjectType other_object = Value::to_object(ctx, other_value);
+        if (Object::template is_instance<SetClass<T>>(ctx, other_object)) {
+            auto other = get_internal<T, SetClass<T>>(ctx, other_object);
+            if (other->get_type() != set.get_type() ||
+                (set.get_type() == realm::PropertyType::Object &&
+                 other->get_object_schema().name != set.get_object_schema().name)) {
+                std::string expected = set.get_type() == realm::PropertyType::Object
+                                           ? set.get_object_schema().name
+                                           : local_string_for_property_type(set.get_type());
+                std::string actual = other->get_type() == realm::PropertyType::Object
+                                         ? other->get_object_schema().name
+                                         : local_string_for_property_type(other->get_type());
+                throw TypeErrorException("Set", expected, actual);
+            }
+            NativeAccessor<T> accessor(ctx, *other);
+            std::vector<ValueType> values;
+            values.reserve(other->size());
+            for (size_t i = 0; i < other->size(); i++) {
+                values.push_back(other->get(accessor, i));
+            }
+            return values;
+        }
+    }
+    return validated_value_batch(ctx, set, other_value);
+}
+
+template <typename T>
+std::vector<typename T::Value> SetClass<T>::validated_value_batch(ContextType ctx, realm::object_store::Set& set,
+                                                                  ValueType array_value)
+{
+    ObjectType array = Value::validated_to_array(ctx, array_value, "values");
+    size_t count = Object::validated_get_length(ctx, array);
+
+    // The element type and object schema are resolved once for the whole
+    // batch rather than per element as validate_value does.
+    auto type = set.get_type();
+    StringData object_type;
+    if (type == realm::PropertyType::Object) {
+        object_type = set.get_object_schema().name;
+    }
+
+    std::vector<ValueType> values;
+    values.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        ValueType value = Object::validated_get_property(ctx, array, (uint32_t)i);
+        if (!Value::is_valid_for_property_type(ctx, value, type, object_type)) {
+            throw TypeErrorException("Property", object_type ? object_type : local_string_for_property_type(type),
+                                     Value::to_string(ctx, value));
+        }
+        values.push_back(value);
+    }
+    return values;
+}
+
 
 /**
  * @brief Creates a \ref ResultClass containing a subset of the set's elements
@@ -447,7 +779,7 @@ template <typename T>
 void SetClass<T>::get_type(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
     auto const set = get_internal<T, ListClass<T>>(ctx, object);
-    return_value.set(local_string_for_property_type(set->get_type() & ~realm::PropertyType::Flags));
+    return_value.set_string_view(local_string_for_property_type(set->get_type() & ~realm::PropertyType::Flags));
 }
 
 
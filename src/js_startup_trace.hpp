@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2022 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace realm::js::startup {
+
+/// One timed startup phase. `start` is on the steady clock; report it
+/// relative to `Trace::origin()` to get milliseconds since the module was
+/// first touched.
+struct Phase {
+    const char* name;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::nanoseconds duration;
+};
+
+/**
+ * @brief Always-on record of where cold-start time goes, exposed to JS as
+ * `Realm._startupTrace`.
+ * Each instrumented phase (module init, class init, schema parse, sync
+ * config population, file open) costs two clock reads and a mutex push —
+ * cheap enough to stay enabled in production. Recurring phases (a schema
+ * parse per open, say) get one entry per occurrence; recording stops after
+ * a fixed cap so a long-lived process that keeps opening Realms does not
+ * grow the trace without bound.
+ */
+class Trace {
+public:
+    // Function-local static rather than a namespace-scope object: this header
+    // is included from multiple translation units and must not depend on
+    // initialization order. The origin is anchored the first time anything
+    // touches the trace, which is the module-init timer.
+    static Trace& shared()
+    {
+        static Trace s_trace;
+        return s_trace;
+    }
+
+    std::chrono::steady_clock::time_point origin() const
+    {
+        return m_origin;
+    }
+
+    void record(const char* name, std::chrono::steady_clock::time_point start,
+                std::chrono::steady_clock::time_point end)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_phases.size() >= s_max_phases) {
+            return;
+        }
+        m_phases.push_back({name, start, end - start});
+    }
+
+    std::vector<Phase> snapshot()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_phases;
+    }
+
+private:
+    Trace()
+        : m_origin(std::chrono::steady_clock::now())
+    {
+    }
+
+    static constexpr size_t s_max_phases = 64;
+
+    const std::chrono::steady_clock::time_point m_origin;
+    std::mutex m_mutex;
+    std::vector<Phase> m_phases;
+};
+
+/// Times a scope and records it as a phase on destruction. `name` must be a
+/// string literal; the trace keeps the pointer.
+class PhaseTimer {
+public:
+    explicit PhaseTimer(const char* name)
+        : m_name(name)
+    {
+        Trace::shared(); // anchor the origin before the phase starts
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    ~PhaseTimer()
+    {
+        Trace::shared().record(m_name, m_start, std::chrono::steady_clock::now());
+    }
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    const char* m_name;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace realm::js::startup
@@ -205,6 +205,13 @@ public:
     // Hold a weak_ptr to the Realm associated with the subscription set so that we
     // can pass it to the `update` callback
     std::weak_ptr<Realm> realm;
+
+    // All waitForSynchronization calls pending on this wrapper share a single
+    // native state watcher: the first wait registers the core notification
+    // and later waits just queue their callback here, to be resolved in one
+    // batch when the target state is reached.
+    std::vector<Protected<typename T::Function>> pending_wait_callbacks;
+    bool wait_watcher_registered = false;
 };
 
 /**
@@ -244,6 +251,7 @@ public:
     static void find_by_name(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void find_by_query(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void update(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void update_batch(ContextType, ObjectType, Arguments&, ReturnValue&);
     // This is public because it is called from js_realm::handle_initial_subscriptions
     static realm::sync::SubscriptionSet update_impl(ContextType, FunctionType, realm::sync::SubscriptionSet,
                                                     SharedRealm);
@@ -253,6 +261,7 @@ public:
         {"findByName", wrap<find_by_name>},
         {"findByQuery", wrap<find_by_query>},
         {"_update", wrap<update>},
+        {"_updateBatch", wrap<update_batch>},
         {"_waitForSynchronization", wrap<wait_for_synchronization>},
     };
 
@@ -489,6 +498,15 @@ void SubscriptionSetClass<T>::wait_for_synchronization_impl(ContextType ctx, Obj
 
     auto subs = get_internal<T, SubscriptionSetClass<T>>(protected_ctx, protected_this);
 
+    // All waits pending on this wrapper are multiplexed over one native state
+    // watcher: the first wait registers the core notification, later waits
+    // just queue their callback, and the whole batch is resolved in a single
+    // JS entry (and a single refresh) once the target state is reached.
+    subs->pending_wait_callbacks.push_back(protected_callback);
+    if (subs->wait_watcher_registered) {
+        return;
+    }
+
     // Hold a weak_ptr to the SyncSession, so we can check if it still exists when our callback fires
     // – if the Realm has gone out of scope and been garbage collected by the time the callback fires
     // (which happens in tests), we get a crash otherwise
@@ -500,20 +518,28 @@ void SubscriptionSetClass<T>::wait_for_synchronization_impl(ContextType ctx, Obj
         [=](StatusWith<realm::sync::SubscriptionSet::State> state) {
             HANDLESCOPE(protected_ctx)
 
-            // If the SyncSession has already closed, don't do anything as we will crash
+            auto current_subs = get_internal<T, SubscriptionSetClass<T>>(protected_ctx, protected_this);
+            auto callbacks = std::move(current_subs->pending_wait_callbacks);
+            current_subs->pending_wait_callbacks.clear();
+            current_subs->wait_watcher_registered = false;
+
+            // If the SyncSession has already closed, don't refresh as we will crash
             if (sync_session.lock()) {
-                auto current_subs = get_internal<T, SubscriptionSetClass<T>>(protected_ctx, protected_this);
                 current_subs->refresh();
 
                 auto result = state.is_ok() ? Value::from_undefined(protected_ctx)
                                             : Object::create_error(protected_ctx, state.get_status().reason());
 
-                Function<T>::callback(protected_ctx, protected_callback, protected_this, {result});
+                for (auto& callback : callbacks) {
+                    Function<T>::callback(protected_ctx, callback, protected_this, {result});
+                }
             }
             else {
                 auto error = Object::create_error(
                     protected_ctx, "`waitForSynchronisation` resolved after the `subscriptions` went out of scope");
-                Function<T>::callback(protected_ctx, protected_callback, protected_this, {error});
+                for (auto& callback : callbacks) {
+                    Function<T>::callback(protected_ctx, callback, protected_this, {error});
+                }
             }
         });
 
@@ -522,12 +548,17 @@ void SubscriptionSetClass<T>::wait_for_synchronization_impl(ContextType ctx, Obj
     try {
         subs->get_state_change_notification(realm::sync::SubscriptionSet::State::Complete)
             .get_async(state_change_func);
+        subs->wait_watcher_registered = true;
     }
     catch (KeyNotFound const& ex) {
         // TODO Waiting on https://github.com/realm/realm-core/issues/5165 to remove this
+        auto callbacks = std::move(subs->pending_wait_callbacks);
+        subs->pending_wait_callbacks.clear();
         auto error = Object::create_error(
             ctx, "`waitForSynchronisation` cannot be called before creating a SubscriptionSet using `update`");
-        Function<T>::callback(protected_ctx, protected_callback, protected_this, {error});
+        for (auto& callback : callbacks) {
+            Function<T>::callback(protected_ctx, callback, protected_this, {error});
+        }
     }
 }
 
@@ -655,6 +686,135 @@ void SubscriptionSetClass<T>::update(ContextType ctx, ObjectType this_object, Ar
     }
 }
 
+/**
+ * @brief Apply a batch of subscription changes in one commit, then wait for
+ * synchronization once. Staging all changes from a single array of descriptors
+ * produces one new subscription-set version (one server round trip) however
+ * many subscriptions are touched, where per-change `update` calls would
+ * produce one version each.
+ *
+ * @param ctx JS context
+ * @param this_object \ref ObjectType wrapping the SubscriptionSet
+ * @param args \ref Arguments structure:
+ *   - Argument 1: An array of descriptor objects, each one of:
+ *     - `{query, name?, throwOnUpdate?}`: add a subscription for the query
+ *       (a Results instance), with the same semantics as `add`
+ *     - `{removeByName}`: remove the subscription with the given name
+ *     - `{remove}`: remove the subscription matching the query (a Results instance)
+ *   - Argument 2: A callback to be called when the state of the SubscriptionSet
+ *     is "Complete" or "Error" after the batch has been applied (see
+ *     `wait_for_synchronization_impl`).
+ * @param return_value \ref ReturnValue wrapping an array of Subscription
+ * instances for the added subscriptions, in descriptor order
+ * @exception std::runtime_error Thrown if a descriptor is malformed or a
+ * `throwOnUpdate` check fails; in that case no changes are committed
+ */
+template <typename T>
+void SubscriptionSetClass<T>::update_batch(ContextType ctx, ObjectType this_object, Arguments& args,
+                                           ReturnValue& return_value)
+{
+    args.validate_count(2);
+
+    ObjectType descriptors = Value::validated_to_array(ctx, args[0], "descriptors");
+    FunctionType completion_callback = Value::validated_to_function(ctx, args[1], "completion callback");
+
+    Protected<FunctionType> protected_completion_callback(ctx, completion_callback);
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<typename T::GlobalContext> protected_ctx(js::Context<T>::get_global_context(ctx));
+
+    auto subs = get_internal<T, SubscriptionSetClass<T>>(ctx, this_object);
+
+    if (!subs->realm.lock()) {
+        auto error = Object::create_error(protected_ctx, "`updateBatch` called after the Realm went out of scope");
+        Function<T>::callback(protected_ctx, protected_completion_callback, protected_this, {error});
+        return;
+    }
+
+    auto mutable_subs = subs->make_mutable_copy();
+
+    uint32_t count = Object::validated_get_length(ctx, descriptors);
+    auto added = Object::create_array(ctx);
+    uint32_t added_count = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        ObjectType descriptor =
+            Value::validated_to_object(ctx, Object::get_property(ctx, descriptors, i), "descriptor");
+
+        ValueType remove_by_name_value = Object::get_property(ctx, descriptor, "removeByName");
+        if (!Value::is_undefined(ctx, remove_by_name_value)) {
+            std::string name = Value::validated_to_string(ctx, remove_by_name_value, "removeByName");
+            if (auto it = mutable_subs.find(name); it != mutable_subs.end()) {
+                mutable_subs.erase(it);
+            }
+            continue;
+        }
+
+        ValueType remove_value = Object::get_property(ctx, descriptor, "remove");
+        if (!Value::is_undefined(ctx, remove_value)) {
+            auto results_arg = Value::validated_to_object(ctx, remove_value, "remove");
+            if (!Object::template is_instance<ResultsClass<T>>(ctx, results_arg)) {
+                throw std::runtime_error("'remove' in a batch descriptor must be a collection of Realm objects.");
+            }
+            auto query = get_internal<T, ResultsClass<T>>(ctx, results_arg)->get_query();
+            if (auto it = mutable_subs.find(query); it != mutable_subs.end()) {
+                mutable_subs.erase(it);
+            }
+            continue;
+        }
+
+        ValueType query_value = Object::get_property(ctx, descriptor, "query");
+        if (Value::is_undefined(ctx, query_value)) {
+            throw std::runtime_error(
+                "A batch descriptor must have a 'query', 'remove' or 'removeByName' property.");
+        }
+
+        auto results_arg = Value::validated_to_object(ctx, query_value, "query");
+        if (!Object::template is_instance<ResultsClass<T>>(ctx, results_arg)) {
+            throw std::runtime_error("'query' in a batch descriptor must be a collection of Realm objects.");
+        }
+        auto results = get_internal<T, ResultsClass<T>>(ctx, results_arg);
+        auto query = results->get_query();
+
+        auto name_specified = false;
+        std::string name;
+        ValueType name_value = Object::get_property(ctx, descriptor, "name");
+        if (!Value::is_undefined(ctx, name_value)) {
+            name = Value::validated_to_string(ctx, name_value, "name");
+            name_specified = true;
+        }
+
+        ValueType throw_on_update_value = Object::get_property(ctx, descriptor, "throwOnUpdate");
+        if (name_specified && Value::is_boolean(ctx, throw_on_update_value) &&
+            Value::to_boolean(ctx, throw_on_update_value)) {
+            auto existing_sub_it = mutable_subs.find(name);
+            if (existing_sub_it != mutable_subs.end() &&
+                !(existing_sub_it->query_string() == query.get_description() &&
+                  existing_sub_it->object_class_name() == results->get_object_type())) {
+                throw std::runtime_error(
+                    util::format("A subscription with the name '%1' already exists but has a different query. If you "
+                                 "meant to update it, remove `throwOnUpdate: true` from the subscription options.",
+                                 name));
+            }
+        }
+
+        auto&& [it, result] =
+            name_specified ? mutable_subs.insert_or_assign(name, query) : mutable_subs.insert_or_assign(query);
+        Object::set_property(ctx, added, added_count++, SubscriptionClass<T>::create_instance(ctx, *it));
+    }
+
+    auto new_sub_set = std::move(mutable_subs).commit();
+
+    // Update this SubscriptionSetClass instance to point to the updated version
+    set_internal<T, SubscriptionSetClass<T>>(
+        ctx, this_object, new SubscriptionSet<T>(std::move(new_sub_set), subs->sync_session, subs->realm));
+
+    // Asynchronously wait for the SubscriptionSet to be synchronised
+    SubscriptionSetClass<T>::wait_for_synchronization_impl(protected_ctx, protected_this,
+                                                           protected_completion_callback);
+
+    return_value.set(added);
+}
+
 /**
  * @brief Perform updates to a SubscriptionSet in a callback, and return the
  * updated SubscriptionSet.
@@ -27,6 +27,8 @@
 #include "js_app.hpp"
 #include "js_user.hpp"
 #include "js_subscriptions.hpp"
+#include "js_dispatch_batcher.hpp"
+#include "js_startup_trace.hpp"
 #include "logger.hpp"
 
 #include "platform.hpp"
@@ -35,6 +37,9 @@
 #include <realm/sync/config.hpp>
 #include <realm/sync/protocol.hpp>
 #include <realm/sync/client_base.hpp>
+#include <realm/sync/changeset.hpp>
+#include <realm/sync/changeset_parser.hpp>
+#include <realm/util/input_stream.hpp>
 #include <realm/object-store/sync/sync_manager.hpp>
 #include <realm/object-store/sync/sync_session.hpp>
 #include <realm/object-store/sync/sync_user.hpp>
@@ -58,7 +63,13 @@
 extern jclass ssl_helper_class;
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <mutex>
+#include <set>
+#include <thread>
+#include <tuple>
 #include <condition_variable>
 
 namespace realm {
@@ -110,6 +121,87 @@ static std::string partition_value_bson_to_string(typename T::Context ctx, typen
 
 using WeakSession = std::weak_ptr<realm::SyncSession>;
 
+// Binding-maintained transfer counters per session, fed by streaming
+// progress notifiers registered directly with the sync client. The notifier
+// callbacks run on the sync client's thread and only store into atomics; the
+// JS thread is not involved until someone boxes a snapshot. Tracking starts
+// the first time a session's stats are requested and entries are pruned when
+// their session goes away.
+struct SessionTransferStats {
+    std::weak_ptr<SyncSession> session;
+    std::atomic<uint64_t> uploaded{0};
+    std::atomic<uint64_t> uploadable{0};
+    std::atomic<uint64_t> downloaded{0};
+    std::atomic<uint64_t> downloadable{0};
+};
+
+inline std::shared_ptr<SessionTransferStats> transfer_stats_for_session(std::shared_ptr<SyncSession> const& session)
+{
+    static std::mutex s_mutex;
+    static std::map<SyncSession*, std::shared_ptr<SessionTransferStats>> s_stats;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (auto it = s_stats.begin(); it != s_stats.end();) {
+        it = it->second->session.expired() ? s_stats.erase(it) : std::next(it);
+    }
+
+    auto& entry = s_stats[session.get()];
+    if (!entry) {
+        entry = std::make_shared<SessionTransferStats>();
+        entry->session = session;
+        auto stats = entry;
+        // Streaming notifiers live as long as the session; the shared_ptr
+        // keeps the counters alive for as long as either side needs them.
+        session->register_progress_notifier(
+            [stats](uint64_t transferred, uint64_t transferrable) {
+                stats->uploaded.store(transferred, std::memory_order_relaxed);
+                stats->uploadable.store(transferrable, std::memory_order_relaxed);
+            },
+            SyncSession::ProgressDirection::upload, true);
+        session->register_progress_notifier(
+            [stats](uint64_t transferred, uint64_t transferrable) {
+                stats->downloaded.store(transferred, std::memory_order_relaxed);
+                stats->downloadable.store(transferrable, std::memory_order_relaxed);
+            },
+            SyncSession::ProgressDirection::download, true);
+    }
+    return entry;
+}
+
+// Pending upload/download completion waiters for one session, multiplexed
+// onto a single native wait per direction. Bursts of parallel waits on the
+// same session (e.g. one upload wait per user action in a save flow) cost a
+// list node each instead of a native callback registration each, and all
+// waiters covered by one native wait resolve in a single JS entry. Waiters
+// that queue while a wait is already in flight form the next generation: the
+// in-flight wait may target an older version than theirs, so they get a
+// fresh native wait registered once the current one completes. Everything
+// here runs on the session's JS thread, so no locking is needed.
+template <typename T>
+struct SessionCompletionWaiters {
+    // Indexed by SessionClass<T>::Direction (0 = upload, 1 = download).
+    bool in_flight[2] = {false, false};
+    std::vector<Protected<typename T::Function>> pending[2];
+};
+
+template <typename T>
+inline std::shared_ptr<SessionCompletionWaiters<T>> completion_waiters_for_session(SyncSession* session)
+{
+    static thread_local std::map<SyncSession*, std::weak_ptr<SessionCompletionWaiters<T>>> s_waiters;
+
+    for (auto it = s_waiters.begin(); it != s_waiters.end();) {
+        it = it->second.expired() ? s_waiters.erase(it) : std::next(it);
+    }
+
+    auto& entry = s_waiters[session];
+    auto waiters = entry.lock();
+    if (!waiters) {
+        waiters = std::make_shared<SessionCompletionWaiters<T>>();
+        entry = waiters;
+    }
+    return waiters;
+}
+
 template <typename T>
 class SessionClass : public ClassDefinition<T, WeakSession> {
     using ContextType = typename T::Context;
@@ -144,6 +236,7 @@ public:
     static void add_connection_notification(ContextType ctx, ObjectType this_object, Arguments&, ReturnValue&);
     static void remove_connection_notification(ContextType ctx, ObjectType this_object, Arguments&, ReturnValue&);
     static void is_connected(ContextType ctx, ObjectType this_object, Arguments&, ReturnValue&);
+    static void get_stats(ContextType ctx, ObjectType this_object, Arguments&, ReturnValue&);
     static void resume(ContextType ctx, ObjectType this_object, Arguments&, ReturnValue&);
     static void pause(ContextType ctx, ObjectType this_object, Arguments&, ReturnValue&);
     //    static void override_server(ContextType, ObjectType, Arguments &, ReturnValue &);
@@ -168,6 +261,7 @@ public:
         {"addConnectionNotification", wrap<add_connection_notification>},
         {"removeConnectionNotification", wrap<remove_connection_notification>},
         {"isConnected", wrap<is_connected>},
+        {"stats", wrap<get_stats>},
         {"resume", wrap<resume>},
         {"pause", wrap<pause>},
     };
@@ -176,6 +270,9 @@ private:
     enum Direction { Upload, Download };
     static std::string get_connection_state_value(SyncSession::ConnectionState state);
     static void wait_for_completion(Direction direction, ContextType ctx, ObjectType this_object, Arguments& args);
+    static void register_completion_wait(Direction direction, ContextType ctx,
+                                         std::shared_ptr<SyncSession> const& session,
+                                         std::shared_ptr<SessionCompletionWaiters<T>> const& waiters);
 };
 
 template <typename T>
@@ -199,9 +296,15 @@ public:
         SharedRealm after_realm =
             Realm::get_shared_realm(std::move(after_realm_ref), util::Scheduler::make_default());
 
+        // The pre-reset state is handed over as a version-pinned frozen view:
+        // it skips scheduler integration and notification setup, which is
+        // pure overhead for a Realm the callback can only read from while
+        // sync is stalled waiting on it. The post-reset Realm stays live so
+        // recovery callbacks can write recovered data into it.
+        SharedRealm before_frozen = before_realm->is_frozen() ? before_realm : before_realm->freeze();
 
         typename T::Value arguments[] = {
-            create_object<T, RealmClass<T>>(m_ctx, new SharedRealm(before_realm)),
+            create_object<T, RealmClass<T>>(m_ctx, new SharedRealm(before_frozen)),
             create_object<T, RealmClass<T>>(m_ctx, new SharedRealm(after_realm)),
         };
         Function<T>::callback(m_ctx, m_func, 2, arguments);
@@ -230,10 +333,17 @@ public:
     {
         HANDLESCOPE(m_ctx)
 
+        // Hand the callback a version-pinned frozen view instead of the live
+        // instance; the local state is read-only at this point anyway and the
+        // frozen view avoids a second full Realm open (scheduler binding,
+        // auto-refresh, notification machinery) while sync is stalled.
+        SharedRealm frozen_realm = local_realm->is_frozen() ? local_realm : local_realm->freeze();
+
         typename T::Value arguments[] = {
-            create_object<T, RealmClass<T>>(m_ctx, new SharedRealm(local_realm)),
+            create_object<T, RealmClass<T>>(m_ctx, new SharedRealm(frozen_realm)),
         };
         Function<T>::callback(m_ctx, m_func, 1, arguments);
+        frozen_realm->close();
         local_realm->close();
     }
 
@@ -317,6 +427,7 @@ public:
         , m_event_loop_dispatcher{SSLVerifyCallbackSyncThreadFunctor<T>::main_loop_handler}
         , m_mutex{new std::mutex}
         , m_cond_var{new std::condition_variable}
+        , m_verdict_cache{new VerdictCache}
     {
     }
 
@@ -325,6 +436,25 @@ public:
                     const char* pem_data, size_t pem_size, int preverify_ok, int depth)
     {
         const std::string pem_certificate{pem_data, pem_size};
+
+        // The same certificate chain is presented on every (re)connection, and
+        // each certificate in it blocks the sync thread on a round-trip to the
+        // JS thread. Remember recent verdicts per (host, port, certificate,
+        // depth) so reconnects don't re-dispatch; the TTL bounds how long a
+        // changed callback decision takes to be picked up.
+        VerdictKey key{server_address, server_port, pem_certificate, depth};
+        {
+            std::lock_guard<std::mutex> lock{m_verdict_cache->mutex};
+            auto now = std::chrono::steady_clock::now();
+            auto it = m_verdict_cache->entries.find(key);
+            if (it != m_verdict_cache->entries.end()) {
+                if (now < it->second.expires) {
+                    return it->second.accepted;
+                }
+                m_verdict_cache->entries.erase(it);
+            }
+        }
+
         {
             std::lock_guard<std::mutex> lock{*m_mutex};
             m_ssl_certificate_callback_done = false;
@@ -344,6 +474,15 @@ public:
             ssl_certificate_accepted = m_ssl_certificate_accepted;
         }
 
+        {
+            std::lock_guard<std::mutex> lock{m_verdict_cache->mutex};
+            if (m_verdict_cache->entries.size() >= s_verdict_cache_max_size) {
+                m_verdict_cache->entries.clear();
+            }
+            m_verdict_cache->entries[std::move(key)] = {
+                ssl_certificate_accepted, std::chrono::steady_clock::now() + s_verdict_ttl};
+        }
+
         return ssl_certificate_accepted;
     }
 
@@ -387,14 +526,28 @@ public:
 private:
     const Protected<typename T::GlobalContext> m_ctx;
     const Protected<typename T::Function> m_func;
-    util::EventLoopDispatcher<void(SSLVerifyCallbackSyncThreadFunctor<T>* this_object,
-                                   const std::string& server_address, util::network::Endpoint::port_type server_port,
-                                   const std::string& pem_certificate, int preverify_ok, int depth)>
+    BatchedEventLoopDispatcher<void(SSLVerifyCallbackSyncThreadFunctor<T>* this_object,
+                                    const std::string& server_address, util::network::Endpoint::port_type server_port,
+                                    const std::string& pem_certificate, int preverify_ok, int depth)>
         m_event_loop_dispatcher;
     bool m_ssl_certificate_callback_done = false;
     bool m_ssl_certificate_accepted = false;
     std::shared_ptr<std::mutex> m_mutex;
     std::shared_ptr<std::condition_variable> m_cond_var;
+
+    using VerdictKey = std::tuple<std::string, util::network::Endpoint::port_type, std::string, int>;
+    struct VerdictEntry {
+        bool accepted = false;
+        std::chrono::steady_clock::time_point expires;
+    };
+    // Shared between copies of the functor, like the handshake state above.
+    struct VerdictCache {
+        std::mutex mutex;
+        std::map<VerdictKey, VerdictEntry> entries;
+    };
+    std::shared_ptr<VerdictCache> m_verdict_cache;
+    static constexpr auto s_verdict_ttl = std::chrono::minutes(10);
+    static constexpr size_t s_verdict_cache_max_size = 64;
 };
 
 // TODO: We should move this function to js_user.hpp but hard due to circular dependency
@@ -440,7 +593,7 @@ void SessionClass<T>::get_config(ContextType ctx, ObjectType object, ReturnValue
 
         auto conf = session->config();
         if (auto dispatcher =
-                conf.error_handler.template target<util::EventLoopDispatcher<SyncSessionErrorHandler>>()) {
+                conf.error_handler.template target<BatchedEventLoopDispatcher<SyncSessionErrorHandler>>()) {
             if (auto handler = dispatcher->func().template target<SyncSessionErrorHandlerFunctor<T>>()) {
                 Object::set_property(ctx, config, "error", handler->func());
             }
@@ -541,7 +694,7 @@ template <typename T>
 void SessionClass<T>::add_progress_notification(ContextType ctx, ObjectType this_object, Arguments& args,
                                                 ReturnValue& return_value)
 {
-    args.validate_count(3);
+    args.validate_between(3, 4);
 
     if (auto session = get_internal<T, SessionClass<T>>(ctx, this_object)->lock()) {
 
@@ -573,12 +726,37 @@ void SessionClass<T>::add_progress_notification(ContextType ctx, ObjectType this
 
         auto callback_function = Value::validated_to_function(ctx, args[2], "callback");
 
+        // Optional throttling: a number is the minimum number of milliseconds
+        // between deliveries, an object may set `minIntervalMs` and
+        // `minDeltaBytes`. Progress is filtered on the sync client's thread so
+        // a large download doesn't wake the JS thread for every protocol
+        // message. Terminal updates (transferred == transferrable) are always
+        // delivered.
+        double min_interval_ms = 0;
+        double min_delta_bytes = 0;
+        if (args.count == 4 && !Value::is_undefined(ctx, args[3])) {
+            if (Value::is_number(ctx, args[3])) {
+                min_interval_ms = Value::validated_to_number(ctx, args[3], "options");
+            }
+            else {
+                ObjectType options = Value::validated_to_object(ctx, args[3], "options");
+                ValueType interval_value = Object::get_property(ctx, options, "minIntervalMs");
+                if (!Value::is_undefined(ctx, interval_value)) {
+                    min_interval_ms = Value::validated_to_number(ctx, interval_value, "minIntervalMs");
+                }
+                ValueType delta_value = Object::get_property(ctx, options, "minDeltaBytes");
+                if (!Value::is_undefined(ctx, delta_value)) {
+                    min_delta_bytes = Value::validated_to_number(ctx, delta_value, "minDeltaBytes");
+                }
+            }
+        }
+
         Protected<FunctionType> protected_callback(ctx, callback_function);
         Protected<ObjectType> protected_this(ctx, this_object);
         Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
         std::function<ProgressHandler> progressFunc;
 
-        util::EventLoopDispatcher<ProgressHandler> progress_handler(
+        BatchedEventLoopDispatcher<ProgressHandler> progress_handler(
             [=](uint64_t transferred_bytes, uint64_t transferrable_bytes) {
                 HANDLESCOPE(protected_ctx)
                 ValueType callback_arguments[2] = {
@@ -591,6 +769,35 @@ void SessionClass<T>::add_progress_notification(ContextType ctx, ObjectType this
 
         progressFunc = std::move(progress_handler);
 
+        if (min_interval_ms > 0 || min_delta_bytes > 0) {
+            struct ThrottleState {
+                std::chrono::steady_clock::time_point last_delivery;
+                uint64_t last_transferred = 0;
+                bool delivered_any = false;
+            };
+            auto state = std::make_shared<ThrottleState>();
+            auto min_interval = std::chrono::milliseconds(static_cast<int64_t>(min_interval_ms));
+            auto min_delta = static_cast<uint64_t>(min_delta_bytes);
+            progressFunc = [state, min_interval, min_delta, handler = std::move(progressFunc)](
+                               uint64_t transferred_bytes, uint64_t transferrable_bytes) {
+                // Runs on the sync client's event loop thread; updates arrive
+                // serially so the state needs no locking.
+                bool complete = transferred_bytes >= transferrable_bytes;
+                if (state->delivered_any && !complete) {
+                    if (std::chrono::steady_clock::now() - state->last_delivery < min_interval) {
+                        return;
+                    }
+                    if (transferred_bytes - state->last_transferred < min_delta) {
+                        return;
+                    }
+                }
+                state->last_delivery = std::chrono::steady_clock::now();
+                state->last_transferred = transferred_bytes;
+                state->delivered_any = true;
+                handler(transferred_bytes, transferrable_bytes);
+            };
+        }
+
         auto registrationToken =
             session->register_progress_notifier(std::move(progressFunc), direction, is_streaming);
         auto syncSession = create_object<T, SessionClass<T>>(ctx, new WeakSession(session));
@@ -625,26 +832,140 @@ template <typename T>
 void SessionClass<T>::add_connection_notification(ContextType ctx, ObjectType this_object, Arguments& args,
                                                   ReturnValue& return_value)
 {
-    args.validate_count(1);
+    args.validate_maximum(2);
     if (auto session = get_internal<T, SessionClass<T>>(ctx, this_object)->lock()) {
         auto callback_function = Value::validated_to_function(ctx, args[0], "callback");
         Protected<FunctionType> protected_callback(ctx, callback_function);
         Protected<ObjectType> protected_this(ctx, this_object);
         Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
 
-        std::function<ConnectionHandler> connectionFunc;
+        // An optional second argument debounces flapping connections: state
+        // changes within the window collapse into one callback carrying the
+        // final state plus how many transitions it swallowed. A number is
+        // shorthand for `debounceMs`.
+        double debounce_ms = 0;
+        if (args.count == 2 && !Value::is_undefined(ctx, args[1])) {
+            if (Value::is_number(ctx, args[1])) {
+                debounce_ms = Value::validated_to_number(ctx, args[1], "options");
+            }
+            else {
+                ObjectType options = Value::validated_to_object(ctx, args[1], "options");
+                ValueType debounce_value = Object::get_property(ctx, options, "debounceMs");
+                if (!Value::is_undefined(ctx, debounce_value)) {
+                    debounce_ms = Value::validated_to_number(ctx, debounce_value, "debounceMs");
+                }
+            }
+        }
 
-        util::EventLoopDispatcher<ConnectionHandler> connection_handler(
-            [=](SyncSession::ConnectionState old_state, SyncSession::ConnectionState new_state) {
-                HANDLESCOPE(protected_ctx)
-                ValueType callback_arguments[2] = {
-                    Value::from_string(protected_ctx, get_connection_state_value(new_state)),
-                    Value::from_string(protected_ctx, get_connection_state_value(old_state)),
-                };
-                Function<T>::callback(protected_ctx, protected_callback, 2, callback_arguments);
-            });
+        std::function<ConnectionHandler> connectionFunc;
 
-        connectionFunc = std::move(connection_handler);
+        if (debounce_ms > 0) {
+            // JS delivery carries the collapsed transition count and the
+            // running epoch so status UI can show "unstable connection"
+            // without having processed each flap.
+            using DebouncedHandler = void(SyncSession::ConnectionState, SyncSession::ConnectionState, uint64_t,
+                                          uint64_t);
+            BatchedEventLoopDispatcher<DebouncedHandler> debounced_handler(
+                [=](SyncSession::ConnectionState old_state, SyncSession::ConnectionState new_state, uint64_t flaps,
+                    uint64_t epoch) {
+                    HANDLESCOPE(protected_ctx)
+                    ValueType callback_arguments[3] = {
+                        Value::from_string(protected_ctx, get_connection_state_value(new_state)),
+                        Value::from_string(protected_ctx, get_connection_state_value(old_state)),
+                        Object::create_obj(protected_ctx,
+                                           {
+                                               {"flapCount", Value::from_number(protected_ctx, double(flaps))},
+                                               {"epoch", Value::from_number(protected_ctx, double(epoch))},
+                                           }),
+                    };
+                    Function<T>::callback(protected_ctx, protected_callback, 3, callback_arguments);
+                });
+
+            struct DebounceState {
+                // Transitions arrive on the sync client's thread; the mutex
+                // orders them against the trailing flush thread only, so
+                // contention is nil.
+                std::mutex mutex;
+                std::chrono::steady_clock::time_point last_delivery;
+                bool delivered_any = false;
+                uint64_t epoch = 0;
+                uint64_t flaps_since_delivery = 0;
+                SyncSession::ConnectionState last_delivered = SyncSession::ConnectionState::Disconnected;
+                // Latest state swallowed inside the window, awaiting the
+                // trailing flush. Without it a burst that settles within the
+                // window (the usual startup Connecting→Connected) would never
+                // report its final state.
+                bool has_pending = false;
+                bool flush_armed = false;
+                SyncSession::ConnectionState pending_state = SyncSession::ConnectionState::Disconnected;
+            };
+            auto state = std::make_shared<DebounceState>();
+            auto window = std::chrono::milliseconds(static_cast<int64_t>(debounce_ms));
+            connectionFunc = [state, window, handler = std::move(debounced_handler)](
+                                 SyncSession::ConnectionState old_state, SyncSession::ConnectionState new_state) {
+                std::unique_lock<std::mutex> lock(state->mutex);
+                state->epoch++;
+                auto now = std::chrono::steady_clock::now();
+                if (state->delivered_any && now - state->last_delivery < window) {
+                    // Swallowed; remember the settled state and make sure a
+                    // trailing flush delivers it when the window expires, in
+                    // case no further transition arrives to carry it out.
+                    state->flaps_since_delivery++;
+                    state->has_pending = true;
+                    state->pending_state = new_state;
+                    if (!state->flush_armed) {
+                        state->flush_armed = true;
+                        auto deadline = state->last_delivery + window;
+                        lock.unlock();
+                        // Nothing here exposes an event-loop timer, so a
+                        // short-lived thread sleeps out the window and
+                        // re-dispatches onto the JS thread.
+                        std::thread([state, deadline, handler] {
+                            std::this_thread::sleep_until(deadline);
+                            std::unique_lock<std::mutex> lock(state->mutex);
+                            state->flush_armed = false;
+                            if (!state->has_pending) {
+                                return; // a transition past the window already delivered it
+                            }
+                            auto from = state->last_delivered;
+                            auto to = state->pending_state;
+                            auto flaps = state->flaps_since_delivery;
+                            auto epoch = state->epoch;
+                            state->has_pending = false;
+                            state->flaps_since_delivery = 0;
+                            state->last_delivery = std::chrono::steady_clock::now();
+                            state->last_delivered = to;
+                            lock.unlock();
+                            handler(from, to, flaps, epoch);
+                        }).detach();
+                    }
+                    return;
+                }
+                auto from = state->delivered_any ? state->last_delivered : old_state;
+                auto flaps = state->flaps_since_delivery;
+                auto epoch = state->epoch;
+                state->has_pending = false; // this transition supersedes any pending flush
+                state->flaps_since_delivery = 0;
+                state->delivered_any = true;
+                state->last_delivery = now;
+                state->last_delivered = new_state;
+                lock.unlock();
+                handler(from, new_state, flaps, epoch);
+            };
+        }
+        else {
+            BatchedEventLoopDispatcher<ConnectionHandler> connection_handler(
+                [=](SyncSession::ConnectionState old_state, SyncSession::ConnectionState new_state) {
+                    HANDLESCOPE(protected_ctx)
+                    ValueType callback_arguments[2] = {
+                        Value::from_string(protected_ctx, get_connection_state_value(new_state)),
+                        Value::from_string(protected_ctx, get_connection_state_value(old_state)),
+                    };
+                    Function<T>::callback(protected_ctx, protected_callback, 2, callback_arguments);
+                });
+
+            connectionFunc = std::move(connection_handler);
+        }
 
         auto notificationToken = session->register_connection_change_callback(std::move(connectionFunc));
         auto syncSession = create_object<T, SessionClass<T>>(ctx, new WeakSession(session));
@@ -690,6 +1011,33 @@ void SessionClass<T>::is_connected(ContextType ctx, ObjectType this_object, Argu
     }
 }
 
+template <typename T>
+void SessionClass<T>::get_stats(ContextType ctx, ObjectType this_object, Arguments& args,
+                                ReturnValue& return_value)
+{
+    args.validate_maximum(0);
+    if (auto session = get_internal<T, SessionClass<T>>(ctx, this_object)->lock()) {
+        auto stats = transfer_stats_for_session(session);
+        uint64_t uploaded = stats->uploaded.load(std::memory_order_relaxed);
+        uint64_t uploadable = stats->uploadable.load(std::memory_order_relaxed);
+        uint64_t downloaded = stats->downloaded.load(std::memory_order_relaxed);
+        uint64_t downloadable = stats->downloadable.load(std::memory_order_relaxed);
+        return_value.set(Object::create_obj(
+            ctx, {{"connectionState", Value::from_string(ctx, get_connection_state_value(session->connection_state()))},
+                  {"uploadedBytes", Value::from_number(ctx, static_cast<double>(uploaded))},
+                  {"uploadableBytes", Value::from_number(ctx, static_cast<double>(uploadable))},
+                  {"downloadedBytes", Value::from_number(ctx, static_cast<double>(downloaded))},
+                  {"downloadableBytes", Value::from_number(ctx, static_cast<double>(downloadable))},
+                  {"pendingUploadBytes",
+                   Value::from_number(ctx, static_cast<double>(uploadable > uploaded ? uploadable - uploaded : 0))},
+                  {"pendingDownloadBytes", Value::from_number(ctx, static_cast<double>(
+                                                                       downloadable > downloaded ? downloadable - downloaded : 0))}}));
+    }
+    else {
+        return_value.set_undefined();
+    }
+}
+
 template <typename T>
 void SessionClass<T>::resume(ContextType ctx, ObjectType this_object, Arguments& args, ReturnValue& return_value)
 {
@@ -718,30 +1066,64 @@ void SessionClass<T>::wait_for_completion(Direction direction, ContextType ctx,
     if (auto session = get_internal<T, SessionClass<T>>(ctx, this_object)->lock()) {
         auto callback = Value::validated_to_function(ctx, args[0]);
 
-        util::EventLoopDispatcher<DownloadUploadCompletionHandler> completion_handler(
-            [ctx = Protected(Context<T>::get_global_context(ctx)),
-             callback = Protected(ctx, callback)](std::error_code error) {
-                HANDLESCOPE(ctx);
-                Function<T>::callback(
-                    ctx, callback,
-                    {!error ? Value::from_undefined(ctx)
-                            : Object::create_obj(ctx, {
-                                                          {"message", Value::from_string(ctx, error.message())},
-                                                          {"errorCode", Value::from_number(ctx, error.value())},
-                                                      })});
-            });
-
-        switch (direction) {
-            case Upload:
-                session->wait_for_upload_completion(std::move(completion_handler));
-                break;
-            case Download:
-                session->wait_for_download_completion(std::move(completion_handler));
-                break;
-        }
         auto syncSession = create_object<T, SessionClass<T>>(ctx, new WeakSession(session));
         PropertyAttributes attributes = ReadOnly | DontEnum | DontDelete;
         Object::set_property(ctx, callback, "_syncSession", syncSession, attributes);
+
+        auto waiters = completion_waiters_for_session<T>(session.get());
+        waiters->pending[direction].emplace_back(ctx, callback);
+        // If a wait in this direction is already in flight it was registered
+        // before this waiter and may complete at an older version, so the
+        // callback stays queued; its completion handler starts the next wait.
+        if (!waiters->in_flight[direction]) {
+            register_completion_wait(direction, ctx, session, waiters);
+        }
+    }
+}
+
+template <typename T>
+void SessionClass<T>::register_completion_wait(Direction direction, ContextType ctx,
+                                               std::shared_ptr<SyncSession> const& session,
+                                               std::shared_ptr<SessionCompletionWaiters<T>> const& waiters)
+{
+    waiters->in_flight[direction] = true;
+    auto generation =
+        std::make_shared<std::vector<Protected<FunctionType>>>(std::move(waiters->pending[direction]));
+    waiters->pending[direction].clear();
+
+    // The handler holds the session alive until core delivers it, which core
+    // does even at teardown (with an error), so the chain always unwinds.
+    util::EventLoopDispatcher<DownloadUploadCompletionHandler> completion_handler(
+        [ctx = Protected(Context<T>::get_global_context(ctx)), session, waiters, generation,
+         direction](std::error_code error) {
+            HANDLESCOPE(ctx);
+            waiters->in_flight[direction] = false;
+
+            ValueType result = Value::from_undefined(ctx);
+            if (error) {
+                result = Object::create_obj(ctx, {
+                                                     {"message", Value::from_string(ctx, error.message())},
+                                                     {"errorCode", Value::from_number(ctx, error.value())},
+                                                 });
+            }
+            for (auto& callback : *generation) {
+                Function<T>::callback(ctx, callback, {result});
+            }
+
+            // Waiters that queued while this wait was in flight get a fresh
+            // wait, registered at-or-after their request.
+            if (!waiters->pending[direction].empty()) {
+                register_completion_wait(direction, ctx, session, waiters);
+            }
+        });
+
+    switch (direction) {
+        case Upload:
+            session->wait_for_upload_completion(std::move(completion_handler));
+            break;
+        case Download:
+            session->wait_for_download_completion(std::move(completion_handler));
+            break;
     }
 }
 
@@ -759,6 +1141,160 @@ void SessionClass<T>::wait_for_download_completion(ContextType ctx, ObjectType t
     wait_for_completion(Direction::Download, ctx, this_object, args);
 }
 
+// Lazy inspection handle behind Sync._deserializeChangeSet. The payload
+// bytes are borrowed from the caller's ArrayBuffer (kept alive via a
+// Protected reference) rather than copied, and nothing is parsed until an
+// instruction-level property is first read; reading `byteSize` alone never
+// touches the parser. Base64 string payloads are decoded once into owned
+// storage, which is the only copy they ever pay.
+template <typename T>
+class ChangesetInspector {
+public:
+    using ContextType = typename T::Context;
+    using ValueType = typename T::Value;
+    using Value = js::Value<T>;
+
+    ChangesetInspector(ContextType ctx, ValueType payload)
+    {
+        if (Value::is_binary(ctx, payload)) {
+            m_payload = Protected<ValueType>(ctx, payload);
+            m_data = Value::to_binary_view(ctx, payload, m_owned);
+        }
+        else {
+            std::string encoded = Value::validated_to_string(ctx, payload, "changeset");
+            auto decoded = js::base64::decode_to_vector(StringData(encoded.data(), encoded.size()));
+            if (!decoded) {
+                throw std::invalid_argument("Changeset payload is neither binary nor valid base64.");
+            }
+            m_decoded = std::move(*decoded);
+            m_data = BinaryData(m_decoded.data(), m_decoded.size());
+        }
+    }
+
+    struct Summary {
+        size_t instruction_count = 0;
+        size_t create_objects = 0;
+        size_t erase_objects = 0;
+        size_t updates = 0;
+        size_t schema_changes = 0;
+        std::vector<std::string> tables;
+    };
+
+    size_t byte_size() const noexcept
+    {
+        return m_data.size();
+    }
+
+    Summary const& summary()
+    {
+        if (m_summary) {
+            return *m_summary;
+        }
+
+        sync::Changeset changeset;
+        util::SimpleNoCopyInputStream stream(m_data.data(), m_data.size());
+        sync::parse_changeset(stream, changeset);
+
+        Summary summary;
+        std::set<std::string> tables;
+        using Instr = sync::Instruction;
+        for (auto instr : changeset) {
+            if (!instr) {
+                continue; // tombstone left by changeset merge
+            }
+            summary.instruction_count++;
+            instr->visit([&](auto const& payload) {
+                using P = std::decay_t<decltype(payload)>;
+                if constexpr (std::is_base_of_v<Instr::TableInstruction, P>) {
+                    tables.insert(std::string(changeset.get_string(payload.table)));
+                }
+                if constexpr (std::is_same_v<P, Instr::CreateObject>) {
+                    summary.create_objects++;
+                }
+                else if constexpr (std::is_same_v<P, Instr::EraseObject>) {
+                    summary.erase_objects++;
+                }
+                else if constexpr (std::is_base_of_v<Instr::PathInstruction, P>) {
+                    summary.updates++;
+                }
+                else {
+                    // AddTable, EraseTable, AddColumn, EraseColumn
+                    summary.schema_changes++;
+                }
+            });
+        }
+        summary.tables.assign(tables.begin(), tables.end());
+        m_summary = std::move(summary);
+        return *m_summary;
+    }
+
+private:
+    // Keeps a binary payload's ArrayBuffer alive for as long as the
+    // inspector may still parse it.
+    std::optional<Protected<ValueType>> m_payload;
+    OwnedBinaryData m_owned;
+    std::vector<char> m_decoded;
+    BinaryData m_data;
+    std::optional<Summary> m_summary;
+};
+
+template <typename T>
+class ChangesetInspectorClass : public ClassDefinition<T, ChangesetInspector<T>> {
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+    using ValueType = typename T::Value;
+    using Object = js::Object<T>;
+    using Value = js::Value<T>;
+    using ReturnValue = js::ReturnValue<T>;
+
+public:
+    std::string const name = "ChangesetInspector";
+
+    static void get_byte_size(ContextType ctx, ObjectType object, ReturnValue& return_value)
+    {
+        auto inspector = get_internal<T, ChangesetInspectorClass<T>>(ctx, object);
+        return_value.set(static_cast<uint32_t>(inspector->byte_size()));
+    }
+
+    static void get_instruction_count(ContextType ctx, ObjectType object, ReturnValue& return_value)
+    {
+        auto inspector = get_internal<T, ChangesetInspectorClass<T>>(ctx, object);
+        return_value.set(static_cast<uint32_t>(inspector->summary().instruction_count));
+    }
+
+    static void get_affected_tables(ContextType ctx, ObjectType object, ReturnValue& return_value)
+    {
+        auto inspector = get_internal<T, ChangesetInspectorClass<T>>(ctx, object);
+        auto const& tables = inspector->summary().tables;
+        std::vector<ValueType> names;
+        names.reserve(tables.size());
+        for (auto const& table : tables) {
+            names.push_back(Value::from_string(ctx, table));
+        }
+        return_value.set(Object::create_array(ctx, names));
+    }
+
+    static void get_object_counts(ContextType ctx, ObjectType object, ReturnValue& return_value)
+    {
+        auto inspector = get_internal<T, ChangesetInspectorClass<T>>(ctx, object);
+        auto const& summary = inspector->summary();
+        return_value.set(Object::create_obj(
+            ctx, {
+                     {"createObjects", Value::from_number(ctx, double(summary.create_objects))},
+                     {"eraseObjects", Value::from_number(ctx, double(summary.erase_objects))},
+                     {"updates", Value::from_number(ctx, double(summary.updates))},
+                     {"schemaChanges", Value::from_number(ctx, double(summary.schema_changes))},
+                 }));
+    }
+
+    PropertyMap<T> const properties = {
+        {"byteSize", {wrap<get_byte_size>, nullptr}},
+        {"instructionCount", {wrap<get_instruction_count>, nullptr}},
+        {"affectedTables", {wrap<get_affected_tables>, nullptr}},
+        {"objectCounts", {wrap<get_object_counts>, nullptr}},
+    };
+};
+
 template <typename T>
 class SyncClass : public ClassDefinition<T, void*> {
     using GlobalContextType = typename T::GlobalContext;
@@ -780,6 +1316,7 @@ public:
 
     static void set_sync_log_level(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void set_sync_logger(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void enable_binary_logging(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void set_sync_user_agent(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void initiate_client_reset(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void reconnect(ContextType, ObjectType, Arguments&, ReturnValue&);
@@ -787,6 +1324,8 @@ public:
     static void enable_multiplexing(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void deserialize_change_set(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void get_all_sync_sessions(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void get_session_count(ContextType, ObjectType, Arguments&, ReturnValue&);
+    static void get_sync_stats(ContextType, ObjectType, Arguments&, ReturnValue&);
     static void get_sync_session(ContextType, ObjectType, Arguments&, ReturnValue&);
 
     // private
@@ -800,11 +1339,15 @@ public:
         {"reconnect", wrap<reconnect>},
         {"setLogLevel", wrap<set_sync_log_level>},
         {"enableSessionMultiplexing", wrap<enable_multiplexing>},
+        {"_deserializeChangeSet", wrap<deserialize_change_set>},
         {"setUserAgent", wrap<set_sync_user_agent>},
         {"getAllSyncSessions", wrap<get_all_sync_sessions>},
+        {"sessionCount", wrap<get_session_count>},
+        {"getSyncStats", wrap<get_sync_stats>},
         {"getSyncSession", wrap<get_sync_session>},
         {"setLogger", wrap<set_sync_logger>},
         {"setSyncLogger", wrap<set_sync_logger>},
+        {"enableBinaryLogging", wrap<enable_binary_logging>},
     };
 };
 
@@ -849,6 +1392,59 @@ void SyncClass<T>::get_sync_session(ContextType ctx, ObjectType this_object, Arg
     return_value.set_null();
 }
 
+/**
+ * @brief Cache of JS wrapper objects handed out by `Sync._allSyncSessions`, so
+ * that a monitor polling that call does not construct a fresh wrapper per
+ * session per poll; only sessions that appeared since the last call get a new
+ * one. Entries are pruned once their session goes away.
+ *
+ * The `Protected` wrappers are tied to one JS context while the sessions
+ * keying them are native objects that can outlive it (a React Native reload
+ * tears the context down with sessions still running), so entries are keyed
+ * by (context, session) — a fresh context never receives wrappers created
+ * against a destroyed one — and the platform cache-invalidation hooks call
+ * `clear` at context teardown so stale `Protected` values don't pin the old
+ * context's heap.
+ *
+ * @tparam T The JS runtime types.
+ */
+template <typename T>
+class SessionWrapperCache {
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+    using Key = std::pair<const void*, SyncSession*>;
+    using Entry = std::pair<std::weak_ptr<SyncSession>, Protected<ObjectType>>;
+
+public:
+    static ObjectType get_or_create(ContextType ctx, std::shared_ptr<SyncSession> const& session)
+    {
+        const void* context_key = static_cast<const void*>(Context<T>::get_global_context(ctx));
+        std::lock_guard<std::mutex> lock(s_mutex);
+        for (auto it = s_wrappers.begin(); it != s_wrappers.end();) {
+            it = it->second.first.expired() ? s_wrappers.erase(it) : std::next(it);
+        }
+        auto it = s_wrappers.find(Key(context_key, session.get()));
+        if (it == s_wrappers.end()) {
+            ObjectType wrapper = create_object<T, SessionClass<T>>(ctx, new WeakSession(session));
+            it = s_wrappers
+                     .emplace(Key(context_key, session.get()),
+                              Entry(std::weak_ptr<SyncSession>(session), Protected<ObjectType>(ctx, wrapper)))
+                     .first;
+        }
+        return static_cast<ObjectType>(it->second.second);
+    }
+
+    static void clear()
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_wrappers.clear();
+    }
+
+private:
+    inline static std::mutex s_mutex;
+    inline static std::map<Key, Entry> s_wrappers;
+};
+
 template <typename T>
 void SyncClass<T>::get_all_sync_sessions(ContextType ctx, ObjectType this_object, Arguments& args,
                                          ReturnValue& return_value)
@@ -858,13 +1454,72 @@ void SyncClass<T>::get_all_sync_sessions(ContextType ctx, ObjectType this_object
     auto user_object = Value::validated_to_object(ctx, args[0], "user");
     auto user = get_internal<T, UserClass<T>>(ctx, user_object);
     auto all_sessions = user->m_user->all_sessions();
+
     std::vector<ValueType> session_objects;
+    session_objects.reserve(all_sessions.size());
     for (auto session : all_sessions) {
-        session_objects.push_back(create_object<T, SessionClass<T>>(ctx, new WeakSession(session)));
+        session_objects.push_back(SessionWrapperCache<T>::get_or_create(ctx, session));
     }
     return_value.set(Object::create_array(ctx, session_objects));
 }
 
+template <typename T>
+void SyncClass<T>::get_session_count(ContextType ctx, ObjectType this_object, Arguments& args,
+                                     ReturnValue& return_value)
+{
+    args.validate_count(1);
+
+    auto user_object = Value::validated_to_object(ctx, args[0], "user");
+    auto user = get_internal<T, UserClass<T>>(ctx, user_object);
+    return_value.set(Value::from_number(ctx, static_cast<double>(user->m_user->all_sessions().size())));
+}
+
+template <typename T>
+void SyncClass<T>::get_sync_stats(ContextType ctx, ObjectType this_object, Arguments& args,
+                                  ReturnValue& return_value)
+{
+    args.validate_count(1);
+
+    auto user_object = Value::validated_to_object(ctx, args[0], "user");
+    auto user = get_internal<T, UserClass<T>>(ctx, user_object);
+
+    uint64_t uploaded = 0, downloaded = 0;
+    uint64_t pending_upload = 0, pending_download = 0;
+    size_t connected = 0, connecting = 0, disconnected = 0;
+    auto all_sessions = user->m_user->all_sessions();
+    for (auto const& session : all_sessions) {
+        auto stats = transfer_stats_for_session(session);
+        uint64_t up = stats->uploaded.load(std::memory_order_relaxed);
+        uint64_t up_total = stats->uploadable.load(std::memory_order_relaxed);
+        uint64_t down = stats->downloaded.load(std::memory_order_relaxed);
+        uint64_t down_total = stats->downloadable.load(std::memory_order_relaxed);
+        uploaded += up;
+        downloaded += down;
+        pending_upload += up_total > up ? up_total - up : 0;
+        pending_download += down_total > down ? down_total - down : 0;
+        switch (session->connection_state()) {
+            case SyncSession::ConnectionState::Connected:
+                connected++;
+                break;
+            case SyncSession::ConnectionState::Connecting:
+                connecting++;
+                break;
+            case SyncSession::ConnectionState::Disconnected:
+                disconnected++;
+                break;
+        }
+    }
+    return_value.set(Object::create_obj(
+        ctx, {{"sessionCount", Value::from_number(ctx, static_cast<double>(all_sessions.size()))},
+              {"connectedSessions", Value::from_number(ctx, static_cast<double>(connected))},
+              {"connectingSessions", Value::from_number(ctx, static_cast<double>(connecting))},
+              {"disconnectedSessions", Value::from_number(ctx, static_cast<double>(disconnected))},
+              {"uploadedBytes", Value::from_number(ctx, static_cast<double>(uploaded))},
+              {"downloadedBytes", Value::from_number(ctx, static_cast<double>(downloaded))},
+              {"pendingUploadBytes", Value::from_number(ctx, static_cast<double>(pending_upload))},
+              {"pendingDownloadBytes", Value::from_number(ctx, static_cast<double>(pending_download))}}));
+}
+
 template <typename T>
 void SyncClass<T>::initiate_client_reset(ContextType ctx, ObjectType this_object, Arguments& args,
                                          ReturnValue& return_value)
@@ -895,11 +1550,22 @@ template <typename T>
 void SyncClass<T>::set_sync_logger(ContextType ctx, ObjectType this_object, Arguments& args,
                                    ReturnValue& return_value)
 {
-    args.validate_count(2);
+    args.validate_between(2, 3);
 
     auto app = get_internal<T, AppClass<T>>(ctx, Value::validated_to_object(ctx, args[0], "app"))->m_app;
     auto callback_fn = Value::validated_to_function(ctx, args[1], "logger_callback");
 
+    unsigned category_mask = common::logger::category_all;
+    if (args.count == 3 && !Value::is_undefined(ctx, args[2])) {
+        auto categories_object = Value::validated_to_array(ctx, args[2], "categories");
+        uint32_t length = Object::validated_get_length(ctx, categories_object);
+        category_mask = 0;
+        for (uint32_t i = 0; i < length; i++) {
+            category_mask |= common::logger::Logger::get_category(
+                Value::validated_to_string(ctx, Object::get_property(ctx, categories_object, i), "category"));
+        }
+    }
+
     Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
     Protected<FunctionType> protected_callback(ctx, callback_fn);
 
@@ -912,7 +1578,25 @@ void SyncClass<T>::set_sync_logger(ContextType ctx, ObjectType this_object, Argu
         Function::callback(protected_ctx, protected_callback, 2, arguments);
     };
 
-    auto sync_logger = common::logger::Logger::build_sync_logger(std::move(show_logs));
+    auto sync_logger = common::logger::Logger::build_sync_logger(std::move(show_logs), category_mask);
+    app->sync_manager()->set_logger_factory(sync_logger);
+}
+
+template <typename T>
+void SyncClass<T>::enable_binary_logging(ContextType ctx, ObjectType this_object, Arguments& args,
+                                         ReturnValue& return_value)
+{
+    args.validate_between(2, 3);
+
+    auto app = get_internal<T, AppClass<T>>(ctx, Value::validated_to_object(ctx, args[0], "app"))->m_app;
+    std::string path = Value::validated_to_string(ctx, args[1], "path");
+
+    uint64_t max_bytes = 16 * 1024 * 1024;
+    if (args.count == 3 && !Value::is_undefined(ctx, args[2])) {
+        max_bytes = uint64_t(Value::validated_to_number(ctx, args[2], "maxBytes"));
+    }
+
+    auto sync_logger = common::logger::Logger::build_binary_sync_logger(path, max_bytes);
     app->sync_manager()->set_logger_factory(sync_logger);
 }
 
@@ -947,6 +1631,7 @@ template <typename T>
 void SyncClass<T>::populate_sync_config(ContextType ctx, ObjectType realm_constructor, ObjectType config_object,
                                         Realm::Config& config)
 {
+    startup::PhaseTimer timer("syncConfigPopulate");
     ValueType sync_config_value = Object::get_property(ctx, config_object, "sync");
     if (Value::is_boolean(ctx, sync_config_value)) {
         config.force_sync_history = Value::to_boolean(ctx, sync_config_value);
@@ -960,7 +1645,7 @@ void SyncClass<T>::populate_sync_config(ContextType ctx, ObjectType realm_constr
         std::function<SyncSessionErrorHandler> error_handler;
         ValueType error_func = Object::get_property(ctx, sync_config_object, "error");
         if (!Value::is_undefined(ctx, error_func)) {
-            error_handler = util::EventLoopDispatcher<SyncSessionErrorHandler>(
+            error_handler = BatchedEventLoopDispatcher<SyncSessionErrorHandler>(
                 SyncSessionErrorHandlerFunctor<T>(ctx, Value::validated_to_function(ctx, error_func)));
         }
 
@@ -1156,5 +1841,22 @@ void SyncClass<T>::enable_multiplexing(ContextType ctx, ObjectType this_object,
     app->sync_manager()->enable_session_multiplexing();
 }
 
+/**
+ * @brief Wrap a serialized changeset in a lazy inspection handle.
+ *
+ *  Accepts an ArrayBuffer (borrowed without copying) or a base64 string
+ *  (decoded once). The returned handle exposes `byteSize` without parsing;
+ *  `instructionCount`, `affectedTables` and `objectCounts` parse the
+ *  changeset on first access and cache the result, so audit tooling that
+ *  samples only sizes never pays for instruction decoding.
+ */
+template <typename T>
+void SyncClass<T>::deserialize_change_set(ContextType ctx, ObjectType this_object, Arguments& args,
+                                          ReturnValue& return_value)
+{
+    args.validate_count(1);
+    return_value.set(create_object<T, ChangesetInspectorClass<T>>(ctx, new ChangesetInspector<T>(ctx, args[0])));
+}
+
 } // namespace js
 } // namespace realm
@@ -22,6 +22,11 @@
 #include <realm/object-store/object.hpp>
 #include <realm/object-store/property.hpp>
 
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -35,6 +40,8 @@
 #include <realm/util/base64.hpp>
 #include <realm/mixed.hpp>
 
+#include "js_base64.hpp"
+
 #include <realm/object-store/util/bson/bson.hpp>
 #include <realm/object-store/util/event_loop_dispatcher.hpp>
 #include <realm/object-store/sync/generic_network_transport.hpp>
@@ -54,6 +61,69 @@ class ObjectSchema;
 namespace realm {
 namespace js {
 
+// Live-object census feeding Realm.memoryStats(): the engine's wrapper
+// objects and Protected references report construction and destruction here
+// so a process's RSS can be attributed between wrapper classes, retained JS
+// references and core state without heap profiling.
+class MemoryCensus {
+public:
+    static MemoryCensus& shared()
+    {
+        static MemoryCensus s_census;
+        return s_census;
+    }
+
+    // Per-instance member of each wrapper object; counts the instance for its
+    // class over the member's exact lifetime, so constructor failure paths
+    // balance automatically.
+    struct WrapperToken {
+        explicit WrapperToken(const std::string& class_name)
+            : m_class_name(class_name)
+        {
+            shared().wrapper_created(m_class_name);
+        }
+        ~WrapperToken()
+        {
+            shared().wrapper_destroyed(m_class_name);
+        }
+        WrapperToken(const WrapperToken&) = delete;
+        WrapperToken& operator=(const WrapperToken&) = delete;
+
+    private:
+        std::string m_class_name;
+    };
+
+    void wrapper_created(const std::string& class_name)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_wrapper_counts[class_name]++;
+    }
+
+    void wrapper_destroyed(const std::string& class_name)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_wrapper_counts.find(class_name);
+        if (it != m_wrapper_counts.end() && it->second > 0) {
+            it->second--;
+        }
+    }
+
+    std::map<std::string, size_t> wrapper_counts() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_wrapper_counts;
+    }
+
+    // Live Protected references holding a JS value alive.
+    std::atomic<size_t> protected_references{0};
+
+private:
+    MemoryCensus() = default;
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, size_t> m_wrapper_counts;
+};
+
 template <typename>
 struct RealmObjectClass;
 
@@ -126,6 +196,26 @@ public:
     static std::string type_string(Property const& prop);
 };
 
+/// Which branch of `Value::to_mixed` a JS value converts through. Classifying
+/// once and converting through a switch lets callers that can predict the
+/// branch — the shape-cached conversion plans in js_object_accessor.hpp —
+/// confirm the prediction with a single engine type check instead of
+/// re-walking the whole deduction chain per field.
+enum class MixedConversion : uint8_t {
+    Null,
+    Boolean,
+    Date,
+    Number,
+    String,
+    Binary,
+    Decimal,
+    ObjectId,
+    Uuid,
+    Array,
+    Object,
+    Unsupported,
+};
+
 template <typename T>
 struct Value {
     using ContextType = typename T::Context;
@@ -202,10 +292,30 @@ struct Value {
     static UUID to_uuid(ContextType, const ValueType&);
     static ObjectType to_object(ContextType, const ValueType&);
     static String<T> to_string(ContextType, const ValueType&);
+    // Like to_string, but decodes straight into `out`, reusing its capacity.
+    // Conversion-heavy paths (bulk ingest through NativeAccessor) call this
+    // with a long-lived buffer so steady-state string conversion does not
+    // touch the heap at all.
+    static void to_string_buffer(ContextType, const ValueType&, std::string& out);
     static OwnedBinaryData to_binary(ContextType, const ValueType&);
+    // Like to_binary, but borrows the value's underlying buffer when the
+    // engine exposes it instead of copying. The returned view is only valid
+    // while `value` is alive and `storage` is unchanged; engines that cannot
+    // safely borrow copy into `storage` and return a view of that.
+    static BinaryData to_binary_view(ContextType, const ValueType&, OwnedBinaryData& storage);
     static bson::Bson to_bson(ContextType, ValueType);
+    static bson::Bson to_bson_via_ejson(ContextType, ValueType);
     static Mixed to_mixed(ContextType ctx, std::shared_ptr<Realm> realm, const ValueType& value,
                           std::string& string_buffer, OwnedBinaryData& binary_buffer);
+    // The deduction chain of to_mixed, split from the conversion so that a
+    // predicted branch can be verified and replayed without re-deducing.
+    static MixedConversion classify_for_mixed(ContextType ctx, const ValueType& value);
+    // Whether `value` would classify as `kind`. A single type check for most
+    // branches; the predicates involved are mutually exclusive, so a match
+    // here is exactly a match of the full chain.
+    static bool matches_mixed_conversion(ContextType ctx, const ValueType& value, MixedConversion kind);
+    static Mixed to_mixed_as(ContextType ctx, std::shared_ptr<Realm> realm, const ValueType& value,
+                             std::string& string_buffer, OwnedBinaryData& binary_buffer, MixedConversion kind);
 
 #define VALIDATED(return_t, type)                                                                                    \
     static return_t validated_to_##type(ContextType ctx, const ValueType& value, const char* name = nullptr)         \
@@ -337,6 +447,14 @@ public:
     static void set_property(ContextType, ObjectType&, const String<T>&, const ValueType&,
                              PropertyAttributes attributes = None);
     static void set_property(ContextType, ObjectType&, uint32_t, const ValueType&);
+
+    // A property whose value is expensive to create and usually never read.
+    // `factory` must install the property on the object (it may install
+    // several in one go) and return the value for the access that triggered
+    // it. Engines with native accessor support defer the factory to the first
+    // read; others run it eagerly at definition time.
+    using LazyPropertyFactory = ValueType (*)(ContextType, ObjectType, StringData);
+    static void set_lazy_property(ContextType, ObjectType, const String<T>&, LazyPropertyFactory);
     static std::vector<String<T>> get_property_names(ContextType, const ObjectType&);
 
     static void set_global(ContextType, const String<T>&, const ValueType&);
@@ -360,26 +478,30 @@ public:
         return Value<T>::validated_to_number(ctx, get_property(ctx, object, length_string));
     }
 
+// The key is only stringified and the message only formatted on the failure
+// branch; the success path is a type check plus the conversion itself.
 #define VALIDATED(return_t, type)                                                                                    \
     static return_t validated_get_##type(ContextType ctx, const ObjectType& object, const String<T>& key,            \
                                          const char* message = nullptr)                                              \
     {                                                                                                                \
-        try {                                                                                                        \
-            return Value<T>::validated_to_##type(ctx, get_property(ctx, object, key), std::string(key).c_str());     \
-        }                                                                                                            \
-        catch (std::invalid_argument & e) {                                                                          \
-            throw message ? std::invalid_argument(util::format("Failed to read %1: %2", message, e.what())) : e;     \
+        auto value = get_property(ctx, object, key);                                                                 \
+        if (Value<T>::is_##type(ctx, value)) {                                                                       \
+            return Value<T>::to_##type(ctx, value);                                                                  \
         }                                                                                                            \
+        TypeErrorException error(std::string(key).c_str(), #type, Value<T>::to_string(ctx, value));                  \
+        throw message ? std::invalid_argument(util::format("Failed to read %1: %2", message, error.what()))          \
+                      : std::invalid_argument(error);                                                                \
     }                                                                                                                \
     static return_t validated_get_##type(ContextType ctx, const ObjectType& object, uint32_t index,                  \
                                          const char* message = nullptr)                                              \
     {                                                                                                                \
-        try {                                                                                                        \
-            return Value<T>::validated_to_##type(ctx, get_property(ctx, object, index));                             \
-        }                                                                                                            \
-        catch (std::invalid_argument & e) {                                                                          \
-            throw message ? std::invalid_argument(util::format("Failed to read %1: %2", message, e.what())) : e;     \
+        auto value = get_property(ctx, object, index);                                                               \
+        if (Value<T>::is_##type(ctx, value)) {                                                                       \
+            return Value<T>::to_##type(ctx, value);                                                                  \
         }                                                                                                            \
+        TypeErrorException error(nullptr, #type, Value<T>::to_string(ctx, value));                                   \
+        throw message ? std::invalid_argument(util::format("Failed to read %1: %2", message, error.what()))          \
+                      : std::invalid_argument(error);                                                                \
     }
 
     VALIDATED(ObjectType, array)
@@ -414,14 +536,9 @@ public:
     }
 
     static ObjectType create_empty(ContextType);
-    static ObjectType create_obj(ContextType ctx, std::initializer_list<std::pair<String<T>, ValueType>> values)
-    {
-        auto obj = create_empty(ctx);
-        for (auto&& [name, val] : values) {
-            set_property(ctx, obj, name, val);
-        }
-        return obj;
-    }
+    // Engine-specific so Node can define the whole literal with a single
+    // napi_define_properties call instead of one napi call per field.
+    static ObjectType create_obj(ContextType ctx, std::initializer_list<std::pair<String<T>, ValueType>> values);
     static ObjectType create_error(ContextType ctx, std::string message);
 
     static ObjectType create_array(ContextType, uint32_t, const ValueType[]);
@@ -438,6 +555,10 @@ public:
         return create_array(ctx, 0, nullptr);
     }
 
+    // Creates a Uint32Array from native memory in one engine call, so large
+    // index sets (collection change sets) don't pay one boxed Number per entry.
+    static ObjectType create_uint32_array(ContextType, const std::vector<uint32_t>& values);
+
     static ObjectType create_date(ContextType, double);
 
     template <typename ClassType>
@@ -773,7 +894,7 @@ inline typename T::Value Value<T>::from_bson(typename T::Context ctx, const bson
             return from_string(ctx, value.operator const std::string&());
         case Type::Binary: {
             const auto& vec = value.operator const std::vector<char>&();
-            const auto decoded = realm::util::base64_decode_to_vector(StringData(vec.data(), vec.size()));
+            const auto decoded = js::base64::decode_to_vector(StringData(vec.data(), vec.size()));
             if (!decoded)
                 throw std::invalid_argument("invalid base64 in binary data");
             auto Uint8Array = Value<T>::to_function(ctx, Object<T>::get_global(ctx, "Uint8Array"));
@@ -867,10 +988,10 @@ typename T::Value Value<T>::from_mixed(ContextType ctx, std::shared_ptr<Realm> r
 
 
 template <typename T>
-inline bson::Bson Value<T>::to_bson(typename T::Context ctx, ValueType value)
+inline bson::Bson Value<T>::to_bson_via_ejson(typename T::Context ctx, ValueType value)
 {
-    // For now going through the bson.EJSON.stringify() since it will correctly handle the special JS types.
-    // Consider directly converting to Bson if we need more control or there are performance issues.
+    // Round-trips through bson.EJSON.stringify(), which correctly handles every special JS type.
+    // Kept as the fallback for the types the native converter in to_bson does not map.
     auto realm = Value::validated_to_object(ctx, Object<T>::get_global(ctx, "Realm"));
     auto bson = Value::validated_to_object(ctx, Object<T>::get_property(ctx, realm, "_bson"));
     auto ejson = Value::validated_to_object(ctx, Object<T>::get_property(ctx, bson, "EJSON"));
@@ -884,66 +1005,224 @@ inline bson::Bson Value<T>::to_bson(typename T::Context ctx, ValueType value)
 }
 
 template <typename T>
-typename realm::Mixed Value<T>::to_mixed(ContextType ctx, std::shared_ptr<Realm> realm, const ValueType& value,
-                                         std::string& string_buffer, OwnedBinaryData& binary_buffer)
+inline bson::Bson Value<T>::to_bson(typename T::Context ctx, ValueType value)
 {
+    // Direct conversion, mirroring what bson.EJSON.stringify() in canonical
+    // mode followed by bson::parse produced: integral numbers become
+    // Int32/Int64, other numbers Double, dates Datetime, binary values hold
+    // their payload base64-encoded. JS types from the bson package that have
+    // no native check here (Timestamp, Binary, BSONRegExp, Min/MaxKey, ...)
+    // fall back to the EJSON bridge per value, so payloads dominated by plain
+    // documents never leave C++.
     if (is_null(ctx, value) || is_undefined(ctx, value)) {
-        return Mixed(realm::null());
+        return bson::Bson();
     }
-    else if (is_boolean(ctx, value)) {
-        return Mixed(to_boolean(ctx, value));
+    if (is_boolean(ctx, value)) {
+        return bson::Bson(to_boolean(ctx, value));
     }
-    else if (is_date(ctx, value)) {
-        auto date = to_date(ctx, value);
-
-        double milliseconds = to_number(ctx, date);
+    if (is_number(ctx, value)) {
+        double number = to_number(ctx, value);
+        if (number == std::floor(number) && !std::isinf(number) && std::abs(number) <= double(JS_MAX_SAFE_INTEGER)) {
+            auto integral = int64_t(number);
+            if (integral >= std::numeric_limits<int32_t>::min() && integral <= std::numeric_limits<int32_t>::max()) {
+                return bson::Bson(int32_t(integral));
+            }
+            return bson::Bson(integral);
+        }
+        return bson::Bson(number);
+    }
+    if (is_string(ctx, value)) {
+        return bson::Bson(std::string(to_string(ctx, value)));
+    }
+    if (is_date(ctx, value)) {
+        double milliseconds = to_number(ctx, to_date(ctx, value));
         int64_t seconds = milliseconds / 1000;
         int32_t nanoseconds = ((int64_t)milliseconds % 1000) * 1000000;
-        Timestamp ts(seconds, nanoseconds);
+        return bson::Bson(Timestamp(seconds, nanoseconds));
+    }
+    if (is_decimal128(ctx, value)) {
+        return bson::Bson(to_decimal128(ctx, value));
+    }
+    if (is_object_id(ctx, value)) {
+        return bson::Bson(to_object_id(ctx, value));
+    }
+    if (is_uuid(ctx, value)) {
+        return bson::Bson(to_uuid(ctx, value));
+    }
+    if (is_binary(ctx, value)) {
+        auto binary = to_binary(ctx, value);
+        auto data = binary.get();
+        std::vector<char> encoded(realm::util::base64_encoded_size(data.size()));
+        js::base64::encode(data.data(), data.size(), encoded.data(), encoded.size());
+        return bson::Bson(std::move(encoded));
+    }
+    if (is_array(ctx, value)) {
+        ObjectType array = to_object(ctx, value);
+        uint32_t length = Object<T>::validated_get_length(ctx, array);
+        bson::BsonArray out;
+        for (uint32_t i = 0; i < length; i++) {
+            out.push_back(to_bson(ctx, Object<T>::get_property(ctx, array, i)));
+        }
+        return bson::Bson(std::move(out));
+    }
+    if (is_object(ctx, value) && !is_function(ctx, value)) {
+        ObjectType object = to_object(ctx, value);
+        ValueType bson_type = Object<T>::get_property(ctx, object, "_bsontype");
+        if (is_undefined(ctx, bson_type)) {
+            bson::BsonDocument document;
+            for (auto& key : Object<T>::get_property_names(ctx, object)) {
+                document[key] = to_bson(ctx, Object<T>::get_property(ctx, object, key));
+            }
+            return bson::Bson(std::move(document));
+        }
+        if (std::string(to_string(ctx, bson_type)) == "Long") {
+            auto high = int64_t(int32_t(to_number(ctx, Object<T>::get_property(ctx, object, "high"))));
+            auto low = uint32_t(int32_t(to_number(ctx, Object<T>::get_property(ctx, object, "low"))));
+            return bson::Bson(int64_t((high << 32) | low));
+        }
+    }
+    return to_bson_via_ejson(ctx, value);
+}
 
-        return Mixed(ts);
+template <typename T>
+MixedConversion Value<T>::classify_for_mixed(ContextType ctx, const ValueType& value)
+{
+    if (is_null(ctx, value) || is_undefined(ctx, value)) {
+        return MixedConversion::Null;
+    }
+    else if (is_boolean(ctx, value)) {
+        return MixedConversion::Boolean;
+    }
+    else if (is_date(ctx, value)) {
+        return MixedConversion::Date;
     }
     else if (is_number(ctx, value)) {
-        return Mixed(to_number(ctx, value));
+        return MixedConversion::Number;
     }
     else if (is_string(ctx, value)) {
-        string_buffer = std::move(to_string(ctx, value));
-        return Mixed(string_buffer);
+        return MixedConversion::String;
     }
     else if (is_binary(ctx, value)) {
-        binary_buffer = std::move(to_binary(ctx, value));
-        return Mixed(binary_buffer.get());
+        return MixedConversion::Binary;
     }
     else if (is_decimal128(ctx, value)) {
-        return Mixed(to_decimal128(ctx, value));
+        return MixedConversion::Decimal;
     }
     else if (is_object_id(ctx, value)) {
-        return Mixed(to_object_id(ctx, value));
+        return MixedConversion::ObjectId;
     }
     else if (is_uuid(ctx, value)) {
-        return Mixed(to_uuid(ctx, value));
+        return MixedConversion::Uuid;
     }
     else if (is_array(ctx, value)) {
-        throw std::runtime_error("A mixed property cannot contain an array of values.");
+        return MixedConversion::Array;
     }
     else if (is_object(ctx, value)) {
-        const std::string message = "Only Realm instances are supported.";
-        auto js_object = to_object(ctx, value);
+        return MixedConversion::Object;
+    }
+    return MixedConversion::Unsupported;
+}
 
-        auto is_ros_instance = Object<T>::template is_instance<RealmObjectClass<T>>(ctx, js_object);
-        if (!is_ros_instance) {
-            throw std::runtime_error(message);
-        }
-        auto os_object = Object<T>::template get_internal<RealmObjectClass<T>>(ctx, js_object);
-        if (!(os_object && os_object->realm() == realm)) {
-            throw std::runtime_error(message);
+template <typename T>
+bool Value<T>::matches_mixed_conversion(ContextType ctx, const ValueType& value, MixedConversion kind)
+{
+    switch (kind) {
+        case MixedConversion::Null:
+            return is_null(ctx, value) || is_undefined(ctx, value);
+        case MixedConversion::Boolean:
+            return is_boolean(ctx, value);
+        case MixedConversion::Date:
+            return is_date(ctx, value);
+        case MixedConversion::Number:
+            return is_number(ctx, value);
+        case MixedConversion::String:
+            return is_string(ctx, value);
+        case MixedConversion::Binary:
+            return is_binary(ctx, value);
+        case MixedConversion::Decimal:
+            return is_decimal128(ctx, value);
+        case MixedConversion::ObjectId:
+            return is_object_id(ctx, value);
+        case MixedConversion::Uuid:
+            return is_uuid(ctx, value);
+        case MixedConversion::Array:
+            return is_array(ctx, value);
+        case MixedConversion::Object:
+            // `is_object` alone also matches dates, binaries and the other
+            // boxed types above, so only a managed Realm object is safe to
+            // take on prediction alone.
+            return is_object(ctx, value) &&
+                   Object<T>::template is_instance<RealmObjectClass<T>>(ctx, to_object(ctx, value));
+        case MixedConversion::Unsupported:
+            break;
+    }
+    return false;
+}
+
+template <typename T>
+typename realm::Mixed Value<T>::to_mixed_as(ContextType ctx, std::shared_ptr<Realm> realm, const ValueType& value,
+                                            std::string& string_buffer, OwnedBinaryData& binary_buffer,
+                                            MixedConversion kind)
+{
+    switch (kind) {
+        case MixedConversion::Null:
+            return Mixed(realm::null());
+        case MixedConversion::Boolean:
+            return Mixed(to_boolean(ctx, value));
+        case MixedConversion::Date: {
+            auto date = to_date(ctx, value);
+
+            double milliseconds = to_number(ctx, date);
+            int64_t seconds = milliseconds / 1000;
+            int32_t nanoseconds = ((int64_t)milliseconds % 1000) * 1000000;
+            Timestamp ts(seconds, nanoseconds);
+
+            return Mixed(ts);
         }
+        case MixedConversion::Number:
+            return Mixed(to_number(ctx, value));
+        case MixedConversion::String:
+            to_string_buffer(ctx, value, string_buffer);
+            return Mixed(string_buffer);
+        case MixedConversion::Binary:
+            binary_buffer = std::move(to_binary(ctx, value));
+            return Mixed(binary_buffer.get());
+        case MixedConversion::Decimal:
+            return Mixed(to_decimal128(ctx, value));
+        case MixedConversion::ObjectId:
+            return Mixed(to_object_id(ctx, value));
+        case MixedConversion::Uuid:
+            return Mixed(to_uuid(ctx, value));
+        case MixedConversion::Array:
+            throw std::runtime_error("A mixed property cannot contain an array of values.");
+        case MixedConversion::Object: {
+            const std::string message = "Only Realm instances are supported.";
+            auto js_object = to_object(ctx, value);
+
+            auto is_ros_instance = Object<T>::template is_instance<RealmObjectClass<T>>(ctx, js_object);
+            if (!is_ros_instance) {
+                throw std::runtime_error(message);
+            }
+            auto os_object = Object<T>::template get_internal<RealmObjectClass<T>>(ctx, js_object);
+            if (!(os_object && os_object->realm() == realm)) {
+                throw std::runtime_error(message);
+            }
 
-        return Mixed(os_object->obj());
+            return Mixed(os_object->obj());
+        }
+        case MixedConversion::Unsupported:
+            break;
     }
     REALM_UNREACHABLE();
 }
 
+template <typename T>
+typename realm::Mixed Value<T>::to_mixed(ContextType ctx, std::shared_ptr<Realm> realm, const ValueType& value,
+                                         std::string& string_buffer, OwnedBinaryData& binary_buffer)
+{
+    return to_mixed_as(ctx, realm, value, string_buffer, binary_buffer, classify_for_mixed(ctx, value));
+}
+
 template <typename T>
 auto Function<T>::wrap_void_callback(ContextType ctx, const ObjectType& this_object, const FunctionType& callback)
 {
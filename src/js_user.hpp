@@ -18,7 +18,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <optional>
+#include <thread>
 
 #include "js_class.hpp"
 #include "js_collection.hpp"
@@ -46,6 +52,149 @@ using SharedApp = std::shared_ptr<realm::app::App>;
 using UserToken = realm::Subscribable<realm::SyncUser>::Token;
 using WatchStream = realm::app::WatchStream;
 
+// Proactively refreshes user access tokens shortly before they expire, so
+// requests do not have to eat a 401-refresh-retry round trip at exactly the
+// moment the app is fanning out work. The token's expiry is parsed once when
+// the user is registered; a background thread sleeps until shortly before it
+// and then kicks a refresh through the App (whose transport dispatches onto
+// the event loop by itself). At most one refresh is in flight per user, and
+// a successful refresh reschedules from the new token's expiry.
+class TokenRefreshScheduler {
+public:
+    static TokenRefreshScheduler& shared()
+    {
+        // Intentionally leaked: the background thread may outlive static
+        // destruction order, so the scheduler is never torn down.
+        static TokenRefreshScheduler* scheduler = new TokenRefreshScheduler;
+        return *scheduler;
+    }
+
+    void schedule(SharedUser const& user, SharedApp const& app)
+    {
+        if (!user || user->state() != SyncUser::State::LoggedIn) {
+            return;
+        }
+        auto when = refresh_time_for(user);
+        if (!when) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& entry = m_entries[user.get()];
+        entry.user = user;
+        entry.app = app;
+        entry.when = *when;
+        if (!m_thread_started) {
+            m_thread_started = true;
+            std::thread([this] {
+                run();
+            }).detach();
+        }
+        m_cv.notify_one();
+    }
+
+private:
+    struct Entry {
+        std::weak_ptr<SyncUser> user;
+        std::weak_ptr<app::App> app;
+        std::chrono::steady_clock::time_point when;
+        bool in_flight = false;
+    };
+
+    // Refresh this long before the token would expire. Tokens closer to
+    // expiry than this are left to the reactive 401 path.
+    static constexpr int64_t s_refresh_margin_seconds = 30;
+
+    static std::optional<std::chrono::steady_clock::time_point> refresh_time_for(SharedUser const& user)
+    {
+        try {
+            RealmJWT token(user->access_token());
+            auto now_unix = std::chrono::duration_cast<std::chrono::seconds>(
+                                std::chrono::system_clock::now().time_since_epoch())
+                                .count();
+            int64_t seconds_left = token.expires_at - now_unix;
+            if (seconds_left <= s_refresh_margin_seconds) {
+                return std::nullopt;
+            }
+            return std::chrono::steady_clock::now() +
+                   std::chrono::seconds(seconds_left - s_refresh_margin_seconds);
+        }
+        catch (...) {
+            // Tokens the binding cannot parse are never refreshed proactively.
+            return std::nullopt;
+        }
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            for (auto it = m_entries.begin(); it != m_entries.end();) {
+                it = it->second.user.expired() ? m_entries.erase(it) : std::next(it);
+            }
+
+            auto next = std::chrono::steady_clock::time_point::max();
+            for (auto const& [key, entry] : m_entries) {
+                if (!entry.in_flight && entry.when < next) {
+                    next = entry.when;
+                }
+            }
+            if (next == std::chrono::steady_clock::time_point::max()) {
+                m_cv.wait(lock);
+                continue;
+            }
+            m_cv.wait_until(lock, next);
+
+            auto now = std::chrono::steady_clock::now();
+            for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+                if (it->second.in_flight || it->second.when > now) {
+                    continue;
+                }
+                auto user = it->second.user.lock();
+                auto app = it->second.app.lock();
+                if (!user || !app || user->state() != SyncUser::State::LoggedIn) {
+                    m_entries.erase(it);
+                    break;
+                }
+                it->second.in_flight = true;
+                SyncUser* key = it->first;
+                lock.unlock();
+                // refresh_custom_data re-issues the access token as a side
+                // effect; it is the only proactive refresh entry point the
+                // App exposes.
+                app->refresh_custom_data(user, [this, key](util::Optional<app::AppError>) {
+                    finish_refresh(key);
+                });
+                lock.lock();
+                // The map may have changed while unlocked; re-scan.
+                break;
+            }
+        }
+    }
+
+    void finish_refresh(SyncUser* key)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            return;
+        }
+        it->second.in_flight = false;
+        if (auto user = it->second.user.lock()) {
+            if (auto when = refresh_time_for(user)) {
+                it->second.when = *when;
+                m_cv.notify_one();
+                return;
+            }
+        }
+        m_entries.erase(it);
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::map<SyncUser*, Entry> m_entries;
+    bool m_thread_started = false;
+};
+
 template <typename T>
 class WatchStreamClass : public ClassDefinition<T, WatchStream> {
     using GlobalContextType = typename T::GlobalContext;
@@ -124,6 +273,8 @@ void WatchStreamClass<T>::next_event(ContextType ctx, ObjectType object, Argumen
 template <typename T>
 class User {
 public:
+    using ValueType = typename T::Value;
+
     User(SharedUser user, SharedApp app)
         : m_user(std::move(user))
         , m_app(std::move(app))
@@ -141,6 +292,17 @@ public:
 
     notifications::NotificationHandle<T, UserToken> m_notification_handle;
 
+    // Deserialized profile/custom data are cached per data version. The
+    // subscription below only bumps the version — it can fire on a network
+    // thread — while the cached JS values are created and dropped on the JS
+    // thread by the accessors. See UserClass::get_custom_data.
+    std::atomic<uint64_t> m_data_version{1};
+    uint64_t m_custom_data_cached_version = 0;
+    std::optional<Protected<ValueType>> m_custom_data_cache;
+    uint64_t m_profile_cached_version = 0;
+    std::optional<Protected<ValueType>> m_profile_cache;
+    std::optional<UserToken> m_cache_invalidation_token;
+
     SharedApp m_app;
     SharedUser m_user;
 };
@@ -240,6 +402,7 @@ inline typename T::Function UserClass<T>::create_constructor(ContextType ctx)
 template <typename T>
 typename T::Object UserClass<T>::create_instance(ContextType ctx, SharedUser user, SharedApp app)
 {
+    TokenRefreshScheduler::shared().schedule(user, app);
     return create_object<T, UserClass<T>>(ctx, new User<T>(std::move(user), std::move(app)));
 }
 
@@ -323,14 +486,35 @@ void UserClass<T>::get_state(ContextType ctx, ObjectType object, ReturnValue& re
     }
 }
 
+// Subscribes once per User wrapper so any user change (token refresh, state
+// change) invalidates the cached profile/custom data by bumping the version.
+template <typename T>
+static void ensure_user_cache_invalidation(User<T>* user)
+{
+    if (user->m_cache_invalidation_token) {
+        return;
+    }
+    user->m_cache_invalidation_token = std::move(user->m_user->subscribe([user](const realm::SyncUser&) {
+        user->m_data_version.fetch_add(1, std::memory_order_relaxed);
+    }));
+}
+
 template <typename T>
 void UserClass<T>::get_custom_data(ContextType ctx, ObjectType object, ReturnValue& return_value)
 {
-    auto custom_data = get_internal<T, UserClass<T>>(ctx, object)->m_user->custom_data();
-    if (!custom_data)
-        return return_value.set_null();
+    auto user = get_internal<T, UserClass<T>>(ctx, object);
+    uint64_t version = user->m_data_version.load(std::memory_order_relaxed);
+    if (user->m_custom_data_cache && user->m_custom_data_cached_version == version) {
+        return return_value.set(static_cast<ValueType>(*user->m_custom_data_cache));
+    }
+
+    auto custom_data = user->m_user->custom_data();
+    ValueType value = custom_data ? ValueType(Value::from_bson(ctx, *custom_data)) : Value::from_null(ctx);
 
-    return_value.set(Value::from_string(ctx, String::from_bson(*custom_data)));
+    ensure_user_cache_invalidation(user);
+    user->m_custom_data_cache.emplace(ctx, value);
+    user->m_custom_data_cached_version = version;
+    return_value.set(value);
 }
 
 template <typename T>
@@ -346,7 +530,13 @@ void UserClass<T>::get_profile(ContextType ctx, ObjectType object, ReturnValue&
     static const String string_min_age = "minAge";
     static const String string_max_age = "maxAge";
 
-    auto user_profile = get_internal<T, UserClass<T>>(ctx, object)->m_user->user_profile();
+    auto user = get_internal<T, UserClass<T>>(ctx, object);
+    uint64_t version = user->m_data_version.load(std::memory_order_relaxed);
+    if (user->m_profile_cache && user->m_profile_cached_version == version) {
+        return return_value.set(static_cast<ValueType>(*user->m_profile_cache));
+    }
+
+    auto user_profile = user->m_user->user_profile();
 
     auto profile_object = Object::create_empty(ctx);
 #define STRING_TO_PROP(propname)                                                                                     \
@@ -374,6 +564,10 @@ void UserClass<T>::get_profile(ContextType ctx, ObjectType object, ReturnValue&
         ValueType metadata_value = Object::get_property(ctx, metadata_object, metadata_key);
         Object::set_property(ctx, profile_object, metadata_key, metadata_value);
     }
+
+    ensure_user_cache_invalidation(user);
+    user->m_profile_cache.emplace(ctx, profile_object);
+    user->m_profile_cached_version = version;
     return_value.set(profile_object);
 }
 
@@ -414,24 +608,32 @@ void UserClass<T>::call_function(ContextType ctx, ObjectType this_object, Argume
 
     auto name = Value::validated_to_string(ctx, args[0], "name");
 
-    auto stringified_ejson_args = Value::validated_to_string(ctx, args[1], "args");
+    // Arguments arrive either as a JS array, converted natively, or — from
+    // the RPC debug path — as stringified EJSON. The result mirrors the
+    // input: structured calls get JS values back, string calls get EJSON.
+    bool ejson_bridge = Value::is_string(ctx, args[1]);
     auto service = Value::is_undefined(ctx, args[2])
                        ? std::nullopt
                        : std::optional<std::string>(Value::validated_to_string(ctx, args[2], "service"));
     auto callback = Value::validated_to_function(ctx, args[3], "callback");
 
-    auto bson_args = String::to_bson(stringified_ejson_args);
+    auto bson_args =
+        ejson_bridge ? String::to_bson(Value::to_string(ctx, args[1])) : Value::to_bson(ctx, args[1]);
 
     if (bson_args.type() != realm::bson::Bson::Type::Array) {
-        throw TypeErrorException("args", "array", stringified_ejson_args);
+        throw TypeErrorException("args", "array", Value::to_string(ctx, args[1]));
     }
 
     user->m_app->call_function(
         user->m_user, name, static_cast<const bson::BsonArray&>(bson_args), service,
         Function::wrap_callback_result_first(ctx, this_object, callback,
-                                             [](ContextType ctx, const std::optional<bson::Bson>& result) {
+                                             [ejson_bridge](ContextType ctx,
+                                                            const std::optional<bson::Bson>& result) {
                                                  REALM_ASSERT_RELEASE(result);
-                                                 return Value::from_string(ctx, String::from_bson(*result));
+                                                 if (ejson_bridge) {
+                                                     return Value::from_string(ctx, String::from_bson(*result));
+                                                 }
+                                                 return Value::from_bson(ctx, *result);
                                              }));
 }
 
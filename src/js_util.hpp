@@ -20,6 +20,7 @@
 
 #include "js_types.hpp"
 
+#include <cctype>
 #include <limits>
 #include <sstream>
 #include <stdexcept>
@@ -89,8 +90,44 @@ static inline T stot(const std::string& s)
     return value;
 }
 
+// Parses a JS property name as an array index without exceptions or stream
+// machinery. The proxy traps call this for every numeric property access, so
+// the common case — a plain digit string — must not pay for an istringstream
+// or an exception landing pad. Accepts the same shapes the stream parser did:
+// leading whitespace, an optional '+', and trailing characters after the
+// digits. Returns none for anything non-numeric or outside the 32-bit
+// unsigned range.
+static inline std::optional<uint32_t> try_parse_positive_index(const std::string& string) noexcept
+{
+    const char* p = string.c_str();
+    while (*p == ' ' || *p == '\t') {
+        ++p;
+    }
+    if (*p == '+') {
+        ++p;
+    }
+    if (!isdigit(static_cast<unsigned char>(*p))) {
+        return std::nullopt;
+    }
+    uint64_t index = 0;
+    do {
+        index = index * 10 + uint64_t(*p - '0');
+        if (index > std::numeric_limits<uint32_t>::max()) {
+            return std::nullopt;
+        }
+        ++p;
+    } while (isdigit(static_cast<unsigned char>(*p)));
+    return static_cast<uint32_t>(index);
+}
+
 static inline uint32_t validated_positive_index(std::string string)
 {
+    if (auto index = try_parse_positive_index(string)) {
+        return *index;
+    }
+    // Cold path: re-parse through the stream, which accepts a few more shapes
+    // (arbitrary leading whitespace, "-0") and picks the right error for the
+    // rest. stot() throws std::invalid_argument for non-numeric input.
     int64_t index = stot<int64_t>(string);
     if (index < 0) {
         throw std::out_of_range(std::string("Index ") + string + " cannot be less than zero.");
@@ -81,8 +81,24 @@ using StringPropertyType = js::StringPropertyType<Types>;
 using MethodMap = js::MethodMap<Types>;
 using PropertyMap = js::PropertyMap<Types>;
 
+// Private data for native property getter functions: the resolved callback
+// and the immortal cached name, bound once when the accessor is defined so
+// each access is a plain struct read instead of a JS property fetch plus a
+// string copy.
+struct NativePropertyGetterData {
+    JSObjectGetPropertyCallback getter;
+    jsc::String* name;
+};
+
 struct SchemaObjectType {
     JSObjectRef constructor;
+    // Prebuilt instantiation state for objects created without a user-defined
+    // constructor: one JSClassRef (carrying the schema's class name) and the
+    // protected prototype holding the schema accessors. With these in hand
+    // the hot path is a plain JSObjectMake plus one JSObjectSetPrototype
+    // instead of running the constructor-call machinery per instance.
+    JSClassRef objectClass = nullptr;
+    JSObjectRef prototype = nullptr;
 };
 
 template <typename ClassType>
@@ -262,19 +278,20 @@ template <typename ClassType>
 inline JSClassRef ObjectWrap<ClassType>::create_class()
 {
     JSClassDefinition definition = kJSClassDefinitionEmpty;
-    std::vector<JSStaticFunction> methods;
-    std::vector<JSStaticValue> properties;
 
     definition.parentClass = ObjectWrap<ParentClassType>::get_class();
     definition.className = s_class.name.c_str();
     definition.finalize = finalize;
 
+    // The tables only reference process-lifetime strings owned by s_class, so
+    // they are context-independent; build them once and let every context
+    // (and every React Native reload) share them.
+    static const std::vector<JSStaticFunction> methods = get_methods(s_class.methods);
+    static const std::vector<JSStaticValue> properties = get_properties(s_class.properties);
     if (!s_class.methods.empty()) {
-        methods = get_methods(s_class.methods);
         definition.staticFunctions = methods.data();
     }
     if (!s_class.properties.empty()) {
-        properties = get_properties(s_class.properties);
         definition.staticValues = properties.data();
     }
 
@@ -297,8 +314,6 @@ template <typename ClassType>
 inline JSClassRef ObjectWrap<ClassType>::create_constructor_class()
 {
     JSClassDefinition definition = kJSClassDefinitionEmpty;
-    std::vector<JSStaticFunction> methods;
-    std::vector<JSStaticValue> properties;
 
     definition.attributes = kJSClassAttributeNoAutomaticPrototype;
     definition.className = "Function";
@@ -311,12 +326,13 @@ inline JSClassRef ObjectWrap<ClassType>::create_constructor_class()
     if (reinterpret_cast<void*>(s_class.constructor)) {
         definition.callAsConstructor = construct;
     }
+    // Context-independent, like the instance tables in create_class.
+    static const std::vector<JSStaticFunction> methods = get_methods(s_class.static_methods);
+    static const std::vector<JSStaticValue> properties = get_properties(s_class.static_properties);
     if (!s_class.static_methods.empty()) {
-        methods = get_methods(s_class.static_methods);
         definition.staticFunctions = methods.data();
     }
     if (!s_class.static_properties.empty()) {
-        properties = get_properties(s_class.static_properties);
         definition.staticValues = properties.data();
     }
 
@@ -347,6 +363,9 @@ inline JSClassRef ObjectWrap<ClassType>::create_constructor_class()
         if (m_NativePropertyGetterClass == nullptr) {
             JSClassDefinition definition = kJSClassDefinitionEmpty;
             definition.callAsFunction = native_property_getter_callback;
+            definition.finalize = [](JSObjectRef object) {
+                delete static_cast<NativePropertyGetterData*>(JSObjectGetPrivate(object));
+            };
             m_NativePropertyGetterClass = JSClassCreate(&definition);
             m_NativePropertyGetterClass = JSClassRetain(m_NativePropertyGetterClass);
         }
@@ -403,6 +422,14 @@ inline void ObjectWrap<ClassType>::on_context_destroy(JSContextRef ctx, std::str
     for (auto it = schemaObjects->begin(); it != schemaObjects->end(); ++it) {
         JSValueUnprotect(ctx, it->second->constructor);
         it->second->constructor = nullptr;
+        if (it->second->prototype) {
+            JSValueUnprotect(ctx, it->second->prototype);
+            it->second->prototype = nullptr;
+        }
+        if (it->second->objectClass) {
+            JSClassRelease(it->second->objectClass);
+            it->second->objectClass = nullptr;
+        }
         SchemaObjectType* schemaObjecttype = it->second;
         delete schemaObjecttype;
     }
@@ -457,20 +484,15 @@ inline JSValueRef ObjectWrap<ClassType>::native_property_getter_callback(JSConte
 
     JSValueRef error = nullptr;
 
-    void* data = JSObjectGetPrivate(function);
-    JSValueRef value = JSObjectGetProperty(ctx, function, JSStringCreateWithUTF8CString("propertyName"), &error);
-    if (error) {
-        *exception = error;
-        return nullptr;
-    }
-    jsc::String propertyName = Value::to_string(ctx, value);
+    // The callback and the cached property name were bound to the function's
+    // private data when the accessor was defined; nothing is resolved per
+    // access.
+    auto* data = static_cast<NativePropertyGetterData*>(JSObjectGetPrivate(function));
 #ifdef DEBUG
-    std::string debugName = propertyName;
+    std::string debugName = *data->name;
 #endif
 
-    JSObjectGetPropertyCallback getterCallback = (JSObjectGetPropertyCallback)data;
-
-    JSValueRef result = getterCallback(ctx, thisObject, propertyName, &error);
+    JSValueRef result = data->getter(ctx, thisObject, *data->name, &error);
     if (error) {
         *exception = error;
         return nullptr;
@@ -493,20 +515,20 @@ void ObjectWrap<ClassType>::define_accessor_for_schema_property(JSContextRef ctx
     JSObjectRef getter = JSObjectMake(ctx, m_getterAccessorClass, name);
     JSObjectSetPrototype(ctx, getter, FunctionPrototype);
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("get"), getter, kJSPropertyAttributeReadOnly,
+    JSObjectSetProperty(ctx, descriptor, jsc::String::interned("get"), getter, kJSPropertyAttributeReadOnly,
                         &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
 
     JSObjectRef setter = JSObjectMake(ctx, m_setterAccessorClass, name);
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("set"), setter, kJSPropertyAttributeReadOnly,
+    JSObjectSetProperty(ctx, descriptor, jsc::String::interned("set"), setter, kJSPropertyAttributeReadOnly,
                         &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("enumerable"), Value::from_boolean(ctx, true),
+    JSObjectSetProperty(ctx, descriptor, jsc::String::interned("enumerable"), Value::from_boolean(ctx, true),
                         kJSPropertyAttributeReadOnly, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
@@ -525,15 +547,10 @@ void ObjectWrap<ClassType>::define_native_property_accessor(JSContextRef ctx, JS
     JSObjectRef descriptor = Object::create_empty(ctx);
     JSValueRef exception = nullptr;
 
-    JSObjectRef getter = JSObjectMake(ctx, m_NativePropertyGetterClass, (void*)getCallback);
+    JSObjectRef getter = JSObjectMake(ctx, m_NativePropertyGetterClass, new NativePropertyGetterData{getCallback, name});
     JSObjectSetPrototype(ctx, getter, FunctionPrototype);
-    JSObjectSetProperty(ctx, getter, JSStringCreateWithUTF8CString("propertyName"), Value::from_string(ctx, *name),
-                        kJSPropertyAttributeReadOnly, &exception);
-    if (exception) {
-        throw jsc::Exception(ctx, exception);
-    }
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("get"), getter, kJSPropertyAttributeReadOnly,
+    JSObjectSetProperty(ctx, descriptor, jsc::String::interned("get"), getter, kJSPropertyAttributeReadOnly,
                         &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
@@ -558,7 +575,9 @@ static jsc::String* get_cached_property_name(const std::string& name)
         return cachedName;
     }
 
-    jsc::String* result = new jsc::String(name);
+    // Retain the interned representation so the accessor machinery and the
+    // value layer share one immortal JSStringRef per property name.
+    jsc::String* result = new jsc::String(jsc::String::interned(name));
     propertyNamesCache.emplace(name, result);
     return result;
 }
@@ -568,22 +587,22 @@ static void define_function_property(JSContextRef ctx, JSObjectRef& target, cons
 {
     JSObjectRef descriptor = Object::create_empty(ctx);
 
-    JSObjectRef functionValue = JSObjectMakeFunctionWithCallback(ctx, JSStringCreateWithUTF8CString(name), callback);
+    JSObjectRef functionValue = JSObjectMakeFunctionWithCallback(ctx, jsc::String::interned(name), callback);
 
     JSValueRef exception = nullptr;
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("value"), functionValue,
+    JSObjectSetProperty(ctx, descriptor, jsc::String::interned("value"), functionValue,
                         kJSPropertyAttributeNone, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("writable"), Value::from_boolean(ctx, true),
+    JSObjectSetProperty(ctx, descriptor, jsc::String::interned("writable"), Value::from_boolean(ctx, true),
                         kJSPropertyAttributeNone, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
     }
 
-    JSObjectSetProperty(ctx, descriptor, JSStringCreateWithUTF8CString("configurable"),
+    JSObjectSetProperty(ctx, descriptor, jsc::String::interned("configurable"),
                         Value::from_boolean(ctx, true), kJSPropertyAttributeNone, &exception);
     if (exception) {
         throw jsc::Exception(ctx, exception);
@@ -605,6 +624,12 @@ static inline void remove_schema_object(JSContextRef ctx,
     SchemaObjectType* schemaObjectType = schemaObjects->at(schemaName);
     schemaObjects->erase(schemaName);
     JSValueUnprotect(ctx, schemaObjectType->constructor);
+    if (schemaObjectType->prototype) {
+        JSValueUnprotect(ctx, schemaObjectType->prototype);
+    }
+    if (schemaObjectType->objectClass) {
+        JSClassRelease(schemaObjectType->objectClass);
+    }
     delete schemaObjectType;
 }
 
@@ -614,7 +639,9 @@ typename ClassType::Internal* ObjectWrap<ClassType>::get_internal(JSContextRef c
     JSObjectRef instance = object;
     bool isRealmObjectClass = std::is_same<ClassType, realm::js::RealmObjectClass<realm::jsc::Types>>::value;
     if (isRealmObjectClass) {
-        const jsc::String* externalName = get_cached_property_name("_external");
+        // Resolved once: this runs for every property access on a RealmObject,
+        // so even the cache's hash lookup is worth skipping.
+        static const jsc::String* externalName = get_cached_property_name("_external");
         JSValueRef value = Object::get_property(ctx, object, *externalName);
         if (Value::is_undefined(ctx, value)) {
             return nullptr;
@@ -634,7 +661,7 @@ void ObjectWrap<ClassType>::set_internal_property(JSContextRef ctx, JSObjectRef&
     // create a JS object that has a finializer to delete the internal reference
     JSObjectRef internalObject = JSObjectMake(ctx, m_internalValueClass, new ObjectWrap<ClassType>(internal));
 
-    const jsc::String* externalName = get_cached_property_name("_external");
+    static const jsc::String* externalName = get_cached_property_name("_external");
     auto attributes = realm::js::PropertyAttributes::ReadOnly | realm::js::PropertyAttributes::DontDelete |
                       realm::js::PropertyAttributes::DontEnum;
     Object::set_property(ctx, instance, *externalName, internalObject, attributes);
@@ -718,7 +745,7 @@ inline void ObjectWrap<ClassType>::define_schema_properties(JSContextRef ctx, JS
     for (auto& property : schema.persisted_properties) {
         std::string propName = property.public_name.empty() ? property.name : property.public_name;
         if (redefine ||
-            !JSObjectHasProperty(ctx, constructorPrototype, JSStringCreateWithUTF8CString(propName.c_str()))) {
+            !JSObjectHasProperty(ctx, constructorPrototype, jsc::String::interned(propName))) {
             jsc::String* name = get_cached_property_name(propName);
             define_accessor_for_schema_property(ctx, constructorPrototype, name);
         }
@@ -727,7 +754,7 @@ inline void ObjectWrap<ClassType>::define_schema_properties(JSContextRef ctx, JS
     for (auto& property : schema.computed_properties) {
         std::string propName = property.public_name.empty() ? property.name : property.public_name;
         if (redefine ||
-            !JSObjectHasProperty(ctx, constructorPrototype, JSStringCreateWithUTF8CString(propName.c_str()))) {
+            !JSObjectHasProperty(ctx, constructorPrototype, jsc::String::interned(propName))) {
             jsc::String* name = get_cached_property_name(propName);
             define_accessor_for_schema_property(ctx, constructorPrototype, name);
         }
@@ -793,14 +820,21 @@ inline JSObjectRef ObjectWrap<ClassType>::create_instance_by_schema(JSContextRef
             schemaObjects->emplace(schemaName, schemaObjectType);
             JSValueProtect(ctx, schemaObjectConstructor);
             schemaObjectType->constructor = schemaObjectConstructor;
+            schemaObjectType->objectClass = schemaClass;
+            JSValueProtect(ctx, constructorPrototype);
+            schemaObjectType->prototype = constructorPrototype;
         }
         else {
-            // hot path. The constructor for this schema object is already cached.
+            // hot path. The class and prototype for this schema object are already cached.
             schemaObjectType = schemaObjects->at(schemaName);
-            schemaObjectConstructor = schemaObjectType->constructor;
         }
 
-        instance = Function::construct(ctx, schemaObjectConstructor, 0, {});
+        // Instantiate directly from the prebuilt per-schema class and attach
+        // the shared prototype; `instanceof` and `.constructor` resolve
+        // through the prototype chain exactly as with a constructed instance,
+        // but without the constructor-call machinery per object.
+        instance = JSObjectMake(ctx, schemaObjectType->objectClass, nullptr);
+        JSObjectSetPrototype(ctx, instance, schemaObjectType->prototype);
 
         // save the internal object on the instance
         set_internal_property(ctx, instance, internal);
@@ -850,16 +884,14 @@ inline JSObjectRef ObjectWrap<ClassType>::create_instance_by_schema(JSContextRef
             // setup all RealmObjectClass<T> methods to the prototype of the object
             for (auto& pair : s_class.methods) {
                 // don't redefine if exists
-                if (!JSObjectHasProperty(ctx, constructorPrototype,
-                                         JSStringCreateWithUTF8CString(pair.first.c_str()))) {
+                if (!JSObjectHasProperty(ctx, constructorPrototype, jsc::String::interned(pair.first))) {
                     define_function_property(ctx, constructorPrototype, pair.first.c_str(), pair.second);
                 }
             }
 
             for (auto& pair : s_class.properties) {
                 // don't redefine if exists
-                if (!JSObjectHasProperty(ctx, constructorPrototype,
-                                         JSStringCreateWithUTF8CString(pair.first.c_str()))) {
+                if (!JSObjectHasProperty(ctx, constructorPrototype, jsc::String::interned(pair.first))) {
                     jsc::String* name = get_cached_property_name(pair.first);
                     JSObjectGetPropertyCallback getterCallback = pair.second.getter;
                     define_native_property_accessor(ctx, constructorPrototype, name, getterCallback);
@@ -942,9 +974,18 @@ inline void ObjectWrap<ClassType>::initialize_constructor(JSContextRef ctx, JSOb
 {
     static const String prototype_string = "prototype";
 
-    // Set the prototype of the constructor to be Function.prototype.
-    Object::set_prototype(ctx, constructor,
-                          Object::get_prototype(ctx, JSObjectMakeFunctionWithCallback(ctx, nullptr, call)));
+    // Set the prototype of the constructor to be Function.prototype. The
+    // copy protected during context init is reused where available — this
+    // runs once per class per context, and materializing a throwaway
+    // function object each time just to reach its prototype added up across
+    // React Native reloads and headless task spin-ups.
+    if (FunctionPrototype) {
+        Object::set_prototype(ctx, constructor, FunctionPrototype);
+    }
+    else {
+        Object::set_prototype(ctx, constructor,
+                              Object::get_prototype(ctx, JSObjectMakeFunctionWithCallback(ctx, nullptr, call)));
+    }
 
     // Set the constructor prototype to be the prototype generated from the instance JSClassRef.
     JSObjectRef prototype =
@@ -77,6 +77,8 @@ void RJSInvalidateCaches()
     realm::js::notifications::NotificationBucket<jsc::Types, NotificationToken>::clear();
     realm::js::notifications::NotificationBucket<jsc::Types, Subscribable<realm::SyncUser>::Token>::clear();
     realm::js::notifications::NotificationBucket<jsc::Types, Subscribable<realm::app::App>::Token>::clear();
+    // Drop cached session wrappers, which hold Protected values tied to the released context
+    realm::js::SessionWrapperCache<jsc::Types>::clear();
 }
 
 // Note: This must be called before RJSInvalidateCaches, otherwise the app cache
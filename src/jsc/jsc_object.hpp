@@ -37,7 +37,10 @@ inline JSValueRef jsc::Object::get_property(JSContextRef ctx, const JSObjectRef&
 template <>
 inline JSValueRef jsc::Object::get_property(JSContextRef ctx, const JSObjectRef& object, StringData key)
 {
-    return get_property(ctx, object, jsc::String(key));
+    // Keys reaching this overload are almost always schema-derived names or
+    // fixed literals, so route them through the interning cache instead of
+    // creating and releasing a JSStringRef per lookup.
+    return get_property(ctx, object, jsc::String::intern(std::string(key)));
 }
 
 template <>
@@ -62,6 +65,16 @@ inline void jsc::Object::set_property(JSContextRef ctx, JSObjectRef& object, con
     }
 }
 
+template <>
+inline void jsc::Object::set_lazy_property(JSContextRef ctx, JSObjectRef object, const jsc::String& key,
+                                           LazyPropertyFactory factory)
+{
+    // JSC offers no native accessor hook for plain C callbacks here, so the
+    // factory runs eagerly; it installs the property itself.
+    std::string name = key;
+    factory(ctx, object, name);
+}
+
 template <>
 inline void jsc::Object::set_property(JSContextRef ctx, JSObjectRef& object, uint32_t index, const JSValueRef& value)
 {
@@ -107,6 +120,19 @@ inline JSObjectRef jsc::Object::create_empty(JSContextRef ctx)
     return JSObjectMake(ctx, nullptr, nullptr);
 }
 
+template <>
+inline JSObjectRef jsc::Object::create_obj(JSContextRef ctx,
+                                           std::initializer_list<std::pair<jsc::String, JSValueRef>> values)
+{
+    // JavaScriptCore has no batch property-definition API, so this stays one
+    // JSObjectSetProperty per field.
+    auto obj = create_empty(ctx);
+    for (auto&& [name, val] : values) {
+        set_property(ctx, obj, name, val);
+    }
+    return obj;
+}
+
 template <>
 inline JSObjectRef jsc::Object::create_array(JSContextRef ctx, uint32_t length, const JSValueRef values[])
 {
@@ -118,6 +144,34 @@ inline JSObjectRef jsc::Object::create_array(JSContextRef ctx, uint32_t length,
     return array;
 }
 
+template <>
+inline JSObjectRef jsc::Object::create_uint32_array(JSContextRef ctx, const std::vector<uint32_t>& values)
+{
+    JSValueRef exception = nullptr;
+    if (values.empty()) {
+        JSObjectRef array = JSObjectMakeTypedArray(ctx, kJSTypedArrayTypeUint32Array, 0, &exception);
+        if (exception) {
+            throw jsc::Exception(ctx, exception);
+        }
+        return array;
+    }
+
+    // hand a heap-owned copy to the typed array so no per-element boxing or
+    // copying happens on the JS side
+    auto* data = new std::vector<uint32_t>(values);
+    JSObjectRef array = JSObjectMakeTypedArrayWithBytesNoCopy(
+        ctx, kJSTypedArrayTypeUint32Array, data->data(), data->size() * sizeof(uint32_t),
+        [](void*, void* deallocatorContext) {
+            delete static_cast<std::vector<uint32_t>*>(deallocatorContext);
+        },
+        data, &exception);
+    if (exception) {
+        delete data;
+        throw jsc::Exception(ctx, exception);
+    }
+    return array;
+}
+
 template <>
 inline JSObjectRef jsc::Object::create_date(JSContextRef ctx, double time)
 {
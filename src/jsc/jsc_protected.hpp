@@ -124,6 +124,12 @@ public:
             if (a.m_context != b.m_context) {
                 return false;
             }
+            // Objects and functions keep a stable JSValueRef for their whole
+            // lifetime, so pointer equality answers the common removal-scan
+            // case without entering the VM.
+            if (a.m_value == b.m_value) {
+                return true;
+            }
             return JSValueIsStrictEqual(a.m_context, a.m_value, b.m_value);
         }
     };
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <optional>
+#include <string_view>
 
 #include "jsc_types.hpp"
 #include "jsc_string.hpp"
@@ -69,6 +70,25 @@ public:
     {
         m_value = Value<jsc::Types>::from_mixed(m_context, nullptr, mixed);
     }
+    // Typed direct-set paths mirroring the node ReturnValue: getter callbacks
+    // on hot property and index reads hand the engine-native value straight
+    // through without an intermediate conversion.
+    void set_prewrapped(const JSValueRef& value)
+    {
+        m_value = value;
+    }
+    void set_int64(int64_t number)
+    {
+        m_value = JSValueMakeNumber(m_context, static_cast<double>(number));
+    }
+    void set_bool(bool boolean)
+    {
+        m_value = JSValueMakeBoolean(m_context, boolean);
+    }
+    void set_string_view(std::string_view string)
+    {
+        m_value = JSValueMakeString(m_context, jsc::String(std::string(string)));
+    }
     void set_null()
     {
         m_value = JSValueMakeNull(m_context);
@@ -20,6 +20,9 @@
 
 #include "jsc_types.hpp"
 
+#include <string>
+#include <unordered_map>
+
 namespace realm {
 namespace js {
 
@@ -29,7 +32,48 @@ class String<jsc::Types> {
 
     JSStringRef m_str;
 
+    // JSStringRefs are context-independent, so one process-wide table serves
+    // every JSC context. Leaked deliberately (like the class machinery's
+    // property-name cache) because interned strings must outlive any context.
+    static std::unordered_map<std::string, JSStringRef>& interned_map()
+    {
+        static auto& s_interned = *new std::unordered_map<std::string, JSStringRef>;
+        return s_interned;
+    }
+
 public:
+    /// Returns an immortal `JSStringRef` for `name`, creating it on first use.
+    /// Callers must only pass names with process-lifetime vocabulary — schema
+    /// property/class names and fixed literals — since entries are never
+    /// released. Saves the JSStringCreate/Release pair on every hot conversion.
+    static JSStringRef interned(const std::string& name)
+    {
+        auto& map = interned_map();
+        auto it = map.find(name);
+        if (it == map.end()) {
+            it = map.emplace(name, JSStringCreateWithUTF8CString(name.c_str())).first;
+        }
+        return it->second;
+    }
+
+    /// Capped front door to the interning cache for keys of unknown
+    /// provenance (e.g. arbitrary object keys reaching the generic object
+    /// layer): once the cache is full, unseen names get a transient string so
+    /// user data cannot grow the table without bound.
+    static StringType intern(const std::string& name)
+    {
+        static constexpr size_t s_max_interned = 512;
+        auto& map = interned_map();
+        auto it = map.find(name);
+        if (it != map.end()) {
+            return StringType(it->second);
+        }
+        if (map.size() >= s_max_interned) {
+            return StringType(name);
+        }
+        return StringType(map.emplace(name, JSStringCreateWithUTF8CString(name.c_str())).first->second);
+    }
+
     static bson::Bson to_bson(StringType stringified_ejson)
     {
         return bson::parse(std::string(stringified_ejson));
@@ -79,6 +123,15 @@ public:
     operator std::string() const
     {
         size_t max_size = JSStringGetMaximumUTF8CStringSize(m_str);
+        if (max_size <= 128) {
+            // Short strings — type names, keys — go through a stack buffer so
+            // the returned std::string is allocated at the actual UTF-8 length
+            // (or not at all, when it fits the small-string optimization)
+            // instead of JSC's 3-bytes-per-code-unit worst case.
+            char stack_buffer[128];
+            size_t size = JSStringGetUTF8CString(m_str, stack_buffer, max_size) - 1;
+            return std::string(stack_buffer, size);
+        }
         std::string string;
         string.resize(max_size);
         string.resize(JSStringGetUTF8CString(m_str, &string[0], max_size) - 1);
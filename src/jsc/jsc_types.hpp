@@ -21,6 +21,7 @@
 #include <JavaScriptCore/JSContextRef.h>
 #include <JavaScriptCore/JSObjectRef.h>
 #include <JavaScriptCore/JSStringRef.h>
+#include <JavaScriptCore/JSTypedArray.h>
 
 #define HANDLESCOPE(context)
 
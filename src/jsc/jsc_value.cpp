@@ -164,6 +164,15 @@ OwnedBinaryData jsc::Value::to_binary(JSContextRef ctx, const JSValueRef& value)
     return OwnedBinaryData(std::move(buffer), byte_count);
 }
 
+template <>
+BinaryData jsc::Value::to_binary_view(JSContextRef ctx, const JSValueRef& value, OwnedBinaryData& storage)
+{
+    // JSC gives no stable borrowed pointer through the JSValue API used here,
+    // so fall back to copying into the caller-provided storage and viewing it.
+    storage = to_binary(ctx, value);
+    return storage.get();
+}
+
 template <>
 Decimal128 jsc::Value::to_decimal128(JSContextRef ctx, const JSValueRef& value)
 {
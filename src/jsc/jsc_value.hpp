@@ -290,6 +290,32 @@ inline jsc::String jsc::Value::to_string(JSContextRef ctx, const JSValueRef& val
     return string;
 }
 
+template <>
+inline void jsc::Value::to_string_buffer(JSContextRef ctx, const JSValueRef& value, std::string& out)
+{
+    JSValueRef exception = nullptr;
+    jsc::String string = JSValueToStringCopy(ctx, value, &exception);
+
+    // Since the string's retain value is +2 here, we need to manually release it before returning.
+    JSStringRelease(string);
+
+    if (exception) {
+        throw jsc::Exception(ctx, exception);
+    }
+
+    size_t max_size = JSStringGetMaximumUTF8CStringSize(string);
+    if (max_size <= 128) {
+        // Decode short strings through a stack buffer so `out` is sized to
+        // the actual UTF-8 length, not JSC's worst-case estimate.
+        char stack_buffer[128];
+        size_t size = JSStringGetUTF8CString(string, stack_buffer, max_size) - 1;
+        out.assign(stack_buffer, size);
+        return;
+    }
+    out.resize(max_size);
+    out.resize(JSStringGetUTF8CString(string, &out[0], max_size) - 1);
+}
+
 template <>
 inline double jsc::Value::to_number(JSContextRef ctx, const JSValueRef& value)
 {
@@ -22,11 +22,13 @@
 #include <functional>
 #include <future>
 #include <thread>
+#include <tuple>
 
 #include "rpc.hpp"
 #include "jsc_init.hpp"
 
 #include <realm/util/base64.hpp>
+#include "js_base64.hpp"
 #include <realm/object-store/object_accessor.hpp>
 #include <realm/object-store/shared_realm.hpp>
 #include <realm/object-store/results.hpp>
@@ -69,6 +71,7 @@ public:
     bool try_run_task();
     void stop();
     json try_pop_callback();
+    json try_pop_all_callbacks();
     bool should_stop();
 
 private:
@@ -83,6 +86,98 @@ private:
     ConcurrentDeque<json> m_callbacks;
 };
 
+// Slot-based handle table for RPC object ids. An id encodes a slot index in
+// its low 32 bits and a per-slot generation in the bits above (offset by one
+// so no id is ever 0, which the JS client treats as "no id"). Resolution is
+// a bounds check plus an array index instead of a map lookup, and stale ids
+// from disposed objects fail the generation comparison rather than
+// resolving to a recycled slot.
+class RPCObjectTable {
+public:
+    RPCObjectID store(js::Protected<JSObjectRef> object)
+    {
+        uint32_t slot;
+        if (!m_free_slots.empty()) {
+            slot = m_free_slots.back();
+            m_free_slots.pop_back();
+        }
+        else {
+            slot = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+        Slot& entry = m_slots[slot];
+        entry.object = std::move(object);
+        entry.occupied = true;
+        return (RPCObjectID(entry.generation) << 32 | slot) + 1;
+    }
+
+    JSObjectRef get(RPCObjectID id) const
+    {
+        const Slot* entry = resolve(id);
+        return entry ? static_cast<JSObjectRef>(entry->object) : nullptr;
+    }
+
+    void erase(RPCObjectID id)
+    {
+        if (resolve(id)) {
+            release_slot(static_cast<uint32_t>((id - 1) & 0xffffffff));
+        }
+    }
+
+    void clear()
+    {
+        for (uint32_t slot = 0; slot < m_slots.size(); slot++) {
+            if (m_slots[slot].occupied) {
+                release_slot(slot);
+            }
+        }
+    }
+
+    void clear_except(RPCObjectID keep)
+    {
+        uint32_t keep_slot = static_cast<uint32_t>((keep - 1) & 0xffffffff);
+        for (uint32_t slot = 0; slot < m_slots.size(); slot++) {
+            if (m_slots[slot].occupied && !(slot == keep_slot && resolve(keep))) {
+                release_slot(slot);
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        js::Protected<JSObjectRef> object;
+        uint32_t generation = 0;
+        bool occupied = false;
+    };
+
+    const Slot* resolve(RPCObjectID id) const
+    {
+        if (!id) {
+            return nullptr;
+        }
+        uint64_t encoded = id - 1;
+        uint32_t slot = static_cast<uint32_t>(encoded & 0xffffffff);
+        uint32_t generation = static_cast<uint32_t>(encoded >> 32);
+        if (slot >= m_slots.size() || !m_slots[slot].occupied || m_slots[slot].generation != generation) {
+            return nullptr;
+        }
+        return &m_slots[slot];
+    }
+
+    void release_slot(uint32_t slot)
+    {
+        Slot& entry = m_slots[slot];
+        entry.object = js::Protected<JSObjectRef>();
+        entry.occupied = false;
+        // Bounded so ids stay below 2^53 and survive JSON number transport.
+        entry.generation = (entry.generation + 1) & 0x1fffff;
+        m_free_slots.push_back(slot);
+    }
+
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_free_slots;
+};
+
 class RPCServerImpl {
 public:
     RPCServerImpl();
@@ -94,7 +189,7 @@ private:
     JSGlobalContextRef m_context;
     std::mutex m_request_mutex;
     std::map<std::string, RPCRequest> m_requests;
-    std::map<RPCObjectID, js::Protected<JSObjectRef>> m_objects;
+    RPCObjectTable m_objects;
     std::map<RPCObjectID, js::Protected<JSObjectRef>> m_callbacks;
     // The key here is the same as the value in m_callbacks. We use the raw pointer as a key here,
     // because protecting the value in m_callbacks pins the function object and prevents it from being moved
@@ -117,6 +212,20 @@ private:
     JSObjectRef get_object(RPCObjectID) const;
     JSObjectRef get_realm_constructor() const;
 
+    // Whether the host transport can carry binary bodies, and whether the
+    // client negotiated the MessagePack wire format via the "/msgpack"
+    // request; binary values then bypass base64.
+    bool m_binary_wire_supported = false;
+    bool m_binary_wire = false;
+
+public:
+    void enable_binary_wire_support()
+    {
+        m_binary_wire_supported = true;
+    }
+
+private:
+
     json serialize_json_value(JSValueRef value);
     JSValueRef deserialize_json_value(const json dict);
 };
@@ -258,6 +367,18 @@ json RPCWorker::try_pop_callback()
     return cb ? *cb : json::object();
 }
 
+json RPCWorker::try_pop_all_callbacks()
+{
+    json callbacks = json::array();
+    while (auto cb = m_callbacks.try_pop_back(0)) {
+        callbacks.push_back(std::move(*cb));
+    }
+    if (callbacks.empty()) {
+        return json::object();
+    }
+    return {{"callbacks", std::move(callbacks)}};
+}
+
 bool RPCWorker::try_run_task()
 {
     if (m_stop) {
@@ -290,6 +411,19 @@ void RPCWorker::stop()
     }
 }
 
+// Serialized property caches, memoized per (realm, table, object) at the data
+// version they were read from. Within one read-transaction version an
+// object's values cannot change, so a debugger pausing repeatedly on
+// unchanged objects reuses the JSON instead of re-reading every column; a
+// version advance is the only way values change, so it doubles as the
+// dirtiness signal. Cleared with the rest of the session state.
+struct ObjectPropertiesCacheEntry {
+    uint64_t version = 0;
+    json properties;
+};
+using ObjectPropertiesCacheKey = std::tuple<const void*, uint32_t, int64_t>;
+static std::map<ObjectPropertiesCacheKey, ObjectPropertiesCacheEntry> s_object_properties_cache;
+
 static json read_object_properties(Object& object)
 {
     json cache;
@@ -297,10 +431,18 @@ static json read_object_properties(Object& object)
         return cache;
     }
 
+    auto obj = object.obj();
+    uint64_t version = object.realm()->read_transaction_version().version;
+    ObjectPropertiesCacheKey cache_key{static_cast<const void*>(object.realm().get()),
+                                       obj.get_table()->get_key().value, obj.get_key().value};
+    auto& entry = s_object_properties_cache[cache_key];
+    if (entry.version == version && entry.properties.is_object()) {
+        return entry.properties;
+    }
+
     // Send the values of the primitive and short string properties directly
     // as the overhead of doing so is tiny compared to even a single RPC request
     auto& object_schema = object.get_object_schema();
-    auto obj = object.obj();
     for (auto& property : object_schema.persisted_properties) {
         if (is_array(property.type)) {
             continue;
@@ -360,6 +502,9 @@ static json read_object_properties(Object& object)
                 REALM_UNREACHABLE();
         }
     }
+
+    entry.version = version;
+    entry.properties = cache;
     return cache;
 }
 
@@ -399,8 +544,15 @@ RPCServerImpl::RPCServerImpl()
         RPCNetworkTransport::fetch_function = js::Protected(m_context, fetch_function);
 
         m_session_id = store_object(realm_constructor);
+        // Each session starts on the JSON wire until the client negotiates
+        // otherwise; a reloaded client must not inherit binary mode.
+        m_binary_wire = false;
         return (json){{"result", m_session_id}};
     };
+    m_requests["/msgpack"] = [this](const json dict) {
+        m_binary_wire = m_binary_wire_supported;
+        return (json){{"result", m_binary_wire}};
+    };
     m_requests["/create_realm"] = [this](const json dict) {
         JSObjectRef realm_constructor = get_realm_constructor();
 
@@ -571,12 +723,7 @@ RPCServerImpl::RPCServerImpl()
     };
     m_requests["/clear_test_state"] = [this](const json dict) {
         // The session ID points to the Realm constructor object, which should remain.
-        auto realm_constructor = m_objects[m_session_id];
-        m_objects.clear();
-
-        if (realm_constructor) {
-            m_objects.emplace(m_session_id, realm_constructor);
-        }
+        m_objects.clear_except(m_session_id);
 
         // The JS side of things only gives us the fetch function callback
         // when creating a session so we need to hold onto it.
@@ -587,6 +734,7 @@ RPCServerImpl::RPCServerImpl()
         m_callbacks[0] = fetch_function;
         m_callback_ids[fetch_function] = 0;
         ++m_reset_counter;
+        s_object_properties_cache.clear();
         JSGarbageCollect(m_context);
         js::clear_test_state();
 
@@ -780,6 +928,7 @@ RPCServerImpl::~RPCServerImpl()
     // The protected values should be unprotected before releasing the context.
     m_objects.clear();
     m_callbacks.clear();
+    s_object_properties_cache.clear();
 
     // Restore the previous transport generator
     AppClass::transport_generator = previous_transport_generator;
@@ -864,6 +1013,20 @@ JSValueRef RPCServerImpl::run_callback(JSContextRef ctx, JSObjectRef function, J
 
 json RPCServerImpl::perform_request(std::string const& name, json&& args)
 {
+    // A batch executes several independent requests from one transport
+    // round-trip, which is what makes the debugger's bursts of property
+    // reads bearable. It is handled before taking the request lock because
+    // every entry re-enters perform_request and locks for itself.
+    if (name == "/batch") {
+        json results = json::array();
+        for (auto& entry : args["requests"]) {
+            json entry_args = entry["args"];
+            entry_args["sessionId"] = args["sessionId"];
+            results.push_back(perform_request("/" + entry["name"].get<std::string>(), std::move(entry_args)));
+        }
+        return {{"result", std::move(results)}};
+    }
+
     std::lock_guard<std::mutex> lock(m_request_mutex);
 
     // Only create_session is allowed without the correct session id (since it creates the session id).
@@ -871,13 +1034,13 @@ json RPCServerImpl::perform_request(std::string const& name, json&& args)
         return {{"error", "Invalid session ID"}};
     }
 
-    auto resolve_callback = [&] {
-        auto callback_id = args["callback"].get<uint64_t>();
-        auto callback_counter = args["callback_call_counter"].get<uint64_t>();
+    auto resolve_callback = [&](json const& result) {
+        auto callback_id = result["callback"].get<uint64_t>();
+        auto callback_counter = result["callback_call_counter"].get<uint64_t>();
         std::lock_guard<std::mutex> lock(m_pending_callbacks_mutex);
         auto cb = m_pending_callbacks.find({callback_id, callback_counter});
         if (cb != m_pending_callbacks.end()) {
-            cb->second.set_value(args);
+            cb->second.set_value(result);
             m_pending_callbacks.erase(cb);
         }
     };
@@ -885,15 +1048,25 @@ json RPCServerImpl::perform_request(std::string const& name, json&& args)
     // The callback_result message contains the return value (or exception) of a callback ran by run_callback().
     if (name == "/callback_result") {
         std::future<json> result = m_worker.add_promise();
-        resolve_callback();
+        resolve_callback(args);
         return result.get();
     }
     if (name == "/callback_poll_result") {
-        resolve_callback();
+        resolve_callback(args);
         return m_worker.try_pop_callback();
     }
+    // Batched flush of the poll chain: every entry resolves one pending
+    // run_callback() future, and the reply carries the next batch, so a burst
+    // of queued notification callbacks costs one round-trip per flush instead
+    // of one per callback.
+    if (name == "/callback_poll_results") {
+        for (auto& result : args["results"]) {
+            resolve_callback(result);
+        }
+        return m_worker.try_pop_all_callbacks();
+    }
     if (name == "/callbacks_poll") {
-        return m_worker.try_pop_callback();
+        return m_worker.try_pop_all_callbacks();
     }
 
     RPCRequest* action = &m_requests[name];
@@ -931,17 +1104,12 @@ bool RPCServerImpl::try_run_task()
 
 RPCObjectID RPCServerImpl::store_object(JSObjectRef object)
 {
-    static RPCObjectID s_next_id = 1;
-
-    RPCObjectID next_id = s_next_id++;
-    m_objects.emplace(next_id, js::Protected<JSObjectRef>(m_context, object));
-    return next_id;
+    return m_objects.store(js::Protected<JSObjectRef>(m_context, object));
 }
 
 JSObjectRef RPCServerImpl::get_object(RPCObjectID oid) const
 {
-    auto it = m_objects.find(oid);
-    return it == m_objects.end() ? nullptr : static_cast<JSObjectRef>(it->second);
+    return m_objects.get(oid);
 }
 
 JSObjectRef RPCServerImpl::get_realm_constructor() const
@@ -1072,9 +1240,18 @@ json RPCServerImpl::serialize_json_value(JSValueRef js_value)
     else if (jsc::Value::is_binary(m_context, js_object)) {
         auto data = jsc::Value::to_binary(m_context, js_object);
 
+        if (m_binary_wire) {
+            // MessagePack carries raw bytes natively, so skip base64.
+            auto bytes = reinterpret_cast<const uint8_t*>(data.data());
+            return {
+                {"type", RealmObjectTypesData},
+                {"value", json::binary(std::vector<uint8_t>(bytes, bytes + data.size()))},
+            };
+        }
+
         std::string encoded;
         encoded.reserve(realm::util::base64_encoded_size(data.size()));
-        encoded.resize(realm::util::base64_encode(data.data(), data.size(), encoded.data(), encoded.capacity()));
+        encoded.resize(js::base64::encode(data.data(), data.size(), encoded.data(), encoded.capacity()));
 
         return {
             {"type", RealmObjectTypesData},
@@ -1130,7 +1307,7 @@ JSValueRef RPCServerImpl::deserialize_json_value(const json dict)
 {
     json oid = dict.value("id", json());
     if (oid.is_number()) {
-        return m_objects[oid.get<RPCObjectID>()];
+        return m_objects.get(oid.get<RPCObjectID>());
     }
 
     json value = dict.value("value", json());
@@ -1165,7 +1342,12 @@ JSValueRef RPCServerImpl::deserialize_json_value(const json dict)
             return js_object;
         }
         else if (type_string == RealmObjectTypesData) {
-            auto bytes = realm::util::base64_decode_to_vector(value.get<std::string>());
+            if (value.is_binary()) {
+                auto& binary = value.get_binary();
+                return jsc::Value::from_binary(
+                    m_context, realm::BinaryData(reinterpret_cast<const char*>(binary.data()), binary.size()));
+            }
+            auto bytes = js::base64::decode_to_vector(value.get<std::string>());
             if (!bytes) {
                 throw std::runtime_error("Failed to decode base64 encoded data");
             }
@@ -1229,6 +1411,21 @@ std::string RPCServer::perform_request(std::string const& name, std::string cons
     return m_impl->perform_request(name, json::parse(json_args)).dump();
 }
 
+std::string RPCServer::perform_request(const char* name, const char* json_args)
+{
+    return m_impl->perform_request(name, json::parse(json_args)).dump();
+}
+
+std::vector<uint8_t> RPCServer::perform_request_msgpack(std::string const& name, const uint8_t* data, size_t size)
+{
+    return json::to_msgpack(m_impl->perform_request(name, json::from_msgpack(data, data + size)));
+}
+
+void RPCServer::enable_binary_wire_support()
+{
+    m_impl->enable_binary_wire_support();
+}
+
 bool RPCServer::try_run_task()
 {
     return m_impl->try_run_task();
@@ -18,8 +18,10 @@
 
 #pragma once
 
-#include <string>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace realm {
 namespace rpc {
@@ -30,6 +32,18 @@ public:
     RPCServer();
     ~RPCServer();
     std::string perform_request(std::string const& name, std::string const& json_args);
+    // Variant for hosts that receive the request as raw C strings (the
+    // Android JNI bridge): the args — megabytes for large writes — are parsed
+    // in place instead of being copied into a std::string first.
+    std::string perform_request(const char* name, const char* json_args);
+    // Binary (MessagePack) variant of perform_request. Clients opt in by
+    // sending the "/msgpack" request after creating a session; from then on
+    // binary payloads are carried as raw bytes instead of base64-in-JSON.
+    std::vector<uint8_t> perform_request_msgpack(std::string const& name, const uint8_t* data, size_t size);
+    // Hosts whose transport can carry binary bodies (currently the iOS
+    // GCDWebServer host) call this once; without it the "/msgpack"
+    // negotiation request is declined and the wire stays JSON.
+    void enable_binary_wire_support();
     bool try_run_task();
 
 private:
@@ -17,10 +17,18 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #pragma once
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <memory>
-#include <queue>
+#include <mutex>
+#include <unordered_map>
 
+#include <realm/util/file.hpp>
 #include <realm/util/logger.hpp>
 #include <realm/object-store/sync/sync_manager.hpp> // SyncLoggerFactory
 #include <realm/object-store/util/scheduler.hpp>    // realm::util::Scheduler
@@ -35,6 +43,19 @@ namespace logger {
 
 using LoggerLevel = realm::util::Logger::Level;
 
+// Log categories the JS delegate can subscribe to. Core logs the whole sync
+// client through one logger, prefixing each line with its origin
+// ("Connection[1]: ...", "Connection[1]: Session[2]: ..."), so the binding
+// classifies on that prefix. Lines in unsubscribed categories are dropped on
+// the producer thread before any allocation, queueing or event-loop wakeup.
+enum LogCategory : unsigned {
+    category_connection = 1,
+    category_session = 2,
+    category_changeset = 4,
+    category_other = 8,
+    category_all = category_connection | category_session | category_changeset | category_other,
+};
+
 // TODO we are coupling core with JS Land here, change to string.
 using Entry = std::pair<LoggerLevel, std::string>;
 using Delegated = std::function<void(int, std::string)>;
@@ -70,46 +91,268 @@ class IOSLogger {
 };
 #endif
 
+// Classifies a formatted sync-client line into a LogCategory by its origin
+// prefix ("Connection[1]: ...", "Connection[1]: Session[2]: ...").
+inline unsigned classify(const std::string& message) noexcept
+{
+    if (message.compare(0, 11, "Connection[") != 0)
+        return category_other;
+    auto session_pos = message.find("Session[", 11);
+    if (session_pos == std::string::npos)
+        return category_connection;
+    if (message.find("hangeset", session_pos) != std::string::npos)
+        return category_changeset;
+    return category_session;
+}
+
+/**
+ * @brief Binary structured log sink: fixed-size records in a memory-mapped
+ * ring file, decoded offline by `scripts/decode-binary-log.js`.
+ *
+ * Made for continuous trace-level logging of the sync client in production,
+ * where formatting text (and shipping it across to JS) is too expensive to
+ * leave on. Each line becomes one 32-byte record — wall-clock timestamp,
+ * level, category, an interned message-template id and the line's first two
+ * integer scalars — written straight into the mapping with no allocation and
+ * no event-loop involvement. The OS flushes the dirty pages even if the
+ * process crashes, which is the point: the ring is a postmortem artifact.
+ *
+ * Core formats the line before handing it to `do_log`, so the formatting
+ * itself cannot be skipped from this side of the API; what the sink removes
+ * is everything the binding adds on top (per-line allocation, queueing, JS
+ * delivery). Templates are recovered by collapsing digit runs to `#`, which
+ * also yields the scalar args; templates are interned once into a `.strings`
+ * side file next to the ring.
+ *
+ * File layout, all integers little-endian:
+ *   64-byte header: "RJBL" magic, u32 format version, u64 record capacity,
+ *   u64 monotonic write cursor (slot = cursor % capacity), rest reserved.
+ *   Then capacity * 32-byte records: u64 timestamp (ns since Unix epoch),
+ *   u64 arg0, u64 arg1, u32 template id, u8 level, u8 category, u16 unused.
+ * A record racing a crash may be torn; the decoder tolerates that.
+ */
+class BinaryLogSink {
+public:
+    BinaryLogSink(const std::string& path, uint64_t max_bytes)
+        : m_strings(path + ".strings", std::ios::trunc)
+    {
+        m_capacity = max_bytes > s_header_size ? (max_bytes - s_header_size) / sizeof(Record) : 0;
+        if (m_capacity < s_min_records)
+            m_capacity = s_min_records;
+        size_t size = s_header_size + size_t(m_capacity) * sizeof(Record);
+
+        m_file.open(path, util::File::mode_Write);
+        m_file.resize(size);
+        m_map = util::File::Map<char>(m_file, util::File::access_ReadWrite, size);
+
+        char* addr = m_map.get_addr();
+        std::memset(addr, 0, s_header_size);
+        std::memcpy(addr, "RJBL", 4);
+        uint32_t version = 1;
+        std::memcpy(addr + 4, &version, sizeof(version));
+        std::memcpy(addr + 8, &m_capacity, sizeof(m_capacity));
+        // The cursor lives in the mapping itself so the decoder can find the
+        // ring's oldest record after a crash. std::atomic<uint64_t> is
+        // layout-compatible with the plain u64 the header documents.
+        m_cursor = reinterpret_cast<std::atomic<uint64_t>*>(addr + 16);
+        m_cursor->store(0, std::memory_order_relaxed);
+        m_records = reinterpret_cast<Record*>(addr + s_header_size);
+    }
+
+    void log(LoggerLevel level, unsigned category, const std::string& message)
+    {
+        uint64_t arg0 = 0, arg1 = 0;
+        uint32_t template_id = intern(message, arg0, arg1);
+
+        uint64_t slot = m_cursor->fetch_add(1, std::memory_order_relaxed) % m_capacity;
+        Record& record = m_records[slot];
+        record.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::system_clock::now().time_since_epoch())
+                                  .count();
+        record.arg0 = arg0;
+        record.arg1 = arg1;
+        record.template_id = template_id;
+        record.level = static_cast<uint8_t>(level);
+        record.category = static_cast<uint8_t>(category);
+        record.unused = 0;
+    }
+
+private:
+    struct Record {
+        uint64_t timestamp_ns;
+        uint64_t arg0;
+        uint64_t arg1;
+        uint32_t template_id;
+        uint8_t level;
+        uint8_t category;
+        uint16_t unused;
+    };
+    static_assert(sizeof(Record) == 32, "record layout is part of the file format");
+
+    static constexpr size_t s_header_size = 64;
+    static constexpr uint64_t s_min_records = 1024;
+
+    // Collapses every digit run in the line to `#`, capturing the first two
+    // runs as the record's scalar args, and interns the result. The hot path
+    // for a known template is one stack-buffer pass and one map lookup; only
+    // a first occurrence touches the side file.
+    uint32_t intern(const std::string& message, uint64_t& arg0, uint64_t& arg1)
+    {
+        char buf[512];
+        size_t out = 0;
+        int args_seen = 0;
+        for (size_t i = 0; i < message.size() && out < sizeof(buf); i++) {
+            unsigned char c = message[i];
+            if (!std::isdigit(c)) {
+                buf[out++] = char(c);
+                continue;
+            }
+            uint64_t value = 0;
+            while (i < message.size() && std::isdigit(static_cast<unsigned char>(message[i]))) {
+                value = value * 10 + uint64_t(message[i] - '0');
+                i++;
+            }
+            i--;
+            if (args_seen == 0)
+                arg0 = value;
+            else if (args_seen == 1)
+                arg1 = value;
+            args_seen++;
+            buf[out++] = '#';
+        }
+
+        std::lock_guard<std::mutex> lock(m_intern_mutex);
+        auto [it, inserted] = m_templates.emplace(std::string(buf, out), m_next_template_id);
+        if (inserted) {
+            m_next_template_id++;
+            m_strings << it->second << '\t' << it->first << '\n';
+            m_strings.flush();
+        }
+        return it->second;
+    }
+
+    util::File m_file;
+    util::File::Map<char> m_map;
+    std::atomic<uint64_t>* m_cursor = nullptr;
+    Record* m_records = nullptr;
+    uint64_t m_capacity = 0;
+
+    std::mutex m_intern_mutex;
+    std::unordered_map<std::string, uint32_t> m_templates;
+    uint32_t m_next_template_id = 0;
+    std::ofstream m_strings;
+};
+
 class SyncLoggerDelegator : public util::RootLogger {
 public:
     SyncLoggerDelegator() = delete;
-    SyncLoggerDelegator(Delegated&& delegate)
-        : loggerDelegate(delegate){};
+    SyncLoggerDelegator(Delegated&& delegate, unsigned category_mask = category_all)
+        : loggerDelegate(delegate)
+        , m_category_mask(category_mask){};
+
+    ~SyncLoggerDelegator()
+    {
+        free_entries(m_head.exchange(nullptr, std::memory_order_acquire));
+    }
 
     void delegate() {}
 
 protected:
     void do_log(LoggerLevel level, const std::string& message)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        // TODO we are coupling core with JS here, change to string use hashmap
-        // map_level.
-        auto entry = std::make_pair(level, message);
-
-        m_log_queue.push(entry);
-        m_scheduler->invoke([this] {
-            std::queue<Entry> popped;
-            {
-                std::lock_guard<std::mutex> lock(m_mutex); // Throws
-                popped.swap(m_log_queue);
-            }
+        // Drop lines in categories the delegate did not subscribe to before
+        // anything is allocated or the event loop is woken. With the default
+        // all-categories mask the line is never even classified.
+        if (m_category_mask != category_all && !(classify(message) & m_category_mask))
+            return;
 
-            while (!popped.empty()) {
-                Entry& entry = popped.front();
-                loggerDelegate(static_cast<int>(entry.first), entry.second);
-                popped.pop();
-            }
-        });
+        // Core has already applied the level threshold and formatted the
+        // message before calling us, so all that is left here is handing the
+        // line to JS. Producers push onto a lock-free MPSC list — sync client
+        // threads never contend on a mutex with each other or with the
+        // drain — and the event loop is only woken once per burst: the first
+        // push after a drain schedules it, every further push before the
+        // drain runs is picked up for free.
+        LogEntry* entry = new LogEntry{level, message, m_head.load(std::memory_order_relaxed)};
+        while (!m_head.compare_exchange_weak(entry->next, entry, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+        }
+
+        if (!m_drain_scheduled.exchange(true, std::memory_order_seq_cst)) {
+            m_scheduler->invoke([this] {
+                drain();
+            });
+        }
     }
 
 private:
-    std::queue<Entry> m_log_queue;
+    struct LogEntry {
+        LoggerLevel level;
+        std::string message;
+        LogEntry* next;
+    };
+
+    void drain()
+    {
+        // Clearing the flag before taking the list means a push racing with
+        // this drain either lands on the list we are about to take or sees
+        // the cleared flag and schedules the next drain itself.
+        m_drain_scheduled.store(false, std::memory_order_seq_cst);
+        LogEntry* entry = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        // Producers push LIFO; reverse to deliver in chronological order.
+        LogEntry* chronological = nullptr;
+        while (entry) {
+            LogEntry* next = entry->next;
+            entry->next = chronological;
+            chronological = entry;
+            entry = next;
+        }
+
+        // The whole burst is delivered inside this one event-loop wakeup.
+        while (chronological) {
+            LogEntry* next = chronological->next;
+            loggerDelegate(static_cast<int>(chronological->level), std::move(chronological->message));
+            delete chronological;
+            chronological = next;
+        }
+    }
+
+    static void free_entries(LogEntry* entry)
+    {
+        while (entry) {
+            LogEntry* next = entry->next;
+            delete entry;
+            entry = next;
+        }
+    }
+
+    std::atomic<LogEntry*> m_head{nullptr};
+    const unsigned m_category_mask;
+    std::atomic<bool> m_drain_scheduled{false};
     std::shared_ptr<util::Scheduler> m_scheduler = util::Scheduler::make_default();
-    std::mutex m_mutex;
     Delegated loggerDelegate;
 };
 
+// Logger that feeds a BinaryLogSink instead of a JS delegate. do_log runs
+// entirely on the producer thread: classify, normalize, write one record.
+class BinarySinkLogger : public util::RootLogger {
+public:
+    explicit BinarySinkLogger(std::shared_ptr<BinaryLogSink> sink)
+        : m_sink(std::move(sink))
+    {
+    }
+
+protected:
+    void do_log(LoggerLevel level, const std::string& message)
+    {
+        m_sink->log(level, classify(message), message);
+    }
+
+private:
+    std::shared_ptr<BinaryLogSink> m_sink;
+};
+
 class Logger {
 private:
     // Warning: If this grows to big (for example: another method) we should
@@ -126,6 +369,13 @@ private:
         {LoggerLevel::error, "error"}, {LoggerLevel::fatal, "fatal"},   {LoggerLevel::off, "off"},
     };
 
+    const static inline std::map<unsigned, std::string> map_category = {
+        {category_connection, "connection"},
+        {category_session, "session"},
+        {category_changeset, "changeset"},
+        {category_other, "other"},
+    };
+
 public:
     static LoggerLevel get_level(const std::string level)
     {
@@ -137,10 +387,34 @@ public:
         throw std::runtime_error("Bad log level");
     }
 
-    static SyncClientConfig::LoggerFactory build_sync_logger(Delegated&& log_fn)
+    static unsigned get_category(const std::string category)
+    {
+        for (auto const& [key, value] : Logger::map_category) {
+            if (value == category)
+                return key;
+        }
+
+        throw std::runtime_error("Bad log category");
+    }
+
+    // The sink is shared by every logger the factory creates, so all sync
+    // client threads interleave their records into the one ring.
+    static SyncClientConfig::LoggerFactory build_binary_sync_logger(const std::string& path, uint64_t max_bytes)
+    {
+        auto sink = std::make_shared<BinaryLogSink>(path, max_bytes);
+        return [sink = std::move(sink)](realm::util::Logger::Level level) {
+            auto logger = std::make_unique<BinarySinkLogger>(sink);
+            logger->set_level_threshold(level);
+            return std::unique_ptr<util::Logger>(std::move(logger));
+        };
+    }
+
+    static SyncClientConfig::LoggerFactory build_sync_logger(Delegated&& log_fn,
+                                                             unsigned category_mask = category_all)
     {
-        return [captured_logger = std::move(log_fn)](realm::util::Logger::Level level) mutable {
-            auto logger = std::make_unique<SyncLoggerDelegator>(std::move(captured_logger));
+        return [captured_logger = std::move(log_fn),
+                category_mask](realm::util::Logger::Level level) mutable {
+            auto logger = std::make_unique<SyncLoggerDelegator>(std::move(captured_logger), category_mask);
             logger->set_level_threshold(level);
             logger->delegate();
             return logger;
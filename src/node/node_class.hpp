@@ -19,19 +19,25 @@
 #pragma once
 
 #include "node_types.hpp"
+#include "node_exception.hpp"
 
 #include "js_class.hpp"
+#include "js_metrics.hpp"
+#include "js_startup_trace.hpp"
 #include "js_util.hpp"
 
 #include "napi.h"
 
 #include <ctype.h>
-#include <unordered_set>
+#include <algorithm>
+#include <cstdint>
+#include <list>
 #include <vector>
 #include <functional>
 #include <string>
 #include <unordered_map>
 #include <exception>
+#include <stdexcept>
 
 // forward declare the types for gcc to compile correctly
 namespace realm {
@@ -59,6 +65,7 @@ Napi::FunctionReference RealmClassConstructor;
 
 static void node_class_init(Napi::Env env)
 {
+    js::startup::PhaseTimer timer("nodeClassInit");
     auto setPrototypeOf = env.Global().Get("Object").As<Napi::Object>().Get("setPrototypeOf").As<Napi::Function>();
     ObjectSetPrototypeOf = Napi::Persistent(setPrototypeOf);
     ObjectSetPrototypeOf.SuppressDestruct();
@@ -131,6 +138,18 @@ public:
     static void readonly_static_setter_callback(const Napi::CallbackInfo& info, const Napi::Value& value);
 
 private:
+    // Address of a per-class static, used as a brand: a successful napi_unwrap
+    // plus a tag compare proves the receiver is a WrappedObject of this class
+    // in constant time, with no prototype walking. Stands in for napi type
+    // tags, which require NAPI_VERSION >= 8.
+    static const void* type_tag()
+    {
+        static const int s_tag = 0;
+        return &s_tag;
+    }
+
+    const void* m_typeTag = type_tag();
+    js::MemoryCensus::WrapperToken m_censusToken{m_name};
     std::unique_ptr<Internal> m_internal;
     static Napi::FunctionReference constructor;
     static Napi::FunctionReference factory_constructor;
@@ -148,6 +167,26 @@ private:
                                                 const Napi::Function& function, const Napi::Object& thisObject);
         static Napi::ObjectReference m_proxyHandler;
 
+        // Object.keys, spread syntax and JSON.stringify drive the ownKeys and
+        // getOwnPropertyDescriptor traps constantly. The index-name strings
+        // ("0", "1", ...) are interned once and shared by every collection;
+        // the assembled frozen keys array is reused while consecutive calls
+        // see the same length; the descriptor never varies, so a single
+        // frozen object serves every call.
+        static Napi::Reference<Napi::Array> m_cachedIndexNames;
+        static Napi::Reference<Napi::Array> m_cachedOwnKeys;
+        static uint32_t m_cachedOwnKeysLength;
+        static Napi::ObjectReference m_cachedPropertyDescriptor;
+
+        // Symbol key under which each instance keeps its cache of bound
+        // native methods, so hot method reads skip the
+        // Function.prototype.bind round-trip after the first access. The
+        // cache lives on the instance itself rather than in a native
+        // FunctionReference: the bound function's [[BoundThis]] is the
+        // instance, and holding it from native code would close a reference
+        // cycle the garbage collector cannot break, leaking the wrapper.
+        static Napi::Reference<Napi::Symbol> m_boundMethodsKey;
+
 
         static Napi::Value get_proxy_trap(const Napi::CallbackInfo& info);
         static Napi::Value set_proxy_trap(const Napi::CallbackInfo& info);
@@ -182,6 +221,14 @@ struct SchemaObjectType {
     Napi::FunctionReference constructor;
 };
 
+// An entry in the per-path constructor cache. `lruPosition` points into the
+// list returned by get_schemaObjectTypesLru() so a cache hit can move its
+// path to the front of the LRU in O(1).
+struct SchemaObjectTypes {
+    std::unordered_map<std::string, SchemaObjectType*>* schemaObjects;
+    std::list<std::string>::iterator lruPosition;
+};
+
 template <typename ClassType>
 class ObjectWrap {
     using Internal = typename ClassType::Internal;
@@ -214,6 +261,13 @@ private:
     static auto& get_class();
     static auto& get_nativeMethods();
     static auto& get_schemaObjectTypes();
+    static auto& get_schemaObjectTypesLru();
+
+    // Keep constructor caches for at most this many Realm paths; the least
+    // recently used path is evicted when the bound is exceeded. Multi-tenant
+    // servers can open thousands of files, and without a bound the cache (and
+    // the napi references it pins) would grow for the process lifetime.
+    static constexpr size_t s_schemaObjectTypesMaxPaths = 64;
 
     // Gives access to ObjectWrap<ClassType> init_class private static member. See
     // https://stackoverflow.com/a/40937193
@@ -304,18 +358,39 @@ inline auto& ObjectWrap<ClassType>::get_class()
 template <typename ClassType>
 inline auto& ObjectWrap<ClassType>::get_nativeMethods()
 {
-    static std::unordered_set<std::string> s_nativeMethods;
+    // (hash, name) pairs sorted by hash; see has_native_method.
+    static std::vector<std::pair<uint64_t, std::string>> s_nativeMethods;
     return s_nativeMethods;
 }
 
+// FNV-1a over the method name. The native method table stores precomputed
+// hashes so the proxy's get trap can check membership with one hash of the
+// incoming name and a binary search, instead of hashing into set buckets.
+static inline uint64_t hash_method_name(const std::string& name)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : name) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+    return hash;
+}
+
 
 template <typename ClassType>
 inline auto& ObjectWrap<ClassType>::get_schemaObjectTypes()
 {
-    static std::unordered_map<std::string, std::unordered_map<std::string, SchemaObjectType*>*> s_schemaObjectTypes;
+    static std::unordered_map<std::string, SchemaObjectTypes> s_schemaObjectTypes;
     return s_schemaObjectTypes;
 }
 
+template <typename ClassType>
+inline auto& ObjectWrap<ClassType>::get_schemaObjectTypesLru()
+{
+    // Realm paths with cached constructors, most recently used first.
+    static std::list<std::string> s_schemaObjectTypesLru;
+    return s_schemaObjectTypesLru;
+}
+
 // A cache for property names. The pair is property name and a node::String* to the same string representation.
 // The cache is persisted throughout the process life time to preseve property names between constructor cache
 // invalidations (on_destory_context is called) Since RealmObjectClass instances may be used after context is
@@ -334,6 +409,23 @@ static node::String* get_cached_property_name(const std::string& name)
     return result;
 }
 
+// Persistent JS strings for the cached property names, interned lazily and
+// keyed by the (process-lifetime) node::String pointer so the lookup is a
+// pointer hash. The get/set paths need an actual JS string for schema-fixed
+// names on every access; reusing one reference avoids re-converting the same
+// UTF-8 millions of times.
+static std::unordered_map<const node::String*, Napi::Reference<Napi::String>> propertyNameJSStringCache;
+
+static Napi::String get_cached_property_jsname(Napi::Env env, node::String* name)
+{
+    auto it = propertyNameJSStringCache.find(name);
+    if (it == propertyNameJSStringCache.end()) {
+        it = propertyNameJSStringCache.emplace(name, Napi::Persistent(name->ToString(env))).first;
+        it->second.SuppressDestruct();
+    }
+    return it->second.Value();
+}
+
 
 inline static void copy_object(Napi::Env env, const Napi::Value& source, const Napi::Error& target)
 {
@@ -482,16 +574,20 @@ WrappedObject<ClassType>* WrappedObject<ClassType>::try_unwrap(const Napi::Objec
 
     WrappedObject<ClassType>* unwrapped;
     napi_status status = napi_unwrap(env, object, reinterpret_cast<void**>(&unwrapped));
-    if ((status) != napi_ok) {
-        Napi::Object instance = object.Get("_instance").As<Napi::Object>();
-        if (instance.IsUndefined() || instance.IsNull()) {
-            throw Napi::Error::New(env, "Invalid object. No _instance member");
-        }
+    if (status == napi_ok && unwrapped->m_typeTag == type_tag()) {
+        return unwrapped;
+    }
 
-        status = napi_unwrap(env, instance, reinterpret_cast<void**>(&unwrapped));
+    Napi::Object instance = object.Get("_instance").As<Napi::Object>();
+    if (instance.IsUndefined() || instance.IsNull()) {
+        throw Napi::Error::New(env, "Invalid object. No _instance member");
     }
 
+    status = napi_unwrap(env, instance, reinterpret_cast<void**>(&unwrapped));
     NAPI_THROW_IF_FAILED(env, status, nullptr);
+    if (unwrapped->m_typeTag != type_tag()) {
+        throw Napi::Error::New(env, "Invalid object. Wrong type");
+    }
     return unwrapped;
 }
 
@@ -535,6 +631,15 @@ inline bool WrappedObject<ClassType>::is_instance(Napi::Env env, const Napi::Obj
 
     Napi::HandleScope scope(env);
 
+    // Fast path: a napi-wrapped instance of this class is identified by its
+    // type tag alone. This also covers RealmObject instances whose prototype
+    // was replaced with setPrototypeOf, since the wrap survives that.
+    WrappedObject<ClassType>* unwrapped;
+    if (napi_unwrap(env, object, reinterpret_cast<void**>(&unwrapped)) == napi_ok &&
+        unwrapped->m_typeTag == type_tag()) {
+        return true;
+    }
+
     // Check the object is instance of the constructor. This will be true when the object have it's prototype set with
     // setPrototypeOf. This is true for objects configured in the schema with a function type.
     Napi::Function ctor = constructor.Value();
@@ -614,6 +719,21 @@ void WrappedObject<ClassType>::readonly_static_setter_callback(const Napi::Callb
 template <typename ClassType>
 Napi::ObjectReference WrappedObject<ClassType>::ProxyHandler::m_proxyHandler;
 
+template <typename ClassType>
+Napi::Reference<Napi::Array> WrappedObject<ClassType>::ProxyHandler::m_cachedIndexNames;
+
+template <typename ClassType>
+Napi::Reference<Napi::Array> WrappedObject<ClassType>::ProxyHandler::m_cachedOwnKeys;
+
+template <typename ClassType>
+uint32_t WrappedObject<ClassType>::ProxyHandler::m_cachedOwnKeysLength;
+
+template <typename ClassType>
+Napi::ObjectReference WrappedObject<ClassType>::ProxyHandler::m_cachedPropertyDescriptor;
+
+template <typename ClassType>
+Napi::Reference<Napi::Symbol> WrappedObject<ClassType>::ProxyHandler::m_boundMethodsKey;
+
 template <typename ClassType>
 Napi::Value WrappedObject<ClassType>::ProxyHandler::get_instance_proxy_handler(Napi::Env env)
 {
@@ -672,6 +792,13 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::bind_native_function(Napi::E
     return scope.Escape(result);
 }
 
+static inline void freeze_object(Napi::Env env, const Napi::Object& object)
+{
+    // napi_object_freeze requires NAPI_VERSION >= 8, so go through JS.
+    Napi::Function freeze = env.Global().Get("Object").As<Napi::Object>().Get("freeze").As<Napi::Function>();
+    freeze.Call({object});
+}
+
 static inline Napi::Object get_prototype(Napi::Env env, const Napi::Object& object)
 {
     napi_value napi_proto;
@@ -686,6 +813,7 @@ static inline Napi::Object get_prototype(Napi::Env env, const Napi::Object& obje
 template <typename ClassType>
 Napi::Value WrappedObject<ClassType>::ProxyHandler::get_proxy_trap(const Napi::CallbackInfo& info)
 {
+    js::metrics::increment(js::metrics::counters().proxy_get_traps);
     Napi::Env env = info.Env();
     Napi::EscapableHandleScope scope(env);
 
@@ -732,25 +860,41 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::get_proxy_trap(const Napi::C
 
     bool isNumber = isdigit(firstChar) || firstChar == '+';
     if (isNumber) {
-        int32_t index = 0;
-        try {
-            index = std::stoi(propertyText);
-        }
-        catch (const std::exception& e) {
+        auto index = realm::js::try_parse_positive_index(propertyText);
+        if (!index) {
             throw Napi::Error::New(env, "Invalid number " + propertyText);
         }
 
         WrappedObject<ClassType>* wrappedObject = WrappedObject<ClassType>::Unwrap(instance);
-        Napi::Value result = wrappedObject->m_indexPropertyHandlers->getter(info, instance, index);
+        Napi::Value result = wrappedObject->m_indexPropertyHandlers->getter(info, instance, *index);
         return scope.Escape(result);
     }
 
 
     // 2. Check if its a native function
     if (m_has_native_methodFunc(propertyText)) {
-        // TODO: cache this function in the wrappedObject of this instance
+        if (m_boundMethodsKey.IsEmpty()) {
+            m_boundMethodsKey = Napi::Persistent(Napi::Symbol::New(env, "realm.boundMethods"));
+            m_boundMethodsKey.SuppressDestruct();
+        }
+        Napi::Symbol key = m_boundMethodsKey.Value();
+        Napi::Value boundMethodsValue = instance.Get(key);
+        Napi::Object boundMethods;
+        if (boundMethodsValue.IsObject()) {
+            boundMethods = boundMethodsValue.As<Napi::Object>();
+            Napi::Value cached = boundMethods.Get(propertyName);
+            if (cached.IsFunction()) {
+                return scope.Escape(cached);
+            }
+        }
+        else {
+            boundMethods = Napi::Object::New(env);
+            instance.Set(key, boundMethods);
+        }
+
         Napi::Value propertyValue = instance.Get(property);
         Napi::Value result = bind_function(env, propertyText, propertyValue.As<Napi::Function>(), instance);
+        boundMethods.Set(propertyName, result);
         return scope.Escape(result);
     }
 
@@ -762,6 +906,7 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::get_proxy_trap(const Napi::C
 template <typename ClassType>
 Napi::Value WrappedObject<ClassType>::ProxyHandler::set_proxy_trap(const Napi::CallbackInfo& info)
 {
+    js::metrics::increment(js::metrics::counters().proxy_set_traps);
     Napi::Env env = info.Env();
     Napi::EscapableHandleScope scope(env);
 
@@ -803,20 +948,18 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::set_proxy_trap(const Napi::C
     char firstChar = *propertyText.c_str();
     bool isNumber = isdigit(firstChar) || firstChar == '+' || firstChar == '-';
     if (isNumber) {
-        try {
-            realm::js::validated_positive_index(propertyText);
-        }
-        catch (const std::out_of_range& e) {
-            throw Napi::Error::New(env, e.what());
-        }
-
-        int32_t index = 0;
-        try {
-            index = std::stoi(propertyText);
-        }
-        catch (const std::exception& e) {
-            throw Napi::Error::New(env, "Invalid number " + propertyText);
+        auto parsed = realm::js::try_parse_positive_index(propertyText);
+        if (!parsed) {
+            // Cold path: the throwing validator re-parses to pick between
+            // "negative", "out of 32-bit range" and "not a number".
+            try {
+                parsed = realm::js::validated_positive_index(propertyText);
+            }
+            catch (const std::out_of_range& e) {
+                throw Napi::Error::New(env, e.what());
+            }
         }
+        uint32_t index = *parsed;
 
         WrappedObject<ClassType>* wrappedObject = WrappedObject<ClassType>::Unwrap(instance);
         if (wrappedObject->m_indexPropertyHandlers->setter == nullptr) {
@@ -857,10 +1000,29 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::own_keys_proxy_trap(const Na
 
     if (wrappedObject->m_indexPropertyHandlers != nullptr) {
         uint32_t length = instance.Get("length").As<Napi::Number>();
+        // The engine copies the trap result into an internal list, so the
+        // same (frozen) array can serve every enumeration at this length.
+        if (!m_cachedOwnKeys.IsEmpty() && m_cachedOwnKeysLength == length) {
+            return scope.Escape(m_cachedOwnKeys.Value());
+        }
+
+        if (m_cachedIndexNames.IsEmpty()) {
+            m_cachedIndexNames = Napi::Persistent(Napi::Array::New(env));
+            m_cachedIndexNames.SuppressDestruct();
+        }
+        Napi::Array names = m_cachedIndexNames.Value();
+        for (uint32_t i = names.Length(); i < length; i++) {
+            names.Set(i, Napi::Number::New(env, i).ToString());
+        }
+
         Napi::Array array = Napi::Array::New(env, length);
         for (uint32_t i = 0; i < length; i++) {
-            array.Set(i, Napi::Number::New(env, i).ToString());
+            array.Set(i, names.Get(i));
         }
+        freeze_object(env, array);
+        m_cachedOwnKeys = Napi::Persistent(array);
+        m_cachedOwnKeys.SuppressDestruct();
+        m_cachedOwnKeysLength = length;
         return scope.Escape(array);
     }
 
@@ -909,17 +1071,14 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::has_proxy_trap(const Napi::C
         return scope.Escape(Napi::Boolean::From(env, false));
     }
 
-    int32_t index = 0;
-    try {
-        index = std::stoi(propertyText);
-    }
-    catch (const std::exception& e) {
+    auto index = realm::js::try_parse_positive_index(propertyText);
+    if (!index) {
         // not a number. return false;
         return scope.Escape(Napi::Boolean::From(env, false));
     }
 
     int32_t length = instance.Get("length").As<Napi::Number>();
-    bool hasIndex = index >= 0 && index < length;
+    bool hasIndex = length >= 0 && *index < static_cast<uint32_t>(length);
     return scope.Escape(Napi::Boolean::From(env, hasIndex));
 }
 
@@ -933,9 +1092,18 @@ Napi::Value WrappedObject<ClassType>::ProxyHandler::get_own_property_descriptor_
     Napi::Env env = info.Env();
     Napi::EscapableHandleScope scope(env);
 
+    // The descriptor is identical for every property, so build it once and
+    // hand out the frozen object; the engine only reads it.
+    if (!m_cachedPropertyDescriptor.IsEmpty()) {
+        return scope.Escape(m_cachedPropertyDescriptor.Value());
+    }
+
     Napi::Object descriptor = Napi::Object::New(env);
     descriptor.Set("enumerable", Napi::Boolean::New(env, true));
     descriptor.Set("configurable", Napi::Boolean::New(env, true));
+    freeze_object(env, descriptor);
+    m_cachedPropertyDescriptor = Napi::Persistent(descriptor);
+    m_cachedPropertyDescriptor.SuppressDestruct();
 
     return scope.Escape(descriptor);
 }
@@ -979,7 +1147,8 @@ Napi::Value ObjectWrap<ClassType>::property_getter(const Napi::CallbackInfo& inf
     auto& s_class = get_class();
     try {
         auto propertyName = (node::String*)info.Data();
-        return s_class.string_accessor.getter(info, info.This().As<Napi::Object>(), propertyName->ToString(env));
+        return s_class.string_accessor.getter(info, info.This().As<Napi::Object>(),
+                                              get_cached_property_jsname(env, propertyName));
     }
     catch (const Napi::Error& e) {
         e.ThrowAsJavaScriptException();
@@ -995,7 +1164,8 @@ void ObjectWrap<ClassType>::property_setter(const Napi::CallbackInfo& info)
     try {
         auto propertyName = (node::String*)info.Data();
         auto value = info[0];
-        s_class.string_accessor.setter(info, info.This().As<Napi::Object>(), propertyName->ToString(env), value);
+        s_class.string_accessor.setter(info, info.This().As<Napi::Object>(),
+                                       get_cached_property_jsname(env, propertyName), value);
     }
     catch (const Napi::Error& e) {
         e.ThrowAsJavaScriptException();
@@ -1171,6 +1341,18 @@ static inline void remove_schema_object(std::unordered_map<std::string, SchemaOb
     delete schemaObjectType;
 }
 
+// Releases every cached constructor for a path. The napi references are reset
+// explicitly so the constructors become collectible immediately rather than
+// when the process exits.
+static inline void destroy_schema_objects(std::unordered_map<std::string, SchemaObjectType*>* schemaObjects)
+{
+    for (auto it = schemaObjects->begin(); it != schemaObjects->end(); ++it) {
+        it->second->constructor.Reset();
+        delete it->second;
+    }
+    delete schemaObjects;
+}
+
 template <typename ClassType>
 inline std::vector<Napi::PropertyDescriptor>
 ObjectWrap<ClassType>::create_napi_property_descriptors(Napi::Env env, const Napi::Object& constructorPrototype,
@@ -1183,7 +1365,7 @@ ObjectWrap<ClassType>::create_napi_property_descriptors(Napi::Env env, const Nap
         if (redefine || !constructorPrototype.HasOwnProperty(propName)) {
             node::String* name = get_cached_property_name(propName);
             auto descriptor = Napi::PropertyDescriptor::Accessor<property_getter, property_setter>(
-                name->ToString(env), napi_enumerable, (void*)name);
+                get_cached_property_jsname(env, name), napi_enumerable, (void*)name);
             properties.push_back(descriptor);
         }
     }
@@ -1193,7 +1375,7 @@ ObjectWrap<ClassType>::create_napi_property_descriptors(Napi::Env env, const Nap
         if (redefine || !constructorPrototype.HasOwnProperty(propName)) {
             node::String* name = get_cached_property_name(propName);
             auto descriptor = Napi::PropertyDescriptor::Accessor<property_getter, property_setter>(
-                name->ToString(env), napi_enumerable, (void*)name);
+                get_cached_property_jsname(env, name), napi_enumerable, (void*)name);
             properties.push_back(descriptor);
         }
     }
@@ -1225,14 +1407,26 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
     auto version = internal->realm()->schema_version();
     std::string schemaName = schema.name + ":" + std::to_string(version);
 
+    auto& s_schemaObjectTypesLru = get_schemaObjectTypesLru();
     std::unordered_map<std::string, SchemaObjectType*>* schemaObjects = nullptr;
-    if (!s_schemaObjectTypes.count(path)) {
-        // std::map<std::string, std::map<std::string, SchemaObjectType*>>
+    auto cacheEntry = s_schemaObjectTypes.find(path);
+    if (cacheEntry == s_schemaObjectTypes.end()) {
         schemaObjects = new std::unordered_map<std::string, SchemaObjectType*>();
-        s_schemaObjectTypes.emplace(path, schemaObjects);
+        s_schemaObjectTypesLru.push_front(path);
+        s_schemaObjectTypes.emplace(path, SchemaObjectTypes{schemaObjects, s_schemaObjectTypesLru.begin()});
+
+        if (s_schemaObjectTypesLru.size() > s_schemaObjectTypesMaxPaths) {
+            std::string evictedPath = s_schemaObjectTypesLru.back();
+            s_schemaObjectTypesLru.pop_back();
+            destroy_schema_objects(s_schemaObjectTypes.at(evictedPath).schemaObjects);
+            s_schemaObjectTypes.erase(evictedPath);
+            js::metrics::increment(js::metrics::counters().schema_cache_evictions);
+        }
     }
     else {
-        schemaObjects = s_schemaObjectTypes.at(path);
+        schemaObjects = cacheEntry->second.schemaObjects;
+        s_schemaObjectTypesLru.splice(s_schemaObjectTypesLru.begin(), s_schemaObjectTypesLru,
+                                      cacheEntry->second.lruPosition);
     }
 
     Napi::Function schemaObjectConstructor;
@@ -1241,6 +1435,7 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
     if (constructor.IsEmpty()) {
         // 1.Check by name if the constructor is already created for this RealmObject
         if (!schemaObjects->count(schemaName)) {
+            js::metrics::increment(js::metrics::counters().schema_cache_misses);
 
             // 2.Create the constructor
 
@@ -1269,6 +1464,7 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
         }
         else {
             // hot path. The constructor for this schema object is already cached. use it and return a new instance
+            js::metrics::increment(js::metrics::counters().schema_cache_hits);
             SchemaObjectType* schemaObjectType = schemaObjects->at(schemaName);
             schemaObjectConstructor = schemaObjectType->constructor.Value();
         }
@@ -1295,6 +1491,7 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
 
         // hot path. The constructor for this schema object is already cached. use it and return a new instance
         if (schemaExists) {
+            js::metrics::increment(js::metrics::counters().schema_cache_hits);
             schemaObjectType = schemaObjects->at(schemaName);
             schemaObjectConstructor = schemaObjectType->constructor.Value();
 
@@ -1306,6 +1503,7 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
             return scope.Escape(instance).As<Napi::Object>();
         }
 
+        js::metrics::increment(js::metrics::counters().schema_cache_misses);
         schemaObjectConstructor = constructor;
         Napi::Object constructorPrototype = constructor.Get("prototype").As<Napi::Object>();
 
@@ -1369,21 +1567,15 @@ Napi::Object ObjectWrap<ClassType>::create_instance_by_schema(Napi::Env env, Nap
 template <typename ClassType>
 inline void ObjectWrap<ClassType>::on_context_destroy(Napi::Env env, std::string realmPath)
 {
-    std::unordered_map<std::string, SchemaObjectType*>* schemaObjects = nullptr;
     auto& s_schemaObjectTypes = get_schemaObjectTypes();
-    if (!s_schemaObjectTypes.count(realmPath)) {
+    auto cacheEntry = s_schemaObjectTypes.find(realmPath);
+    if (cacheEntry == s_schemaObjectTypes.end()) {
         return;
     }
 
-    schemaObjects = s_schemaObjectTypes.at(realmPath);
-    for (auto it = schemaObjects->begin(); it != schemaObjects->end(); ++it) {
-        it->second->constructor.Reset();
-        SchemaObjectType* schemaObjecttype = it->second;
-        delete schemaObjecttype;
-    }
-    s_schemaObjectTypes.erase(realmPath);
-
-    delete schemaObjects;
+    get_schemaObjectTypesLru().erase(cacheEntry->second.lruPosition);
+    destroy_schema_objects(cacheEntry->second.schemaObjects);
+    s_schemaObjectTypes.erase(cacheEntry);
 }
 
 template <typename ClassType>
@@ -1452,8 +1644,15 @@ template <typename ClassType>
 bool ObjectWrap<ClassType>::has_native_method(const std::string& name)
 {
     auto& s_nativeMethods = get_nativeMethods();
-    if (s_nativeMethods.find(name) != s_nativeMethods.end()) {
-        return true;
+    uint64_t hash = hash_method_name(name);
+    auto it = std::lower_bound(s_nativeMethods.begin(), s_nativeMethods.end(), hash,
+                               [](const std::pair<uint64_t, std::string>& entry, uint64_t value) {
+                                   return entry.first < value;
+                               });
+    for (; it != s_nativeMethods.end() && it->first == hash; ++it) {
+        if (it->second == name) {
+            return true;
+        }
     }
 
     return ObjectWrap<ParentClassType>::has_native_method(name);
@@ -1466,7 +1665,12 @@ ObjectWrap<ClassType>::setup_method(Napi::Env env, const std::string& name, node
     auto& s_nativeMethods = get_nativeMethods();
     auto methodCallback =
         (typename WrappedObject<ClassType>::InstanceMethodCallback)(&WrappedObject<ClassType>::method_callback);
-    s_nativeMethods.insert(name);
+    uint64_t hash = hash_method_name(name);
+    auto it = std::lower_bound(s_nativeMethods.begin(), s_nativeMethods.end(), hash,
+                               [](const std::pair<uint64_t, std::string>& entry, uint64_t value) {
+                                   return entry.first < value;
+                               });
+    s_nativeMethods.emplace(it, hash, name);
     return WrappedObject<ClassType>::InstanceMethod(
         name.c_str(), methodCallback, napi_default | realm::js::PropertyAttributes::DontEnum, (void*)callback);
 }
@@ -1537,6 +1741,11 @@ class ObjectWrap<node::Types, ClassType> : public node::ObjectWrap<ClassType> {}
         copy_object(env, e.m_value, error);                                                                          \
         throw error;                                                                                                 \
     }                                                                                                                \
+    catch (const std::invalid_argument& e)                                                                           \
+    {                                                                                                                \
+        /* Validation rejects are expected control flow for some callers; skip the eager stack capture. */           \
+        throw node::make_stackless_error(info.Env(), e.what());                                                      \
+    }                                                                                                                \
     catch (const std::exception& e)                                                                                  \
     {                                                                                                                \
         throw Napi::Error::New(info.Env(), e.what());                                                                \
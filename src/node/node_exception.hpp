@@ -31,4 +31,42 @@ inline Napi::Value node::Exception::value(Napi::Env env, const std::string& mess
 }
 
 } // namespace js
+
+namespace node {
+
+/// Builds a JS Error without walking the stack at the throw site.
+///
+/// V8 captures the stack when an Error is constructed (roughly 10µs per
+/// throw), which is pure waste for conditions callers treat as control flow —
+/// validation rejects being the main offender. The factory is compiled once
+/// and constructs the Error with Error.stackTraceLimit zeroed, then installs
+/// a getter that captures a trace only if `.stack` is actually read. A
+/// lazily-read stack reflects the read point rather than the throw point,
+/// which is the accepted trade-off for expected failures; genuine faults keep
+/// going through Napi::Error::New with full capture.
+inline Napi::Error make_stackless_error(Napi::Env env, const std::string& message)
+{
+    static Napi::FunctionReference s_factory;
+    if (s_factory.IsEmpty()) {
+        s_factory = Napi::Persistent(env.RunScript("(function (message) {"
+                                                   "  const limit = Error.stackTraceLimit;"
+                                                   "  Error.stackTraceLimit = 0;"
+                                                   "  const error = new Error(message);"
+                                                   "  Error.stackTraceLimit = limit;"
+                                                   "  Object.defineProperty(error, 'stack', {"
+                                                   "    configurable: true,"
+                                                   "    get: function () {"
+                                                   "      Error.captureStackTrace(this);"
+                                                   "      return this.stack;"
+                                                   "    },"
+                                                   "  });"
+                                                   "  return error;"
+                                                   "})")
+                                         .As<Napi::Function>());
+        s_factory.SuppressDestruct();
+    }
+    return Napi::Error(env, s_factory.Call({Napi::String::New(env, message)}));
+}
+
+} // namespace node
 } // namespace realm
@@ -26,12 +26,14 @@
 #endif
 
 #include "js_realm.hpp"
+#include "js_startup_trace.hpp"
 
 namespace realm {
 namespace node {
 
 static void napi_init(Napi::Env env, Napi::Object exports)
 {
+    js::startup::PhaseTimer timer("moduleInit");
     node_class_init(env);
 
     Napi::Function realm_constructor = js::RealmClass<Types>::create_constructor(env);
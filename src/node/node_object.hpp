@@ -98,6 +98,26 @@ inline void node::Object::set_property(Napi::Env env, Napi::Object& object, cons
     }
 }
 
+template <>
+inline void node::Object::set_lazy_property(Napi::Env env, Napi::Object object, const node::String& key,
+                                            LazyPropertyFactory factory)
+{
+    try {
+        std::string name = key;
+        // Configurable so that the factory can replace this accessor with the
+        // real value when it eventually runs.
+        auto getter = [factory, name](const Napi::CallbackInfo& info) -> Napi::Value {
+            Napi::Object self = info.This().As<Napi::Object>();
+            return factory(info.Env(), self, name);
+        };
+        object.DefineProperty(
+            Napi::PropertyDescriptor::Accessor(env, object, name, std::move(getter), napi_configurable));
+    }
+    catch (const Napi::Error& e) {
+        throw node::Exception(env, e.Message());
+    }
+}
+
 template <>
 inline void node::Object::set_property(Napi::Env env, Napi::Object& object, uint32_t index, const Napi::Value& value)
 {
@@ -160,6 +180,32 @@ inline Napi::Object node::Object::create_empty(Napi::Env env)
     return Napi::Object::New(env);
 }
 
+template <>
+inline Napi::Object node::Object::create_obj(Napi::Env env,
+                                             std::initializer_list<std::pair<node::String, Napi::Value>> values)
+{
+    try {
+        Napi::Object obj = Napi::Object::New(env);
+        // One napi_define_properties call for the whole literal instead of a
+        // napi round-trip per field. The attributes match what a plain Set
+        // would produce, and the fixed definition order per call site keeps
+        // objects built from the same literal on the same hidden class.
+        constexpr auto attributes =
+            static_cast<napi_property_attributes>(napi_enumerable | napi_configurable | napi_writable);
+        std::vector<Napi::PropertyDescriptor> descriptors;
+        descriptors.reserve(values.size());
+        for (auto&& [name, value] : values) {
+            descriptors.push_back(
+                Napi::PropertyDescriptor::Value(Napi::String::New(env, std::string(name)), value, attributes));
+        }
+        obj.DefineProperties(descriptors);
+        return obj;
+    }
+    catch (const Napi::Error& e) {
+        throw node::Exception(env, e.Message());
+    }
+}
+
 template <>
 inline Napi::Object node::Object::create_array(Napi::Env env, uint32_t length, const Napi::Value values[])
 {
@@ -170,6 +216,14 @@ inline Napi::Object node::Object::create_array(Napi::Env env, uint32_t length, c
     return array;
 }
 
+template <>
+inline Napi::Object node::Object::create_uint32_array(Napi::Env env, const std::vector<uint32_t>& values)
+{
+    Napi::TypedArrayOf<uint32_t> array = Napi::TypedArrayOf<uint32_t>::New(env, values.size());
+    std::copy(values.begin(), values.end(), array.Data());
+    return array;
+}
+
 template <>
 inline Napi::Object node::Object::create_date(Napi::Env env, double time)
 {
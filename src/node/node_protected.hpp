@@ -20,6 +20,8 @@
 
 #include "node_types.hpp"
 
+#include <atomic>
+
 namespace realm {
 namespace node {
 
@@ -28,9 +30,48 @@ class Protected {
 protected:
     Napi::Env m_env;
     napi_ref m_ref;
+    // Stable identity of the protected JS value. For objects and functions
+    // the id minted on first protection is stored on the value itself as a
+    // hidden non-enumerable property and picked up by every later Protected
+    // built from the same value, so equal ids mean the same JS value and
+    // comparisons never have to enter the VM. Primitives get a fresh id per
+    // reference and fall back to strict-equals.
+    uint64_t m_id = 0;
     bool m_isValue;
     bool m_suppressDestruct = false;
 
+    static uint64_t next_id()
+    {
+        static std::atomic<uint64_t> s_next_id{1};
+        return s_next_id.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static constexpr const char* s_id_property = "__realmProtectedId";
+
+    static uint64_t id_for_value(Napi::Env env, napi_value value)
+    {
+        napi_value existing;
+        if (napi_get_named_property(env, value, s_id_property, &existing) == napi_ok) {
+            double number;
+            if (napi_get_value_double(env, existing, &number) == napi_ok) {
+                return static_cast<uint64_t>(number);
+            }
+        }
+        uint64_t id = next_id();
+        napi_value id_value;
+        if (napi_create_double(env, static_cast<double>(id), &id_value) == napi_ok) {
+            napi_property_descriptor descriptor{};
+            descriptor.utf8name = s_id_property;
+            descriptor.value = id_value;
+            // napi_default: non-enumerable, non-writable, non-configurable.
+            descriptor.attributes = napi_default;
+            // Frozen objects reject the define; they just keep falling back
+            // to strict-equals comparisons.
+            napi_define_properties(env, value, 1, &descriptor);
+        }
+        return id;
+    }
+
 public:
     Protected()
         : m_env(nullptr)
@@ -54,11 +95,15 @@ public:
         if (status != napi_ok) {
             throw std::runtime_error(util::format("Can't create protected reference: napi_status %1", status));
         }
+
+        m_id = m_isValue ? next_id() : id_for_value(env, value);
+        js::MemoryCensus::shared().protected_references++;
     }
 
     Protected(const Protected& other)
         : m_env(other.m_env)
         , m_ref(other.m_ref)
+        , m_id(other.m_id)
         , m_isValue(other.m_isValue)
     {
         uint32_t result;
@@ -67,6 +112,7 @@ public:
             throw std::runtime_error(
                 util::format("Can't increase protected reference count: napi_status %1", status));
         }
+        js::MemoryCensus::shared().protected_references++;
     }
 
     Protected(Protected&& other)
@@ -79,6 +125,7 @@ public:
     {
         std::swap(first.m_env, second.m_env);
         std::swap(first.m_ref, second.m_ref);
+        std::swap(first.m_id, second.m_id);
         std::swap(first.m_isValue, second.m_isValue);
         std::swap(first.m_suppressDestruct, second.m_suppressDestruct);
     }
@@ -92,7 +139,11 @@ public:
 
     ~Protected()
     {
-        if (m_ref == nullptr || m_suppressDestruct) {
+        if (m_ref == nullptr) {
+            return;
+        }
+        js::MemoryCensus::shared().protected_references--;
+        if (m_suppressDestruct) {
             return;
         }
 
@@ -161,8 +212,19 @@ public:
         return memberType != other;
     }
 
+    /// Identity of the protected value. Equal ids imply the same JS value;
+    /// distinct ids say nothing for primitives, which get a fresh id per
+    /// reference.
+    uint64_t id() const
+    {
+        return m_id;
+    }
+
     bool operator==(const Protected<MemberType>& other) const
     {
+        if (m_id != 0 && m_id == other.m_id) {
+            return true;
+        }
         MemberType thisValue = *this;
         MemberType otherValue = *other;
         return thisValue == otherValue;
@@ -170,9 +232,7 @@ public:
 
     bool operator!=(const Protected<MemberType>& other) const
     {
-        MemberType thisValue = *this;
-        MemberType otherValue = *other;
-        return thisValue != otherValue;
+        return !(*this == other);
     }
 
     void SuppressDestruct()
@@ -183,6 +243,13 @@ public:
     struct Comparator {
         bool operator()(const Protected<MemberType>& a, const Protected<MemberType>& b) const
         {
+            // Objects and functions share their id through a hidden property
+            // on the value itself, so removal scans comparing a stored
+            // callback against an incoming one match on id alone; only
+            // primitives pay for a strict-equals in the VM.
+            if (a.m_id != 0 && a.m_id == b.m_id) {
+                return true;
+            }
             MemberType aValue = a;
             MemberType bValue = b;
             return aValue == bValue;
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <optional>
+#include <string_view>
 
 #include "node_types.hpp"
 #include "napi.h"
@@ -98,6 +99,35 @@ public:
         m_value = Value<node::Types>::from_mixed(m_env, nullptr, mixed);
     }
 
+    // Typed direct-set paths for getter callbacks on hot property and index
+    // reads: the engine-native value is written straight through without the
+    // generic set() overloads' intermediate Value construction.
+    void set_prewrapped(const Napi::Value& value)
+    {
+        m_value = value;
+    }
+
+    void set_int64(int64_t number)
+    {
+        m_value = Napi::Number::New(m_env, static_cast<double>(number));
+    }
+
+    void set_bool(bool boolean)
+    {
+        napi_value value;
+        napi_status status = napi_get_boolean(m_env, boolean, &value);
+        NAPI_THROW_IF_FAILED_VOID(m_env, status);
+        m_value = Napi::Value(m_env, value);
+    }
+
+    void set_string_view(std::string_view string)
+    {
+        napi_value value;
+        napi_status status = napi_create_string_utf8(m_env, string.data(), string.size(), &value);
+        NAPI_THROW_IF_FAILED_VOID(m_env, status);
+        m_value = Napi::Value(m_env, value);
+    }
+
     void set_null()
     {
         m_value = Napi::Value(m_env, m_env.Null());
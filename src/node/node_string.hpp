@@ -74,6 +74,16 @@ public:
 
 inline String<node::Types>::String(const Napi::String& s)
 {
+    // Single stack-buffer copy for the common short string; names up to the
+    // SSO limit never touch the heap at all. Utf8Value() would query the
+    // length in a separate napi call and always allocate.
+    char stack_buffer[128];
+    size_t copied = 0;
+    if (napi_get_value_string_utf8(s.Env(), s, stack_buffer, sizeof(stack_buffer), &copied) == napi_ok &&
+        copied + 1 < sizeof(stack_buffer)) {
+        m_str.assign(stack_buffer, copied);
+        return;
+    }
     m_str = s.Utf8Value();
 }
 
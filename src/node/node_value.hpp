@@ -108,7 +108,12 @@ inline bool node::Value::is_function(Napi::Env env, const Napi::Value& value)
 template <>
 inline bool node::Value::is_null(Napi::Env env, const Napi::Value& value)
 {
-    return value.IsNull();
+    // Raw napi call: this check runs per property in the unbox loop, where
+    // the Napi wrapper's Value::Type() indirection is measurable.
+    napi_valuetype type;
+    napi_status status = napi_typeof(env, value, &type);
+    NAPI_THROW_IF_FAILED(env, status, false);
+    return type == napi_null;
 }
 
 template <>
@@ -165,7 +170,11 @@ inline bool node::Value::is_string(Napi::Env env, const Napi::Value& value)
 template <>
 inline bool node::Value::is_undefined(Napi::Env env, const Napi::Value& value)
 {
-    return value.IsUndefined();
+    // Raw napi call, same rationale as is_null.
+    napi_valuetype type;
+    napi_status status = napi_typeof(env, value, &type);
+    NAPI_THROW_IF_FAILED(env, status, false);
+    return type == napi_undefined;
 }
 
 template <>
@@ -228,7 +237,18 @@ inline Napi::Value node::Value::from_undefined(Napi::Env env)
 template <>
 inline bool node::Value::to_boolean(Napi::Env env, const Napi::Value& value)
 {
-    return value.ToBoolean();
+    // Values that are already booleans — the common case in the unbox
+    // loop — convert with one raw napi call and no coercion wrapper.
+    bool result;
+    if (napi_get_value_bool(env, value, &result) == napi_ok) {
+        return result;
+    }
+    napi_value coerced;
+    napi_status status = napi_coerce_to_bool(env, value, &coerced);
+    NAPI_THROW_IF_FAILED(env, status, false);
+    status = napi_get_value_bool(env, coerced, &result);
+    NAPI_THROW_IF_FAILED(env, status, false);
+    return result;
 }
 
 template <>
@@ -237,10 +257,51 @@ inline node::String node::Value::to_string(Napi::Env env, const Napi::Value& val
     return value.ToString();
 }
 
+template <>
+inline void node::Value::to_string_buffer(Napi::Env env, const Napi::Value& value, std::string& out)
+{
+    Napi::String string = value.ToString();
+    // Try a single copy through a stack buffer first. The short strings that
+    // dominate this path (property names, keys, type names) fit, which
+    // halves the napi calls by skipping the separate length query.
+    char stack_buffer[128];
+    size_t copied = 0;
+    napi_status status = napi_get_value_string_utf8(env, string, stack_buffer, sizeof(stack_buffer), &copied);
+    if (status != napi_ok) {
+        throw Napi::Error::New(env);
+    }
+    if (copied + 1 < sizeof(stack_buffer)) {
+        out.assign(stack_buffer, copied);
+        return;
+    }
+    // A full buffer may mean truncation — redo with the exact length.
+    size_t length = 0;
+    status = napi_get_value_string_utf8(env, string, nullptr, 0, &length);
+    if (status != napi_ok) {
+        throw Napi::Error::New(env);
+    }
+    // One extra char for the null terminator napi always writes.
+    out.resize(length + 1);
+    status = napi_get_value_string_utf8(env, string, &out[0], length + 1, &length);
+    if (status != napi_ok) {
+        throw Napi::Error::New(env);
+    }
+    out.resize(length);
+}
+
 template <>
 inline double node::Value::to_number(Napi::Env env, const Napi::Value& value)
 {
-    double number = value.ToNumber();
+    // Values that are already numbers skip coercion entirely: one raw napi
+    // call instead of Napi::Value::ToNumber's coerce + unwrap pair.
+    double number;
+    if (napi_get_value_double(env, value, &number) != napi_ok) {
+        napi_value coerced;
+        napi_status status = napi_coerce_to_number(env, value, &coerced);
+        NAPI_THROW_IF_FAILED(env, status, 0);
+        status = napi_get_value_double(env, coerced, &number);
+        NAPI_THROW_IF_FAILED(env, status, 0);
+    }
     if (std::isnan(number)) {
         throw std::invalid_argument(
             util::format("Value '%1' not convertible to a number.", (std::string)to_string(env, value)));
@@ -280,6 +341,31 @@ inline OwnedBinaryData node::Value::to_binary(Napi::Env env, const Napi::Value&
 }
 
 
+template <>
+inline BinaryData node::Value::to_binary_view(Napi::Env env, const Napi::Value& value, OwnedBinaryData&)
+{
+    // V8 buffers are pinned while the value is alive, so the write path can
+    // point core directly at them — core copies the bytes into the file
+    // itself, making the intermediate owned copy pure overhead.
+    if (value.IsDataView()) {
+        auto data_view = value.As<Napi::DataView>();
+        return BinaryData(js::get_data<DataView>(data_view), data_view.ByteLength());
+    }
+    if (value.IsBuffer()) {
+        auto buffer = value.As<Napi::Buffer<char>>();
+        return BinaryData(buffer.Data(), buffer.Length());
+    }
+    if (value.IsTypedArray()) {
+        auto typed_array = value.As<Napi::TypedArray>();
+        return BinaryData(js::get_data<TypedArray>(typed_array), typed_array.ByteLength());
+    }
+    if (value.IsArrayBuffer()) {
+        auto array_buffer = value.As<Napi::ArrayBuffer>();
+        return BinaryData(static_cast<const char*>(array_buffer.Data()), array_buffer.ByteLength());
+    }
+    throw std::runtime_error("Can only convert Buffer, ArrayBuffer, and ArrayBufferView objects to binary");
+}
+
 template <>
 inline Napi::Object node::Value::to_object(Napi::Env env, const Napi::Value& value)
 {
@@ -2328,4 +2328,148 @@ module.exports = {
 
     realm.close();
   },
+
+  testFreeze: function () {
+    const realm = new Realm({ schema: [schemas.TestObject] });
+    realm.write(() => {
+      realm.create("TestObject", { doubleCol: 1 });
+    });
+
+    TestCase.assertFalse(realm.isFrozen);
+
+    const frozenRealm = realm.freeze();
+    TestCase.assertTrue(frozenRealm.isFrozen);
+    TestCase.assertFalse(realm.isFrozen, "Freezing must not affect the live Realm.");
+
+    // Reads work on the frozen Realm and stay pinned to the frozen version.
+    TestCase.assertEqual(frozenRealm.objects("TestObject").length, 1);
+    realm.write(() => {
+      realm.create("TestObject", { doubleCol: 2 });
+    });
+    TestCase.assertEqual(frozenRealm.objects("TestObject").length, 1);
+    TestCase.assertEqual(realm.objects("TestObject").length, 2);
+
+    // Freezing a frozen Realm is a no-op returning the same instance.
+    TestCase.assertEqual(frozenRealm.freeze(), frozenRealm);
+
+    // Writes are not allowed on a frozen Realm.
+    TestCase.assertThrowsContaining(() => {
+      frozenRealm.write(() => {});
+    }, "frozen");
+
+    frozenRealm.close();
+    realm.close();
+  },
+
+  testWriteAsyncCommit: function () {
+    const realm = new Realm({ schema: [schemas.TestObject] });
+    return new Promise((resolve, reject) => {
+      realm.writeAsync(
+        () => {
+          realm.create("TestObject", { doubleCol: 3.5 });
+        },
+        (error) => {
+          try {
+            TestCase.assertUndefined(error);
+            TestCase.assertFalse(realm.isInTransaction);
+            const objects = realm.objects("TestObject");
+            TestCase.assertEqual(objects.length, 1);
+            TestCase.assertEqual(objects[0].doubleCol, 3.5);
+            realm.close();
+            resolve();
+          } catch (e) {
+            reject(e);
+          }
+        },
+      );
+    });
+  },
+
+  testWriteAsyncCancelOnThrow: function () {
+    const realm = new Realm({ schema: [schemas.TestObject] });
+    return new Promise((resolve, reject) => {
+      realm.writeAsync(
+        () => {
+          realm.create("TestObject", { doubleCol: 1 });
+          throw new Error("expected failure in write block");
+        },
+        (error) => {
+          try {
+            TestCase.assertInstanceOf(error, Error);
+            TestCase.assertTrue(error.message.includes("expected failure in write block"));
+            // The transaction is rolled back, so nothing was persisted.
+            TestCase.assertFalse(realm.isInTransaction);
+            TestCase.assertEqual(realm.objects("TestObject").length, 0);
+            realm.close();
+            resolve();
+          } catch (e) {
+            reject(e);
+          }
+        },
+      );
+    });
+  },
+
+  testCreateFromJson: function () {
+    const realm = new Realm({ schema: [schemas.IntPrimary] });
+
+    // Blank lines are skipped and unknown keys are ignored, matching create().
+    const ndjson =
+      '{"primaryCol": 1, "valueCol": "one"}\n' + "\n" + '{"primaryCol": 2, "valueCol": "two", "unknownCol": true}\n';
+    const created = realm.createFromJson("IntPrimaryObject", ndjson);
+    TestCase.assertEqual(created, 2);
+
+    const objects = realm.objects("IntPrimaryObject").sorted("primaryCol");
+    TestCase.assertEqual(objects.length, 2);
+    TestCase.assertEqual(objects[0].valueCol, "one");
+    TestCase.assertEqual(objects[1].valueCol, "two");
+
+    realm.close();
+  },
+
+  testCreateFromJsonMalformedLines: function () {
+    const realm = new Realm({ schema: [schemas.IntPrimary] });
+
+    TestCase.assertThrowsContaining(() => {
+      realm.createFromJson("IntPrimaryObject", '{"primaryCol": 1, "valueCol": "one"}\n{"primaryCol": 2,');
+    }, "Invalid JSON on line 2");
+
+    TestCase.assertThrowsContaining(() => {
+      realm.createFromJson("IntPrimaryObject", "[1, 2, 3]\n");
+    }, "Expected a JSON object on line 1");
+
+    // A failed batch is rolled back as a whole, including its valid lines.
+    TestCase.assertEqual(realm.objects("IntPrimaryObject").length, 0);
+
+    realm.close();
+  },
+
+  testCreateFromJsonDuplicatePrimaryKeys: function () {
+    const realm = new Realm({ schema: [schemas.IntPrimary] });
+
+    // Rows sharing a primary key update the same object; the return value
+    // counts processed lines, not distinct objects.
+    const created = realm.createFromJson(
+      "IntPrimaryObject",
+      '{"primaryCol": 1, "valueCol": "first"}\n{"primaryCol": 1, "valueCol": "second"}\n',
+    );
+    TestCase.assertEqual(created, 2);
+
+    const objects = realm.objects("IntPrimaryObject");
+    TestCase.assertEqual(objects.length, 1);
+    TestCase.assertEqual(objects[0].valueCol, "second", "The last row with a given primary key wins.");
+
+    realm.close();
+  },
+
+  testCreateFromJsonMissingPrimaryKey: function () {
+    const realm = new Realm({ schema: [schemas.IntPrimary] });
+
+    TestCase.assertThrowsContaining(() => {
+      realm.createFromJson("IntPrimaryObject", '{"valueCol": "no key"}\n');
+    }, "Missing primary key 'primaryCol' on line 1");
+    TestCase.assertEqual(realm.objects("IntPrimaryObject").length, 0);
+
+    realm.close();
+  },
 };
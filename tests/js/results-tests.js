@@ -1017,4 +1017,31 @@ module.exports = {
 
     realm.close();
   },
+
+  testResultsVersionCounter: function () {
+    const realm = new Realm({ schema: [schemas.TestObject] });
+    const results = realm.objects("TestObject");
+
+    TestCase.assertEqual(typeof results.version, "number");
+
+    // Outside of a write transaction the version is stable across reads.
+    const initial = results.version;
+    TestCase.assertEqual(results.version, initial);
+    TestCase.assertEqual(results.version, initial);
+
+    realm.write(() => {
+      realm.create("TestObject", { doubleCol: 1 });
+
+      // Inside a write transaction any read may observe new data, so every
+      // read reports a fresh version.
+      TestCase.assertNotEqual(results.version, results.version);
+    });
+
+    // A committed write advances the version, which is then stable again.
+    const afterWrite = results.version;
+    TestCase.assertNotEqual(afterWrite, initial);
+    TestCase.assertEqual(results.version, afterWrite);
+
+    realm.close();
+  },
 };
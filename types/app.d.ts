@@ -322,6 +322,17 @@ declare namespace Realm {
      */
     logIn(credentials: Credentials): Promise<User<FunctionsFactoryType, CustomDataType>>;
 
+    /**
+     * Log in several users in one call. The login requests are dispatched to
+     * the transport together so they overlap on the network, and the promise
+     * resolves once with all users. Rejects with the first error if any login
+     * fails.
+     *
+     * @param credentialsList the credentials to log in with, one per user
+     * @since 10.22.0
+     */
+    logInMany(credentialsList: Credentials[]): Promise<User<FunctionsFactoryType, CustomDataType>[]>;
+
     /**
      * Switch current user, from an instance of `User` or the string id of the user.
      */
@@ -228,15 +228,33 @@ declare namespace Realm {
         encryptionKey?: ArrayBuffer | ArrayBufferView | Int8Array;
         schema?: (ObjectClass | ObjectSchema)[];
         schemaVersion?: number;
-        shouldCompactOnLaunch?: (totalBytes: number, usedBytes: number) => boolean;
+        shouldCompactOnLaunch?:
+            | ((totalBytes: number, usedBytes: number) => boolean)
+            | { thresholdBytes?: number; usedRatio?: number };
         onFirstOpen?: (realm: Realm) => void;
         path?: string;
         fifoFilesFallbackPath?: string;
         readOnly?: boolean;
+        notificationPolicy?: {
+            coalesceWindowMs?: number;
+            maxWakesPerSecond?: number;
+            manualRefresh?: boolean;
+        };
+        /**
+         * Advises the OS how the file will be read: 'sequential' for full
+         * scans, 'willneed' to prefetch at open, 'random' for point lookups.
+         * Advisory only; ignored on platforms without madvise support.
+         */
+        accessPattern?: "sequential" | "willneed" | "random";
     }
 
     interface ConfigurationWithSync extends BaseConfiguration {
         sync: SyncConfiguration;
+        /**
+         * Decrypt all pages of an encrypted Realm before `Realm.open` resolves,
+         * instead of on first access. Ignored without an `encryptionKey`.
+         */
+        warmEncryptedPages?: boolean;
         migration?: never;
         inMemory?: never;
         deleteRealmIfMigrationNeeded?: never;
@@ -247,6 +265,12 @@ declare namespace Realm {
         sync?: never;
         migration?: MigrationCallback;
         inMemory?: boolean;
+        /**
+         * Keep a named in-memory Realm's contents alive after every instance
+         * of it closes, so other contexts in the process can reopen it by
+         * path. Requires `inMemory: true`; release with `Realm._unpinInMemory`.
+         */
+        pinInMemory?: boolean;
         deleteRealmIfMigrationNeeded?: boolean;
         disableFormatUpgrade?: boolean;
     }
@@ -299,6 +323,18 @@ declare namespace Realm {
          */
         isValid(): boolean;
 
+        /**
+         * @returns `true` if the object is frozen (pinned to a version), `false` otherwise.
+         */
+        isFrozen(): boolean;
+
+        /**
+         * Returns an immutable copy of this object, pinned to the version it is at.
+         * @param realm Optionally, an already-frozen Realm the copy should belong to,
+         * so that many objects can share one frozen Realm instance.
+         */
+        freeze(realm?: Realm): this;
+
         /**
          * @returns ObjectSchema
          */
@@ -314,12 +350,18 @@ declare namespace Realm {
          */
         linkingObjectsCount(): number;
 
+        /**
+         * Counts the links through one relationship without constructing a Results.
+         * @returns number
+         */
+        linkingObjectsCount(objectType: string, property: string): number;
+
         _objectId(): string;
 
         /**
          * @returns void
          */
-        addListener(callback: ObjectChangeCallback<this>): void;
+        addListener(callback: ObjectChangeCallback<this>, keyPaths?: string[]): void;
 
         removeListener(callback: ObjectChangeCallback<this>): void;
 
@@ -381,7 +423,7 @@ declare namespace Realm {
         /**
          * @returns void
          */
-        addListener(callback: DictionaryChangeCallback): void;
+        addListener(callback: DictionaryChangeCallback, keys?: string[]): void;
         removeListener(callback: DictionaryChangeCallback): void;
         removeAllListeners(): void;
     }
@@ -394,6 +436,15 @@ declare namespace Realm {
         readonly type: PropertyType;
         readonly optional: boolean;
 
+        /**
+         * A monotonically increasing integer that advances whenever the
+         * collection's contents may have changed. Comparing two reads of this
+         * property is a cheap "did anything change since I last looked?"
+         * check — no listener registration required. It may advance without a
+         * visible change, but never stays the same across one.
+         */
+        readonly version: number;
+
         /**
          * @returns An object for JSON serialization.
          */
@@ -484,6 +535,23 @@ declare namespace Realm {
          * @returns T
          */
         splice(index: number, count?: number, object?: any): T[];
+
+        /**
+         * Move the value at `from` to `to` in place, producing a single move
+         * change-set entry instead of a delete+insert pair.
+         * @param  {number} from
+         * @param  {number} to
+         * @returns void
+         */
+        move(from: number, to: number): void;
+
+        /**
+         * Exchange the values at two indices in place.
+         * @param  {number} index1
+         * @param  {number} index2
+         * @returns void
+         */
+        swap(index1: number, index2: number): void;
     }
 
     const List: {
@@ -523,6 +591,35 @@ declare namespace Realm {
          */
          has(object: T): boolean;
 
+        /**
+         * Compute the union of the Set and another Set or array, materialized
+         * as a plain array in one native call.
+         * @param  {Realm.Set<T>|ReadonlyArray<T>} values
+         * @returns The elements present in either collection
+         */
+        union(values: Realm.Set<T> | ReadonlyArray<T>): T[];
+
+        /**
+         * Compute the intersection of the Set and another Set or array.
+         * @param  {Realm.Set<T>|ReadonlyArray<T>} values
+         * @returns The elements present in both collections
+         */
+        intersection(values: Realm.Set<T> | ReadonlyArray<T>): T[];
+
+        /**
+         * Compute the elements of the Set not present in another Set or array.
+         * @param  {Realm.Set<T>|ReadonlyArray<T>} values
+         * @returns The elements of the Set not present in `values`
+         */
+        difference(values: Realm.Set<T> | ReadonlyArray<T>): T[];
+
+        /**
+         * Check whether every element of the Set is present in another Set or array.
+         * @param  {Realm.Set<T>|ReadonlyArray<T>} values
+         * @returns Boolean: true if the Set is a subset of `values`
+         */
+        isSubsetOf(values: Realm.Set<T> | ReadonlyArray<T>): boolean;
+
          readonly size: number
     }
 
@@ -543,6 +640,36 @@ declare namespace Realm {
          * @returns void
          */
         update(property: string, value: any): void;
+
+        /**
+         * Counts the objects in the results, or the objects whose given property is non-null,
+         * without constructing any objects.
+         * @param  {string} property
+         * @returns number
+         */
+        count(property?: string): number;
+
+        /**
+         * Returns the objects at positions [start, start + count) as a plain array,
+         * materialized in one native call; the following page is prepared in the
+         * background of the event loop for forward pagination.
+         * @param  {number} start
+         * @param  {number} count
+         * @returns T[]
+         */
+        window(start: number, count: number): T[];
+
+        /**
+         * @returns `true` if the collection is frozen (pinned to a version), `false` otherwise.
+         */
+        isFrozen(): boolean;
+
+        /**
+         * Returns an immutable copy of these Results, pinned to the version the collection is at.
+         * @param realm Optionally, an already-frozen Realm the copy should belong to,
+         * so that many collections can share one frozen Realm instance.
+         */
+        freeze(realm?: Realm): Results<T>;
     }
 
     const Results: {
@@ -550,6 +677,21 @@ declare namespace Realm {
         readonly prototype: Results<any>;
     };
 
+    /**
+     * A query precompiled by {@link Realm.compileQuery}.
+     */
+    interface CompiledQuery<T> {
+        readonly objectType: string;
+        readonly queryString: string;
+
+        /**
+         * Binds the given arguments to the query's placeholders and returns live results.
+         * @param  {any[]} ...args
+         * @returns Results<T>
+         */
+        run(...args: any[]): Results<T>;
+    }
+
     /**
      * A primitive value, a BSON value or an object link.
      */
@@ -611,7 +753,18 @@ declare namespace Realm {
     type ProgressDirection = 'download' | 'upload';
     type ProgressMode = 'reportIndefinitely' | 'forCurrentlyOutstandingWork';
 
-    type ConnectionNotificationCallback = (newState: ConnectionState, oldState: ConnectionState) => void;
+    /**
+     * Throttling options for progress notifications. Intermediate updates are
+     * coalesced on the sync thread; the final update of a transfer is always delivered.
+     */
+    interface ProgressNotificationOptions {
+        /** Minimum number of milliseconds between deliveries of the callback. */
+        minIntervalMs?: number;
+        /** Minimum number of bytes transferred since the last delivery. */
+        minDeltaBytes?: number;
+    }
+
+    type ConnectionNotificationCallback = (newState: ConnectionState, oldState: ConnectionState, info?: { flapCount: number; epoch: number }) => void;
 
     namespace App.Sync {
         class Session {
@@ -621,14 +774,16 @@ declare namespace Realm {
             readonly user: User;
             readonly connectionState: ConnectionState;
 
-            addProgressNotification(direction: ProgressDirection, mode: ProgressMode, progressCallback: ProgressNotificationCallback): void;
+            addProgressNotification(direction: ProgressDirection, mode: ProgressMode, progressCallback: ProgressNotificationCallback, options?: number | ProgressNotificationOptions): void;
             removeProgressNotification(progressCallback: ProgressNotificationCallback): void;
 
-            addConnectionNotification(callback: ConnectionNotificationCallback): void;
+            addConnectionNotification(callback: ConnectionNotificationCallback, options?: number | { debounceMs?: number }): void;
             removeConnectionNotification(callback: ConnectionNotificationCallback): void;
 
             isConnected(): boolean;
 
+            stats(): SessionStats | undefined;
+
             resume(): void;
             pause(): void;
 
@@ -637,6 +792,27 @@ declare namespace Realm {
         }
 
 
+        interface SessionStats {
+            connectionState: ConnectionState;
+            uploadedBytes: number;
+            uploadableBytes: number;
+            downloadedBytes: number;
+            downloadableBytes: number;
+            pendingUploadBytes: number;
+            pendingDownloadBytes: number;
+        }
+
+        interface SyncStats {
+            sessionCount: number;
+            connectedSessions: number;
+            connectingSessions: number;
+            disconnectedSessions: number;
+            uploadedBytes: number;
+            downloadedBytes: number;
+            pendingUploadBytes: number;
+            pendingDownloadBytes: number;
+        }
+
         /**
         * AuthError
         */
@@ -662,9 +838,13 @@ declare namespace Realm {
         type PartitionValue = string|number|Realm.BSON.ObjectId|Realm.BSON.UUID|null;
 
         function getAllSyncSessions(user: Realm.User): [Realm.App.Sync.Session];
+        function sessionCount(user: Realm.User): number;
+        function getSyncStats(user: Realm.User): Realm.App.Sync.SyncStats;
         function getSyncSession(user: Realm.User, partitionValue: Realm.App.Sync.PartitionValue) : Realm.App.Sync.Session;
         function setLogLevel(app: App, logLevel: LogLevel): void;
-        function setLogger(app: App, callback: (level: NumericLogLevel, message: string) => void): void;
+        type LogCategory = 'connection' | 'session' | 'changeset' | 'other';
+        function setLogger(app: App, callback: (level: NumericLogLevel, message: string) => void, categories?: LogCategory[]): void;
+        function enableBinaryLogging(app: App, path: string, maxBytes?: number): void;
         function setUserAgent(app: App, userAgent: string): void;
         function enableSessionMultiplexing(app: App): void;
         function initiateClientReset(app: App, path: string): void;
@@ -895,6 +1075,56 @@ declare namespace Realm {
              * if there was an error during synchronization (see {@link waitForSynchronisation})
              */
             update: (callback: (mutableSubs: MutableSubscriptionSet, realm: Realm) => void) => Promise<void>;
+
+            /**
+             * Apply a batch of subscription changes in a single commit and change this
+             * instance to point to the updated SubscriptionSet.
+             *
+             * All the changes described by `descriptors` produce one new subscription-set
+             * version (one server round trip), where per-change {@link update} calls would
+             * produce one version each.
+             *
+             * Example:
+             * ```
+             * await realm.subscriptions.updateBatch([
+             *   { query: realm.objects("Cat").filtered("age > 10"), name: "oldCats" },
+             *   { query: realm.objects("Dog").filtered("age > 20") },
+             *   { removeByName: "personSubs" },
+             * ]);
+             * ```
+             *
+             * @param descriptors An array of descriptor objects, each one of:
+             * - `{query, name?, throwOnUpdate?}`: add a subscription for the query, with
+             *   the same semantics as {@link MutableSubscriptionSet.add}
+             * - `{removeByName}`: remove the subscription with the given name
+             * - `{remove}`: remove the subscription matching the given query
+             *
+             * @returns A promise which resolves with the added {@link Subscription}s (in
+             * descriptor order) when the SubscriptionSet is synchronized, or is rejected
+             * if there was an error during synchronization (see {@link waitForSynchronisation})
+             */
+            updateBatch: (descriptors: ReadonlyArray<SubscriptionBatchDescriptor>) => Promise<Subscription[]>;
+        }
+
+        /**
+         * A single entry in the array passed to {@link SubscriptionSet.updateBatch}.
+         */
+        interface SubscriptionBatchDescriptor extends SubscriptionOptions {
+            /**
+             * A query to subscribe to, represented as a {@link Realm.Results} instance.
+             */
+            query?: Realm.Results<unknown>;
+
+            /**
+             * The name of a subscription to remove.
+             */
+            removeByName?: string;
+
+            /**
+             * A query whose matching subscription should be removed, represented as a
+             * {@link Realm.Results} instance.
+             */
+            remove?: Realm.Results<unknown>;
         }
 
         const SubscriptionSet: {
@@ -1034,6 +1264,11 @@ declare class Realm {
     readonly isInTransaction: boolean;
     readonly isClosed: boolean;
 
+    /**
+     * `true` if the Realm is frozen (an immutable snapshot pinned to a version), `false` otherwise.
+     */
+    readonly isFrozen: boolean;
+
     readonly syncSession: Realm.App.Sync.Session | null;
 
     /**
@@ -1068,6 +1303,15 @@ declare class Realm {
      */
     static deleteFile(config: Realm.Configuration): void;
 
+    /**
+     * Asynchronous variant of `deleteFile(config)`. Removing a large Realm also
+     * unlinks its lock, note and management files, which can take tens of
+     * milliseconds; the removal runs on a background thread instead of blocking
+     * the JS thread.
+     * @param {Configuration} config
+     */
+    static deleteFileAsync(config: Realm.Configuration): Promise<void>;
+
     /**
      * Copy any Realm files  (i.e. `*.realm`) bundled with the application from the application
      * directory into the application's documents directory, so that they can be opened and used
@@ -1095,6 +1339,14 @@ declare class Realm {
      */
     static copyBundledRealmFiles(): void;
 
+    /**
+     * Asynchronous variant of `copyBundledRealmFiles()`. The copy is pure file
+     * I/O and runs on a background thread instead of blocking the JS thread.
+     *
+     * This is only implemented for React Native.
+     */
+    static copyBundledRealmFilesAsync(): Promise<void>;
+
     /**
      * Clears the state by closing and deleting any Realm in the default directory and logout all users.
      * @private Not a part of the public API: It's primarily used from the library's tests.
@@ -1106,6 +1358,21 @@ declare class Realm {
      */
     static exists(config: Realm.Configuration): boolean;
 
+    /**
+     * Returns a snapshot of the memory held by the binding: live native
+     * wrapper counts per class, protected reference and notification token
+     * counts, and an entry per open Realm with its file size and version
+     * counts.
+     * @since 10.22.0
+     */
+    static memoryStats(): {
+      wrappedObjects: { [className: string]: number };
+      protectedReferences: number;
+      notificationTokens: number;
+      openRealmCount: number;
+      openRealms: { path: string; fileSize: number; liveVersions: number; pinnedVersions: number }[];
+    };
+
     /**
      * @param  {Realm.Configuration} config?
      */
@@ -1145,6 +1412,15 @@ declare class Realm {
      */
     delete(object: Realm.Object | Realm.Object[] | Realm.List<any> | Realm.Results<any> | any): void;
 
+    /**
+     * Deletes many objects of one type in a single native call; entries may be
+     * managed objects or primary key values. Returns the number of objects deleted.
+     * @param  {string} type
+     * @param  {Array} objects
+     * @returns number
+     */
+    deleteMany(type: string, objects: ReadonlyArray<Realm.Object | Realm.PrimaryKey>): number;
+
     /**
      * @returns void
      */
@@ -1187,6 +1463,15 @@ declare class Realm {
     // Combined definitions
     objects<T>(type: string | {new(...arg: any[]): T; }): Realm.Results<T & Realm.Object>;
 
+    /**
+     * Compiles a query for repeated execution; run(...args) binds the arguments
+     * and returns live results without re-resolving the schema or key paths.
+     * @param  {string} type
+     * @param  {string} query
+     * @returns Realm.CompiledQuery<T & Realm.Object>
+     */
+    compileQuery<T>(type: string, query: string): Realm.CompiledQuery<T & Realm.Object>;
+
     /**
      * @param  {string} name
      * @param  {()=>void} callback
@@ -1230,11 +1515,46 @@ declare class Realm {
      */
     cancelTransaction(): void;
 
+    /**
+     * Advance the Realm to the latest version on demand; required when the
+     * Realm was opened with a manual-refresh notification policy.
+     * @returns boolean: true if the version actually advanced
+     */
+    refresh(): boolean;
+
+    /**
+     * Pin the read transaction at its current version until the matching
+     * unpin(); queries in between all see the same data.
+     * @returns the pinned version handle
+     */
+    pin(): { version: number; index: number };
+
+    /**
+     * Release one level of pin(); the last release catches the Realm up to
+     * the latest version.
+     * @returns void
+     */
+    unpin(): void;
+
     /**
      * @returns boolean
      */
     compact(): boolean;
 
+    /**
+     * Compacts the Realm on a background thread without blocking the JS thread.
+     * The returned promise resolves with `true` if compaction succeeded, or `false`
+     * if it was skipped (e.g. because other processes have the file open).
+     */
+    compactAsync(): Promise<boolean>;
+
+    /**
+     * Returns an immutable snapshot of this Realm, pinned to its current version. A frozen
+     * Realm never advances, never notifies, and may be read from any thread. Returns this
+     * Realm if it is already frozen.
+     */
+    freeze(): Realm;
+
     /**
      * Write a copy of a realm at the destination path.  Any user will be able to open and use
      * the new copy.  Copying a synced realm will create a snapshot of the realm that can be
@@ -1259,6 +1579,19 @@ declare class Realm {
      */
     writeCopyTo(config: Realm.Configuration): void;
 
+    /**
+     * Asynchronous variant of `writeCopyTo(config)`. The copy reads from a snapshot
+     * pinned at the current version and runs on a background thread, leaving this
+     * Realm fully usable while it is in progress. The optional progress callback is
+     * invoked with coalesced `(bytesWritten, estimatedTotalBytes)` updates.
+     * @param config Realm configuration that describes the output realm.
+     * @param onProgress optional callback reporting copy progress.
+     */
+    writeCopyToAsync(
+        config: Realm.Configuration,
+        onProgress?: (bytesWritten: number, estimatedTotalBytes: number) => void,
+    ): Promise<void>;
+
     /**
      * Update the schema of the Realm.
      *